@@ -0,0 +1,3 @@
+// the boot image, which the kernel starts as task #1 from 0x08004000
+#define main bootMain
+#include "../../kernel/src/boot/main.c"
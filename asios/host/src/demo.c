@@ -0,0 +1,3 @@
+// the Z80 CP/M demo image, which the boot task launches from 0x08008000
+#define main demoMain
+#include "../../kernel/src/demo/main.c"
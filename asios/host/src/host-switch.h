@@ -0,0 +1,32 @@
+// Host version of the task switcher, included by main.cpp in place of PendSV.
+//
+// Each task runs as a fiber, see hostSwitch() in host.cpp. As on the real
+// hardware, "PendSV" only runs on the way out of an SVC or SysTick, and saves
+// the location of the current hardware stack frame in the task's pspSaved, so
+// that regs() still finds the system call args of tasks which are blocked.
+
+void PendSV_Handler () {
+    uint32_t** curr = pspSw.curr;
+    hostPsp[-1] = EXC_RETURN_NOFP; // as on the real thing, the FPU isn't used
+    *curr = hostPsp - PSP_EXTRA; // i.e. pspSaved, as PendSV would set it
+    pspSw.curr = pspSw.next;
+
+    // the initial stack frame is only used when the task runs for the first time
+    HardwareStackFrame* psp = (HardwareStackFrame*) (*pspSw.curr + PSP_EXTRA);
+    hostSwitch(curr, pspSw.curr, psp->pc, psp->r[0], psp->lr);
+}
+
+void startTasks (void* firstTask) {
+    pspSw.curr = pspSw.next = (uint32_t**) firstTask;
+    VTableRam().pend_sv = PendSV_Handler;
+
+    HardwareStackFrame* psp = (HardwareStackFrame*) (*pspSw.curr + PSP_EXTRA);
+    hostStart(firstTask, psp->pc, psp->r[0], psp->lr); // never returns
+}
+
+void changeTask (void* next) {
+    // trigger a PendSV when back in thread mode to switch tasks
+    pspSw.next = (uint32_t**) next;
+    if (pspSw.next != pspSw.curr)
+        MMIO32(0xE000ED04) |= 1<<28; // SCB->ICSR |= PENDSVSET
+}
@@ -0,0 +1,384 @@
+// Host platform layer for the asios kernel, see jee.h and host-switch.h
+//
+// Tasks run as ucontext fibers, a system call is a direct call to hostSvc()
+// with SIGALRM blocked (so that ticks can't interrupt it, as with SVC and
+// SysTick on the real hardware), and SysTick is a 1 ms SIGALRM interval timer.
+// A context switch can happen on the way out of both, as with PendSV.
+//
+// The kernel and its tasks store pointers in 32-bit words, so everything has
+// to live in the lower 4 GB: this is built as a non-PIE executable, and all
+// fiber stacks are mapped with MAP_32BIT. Internal flash is emulated in RAM at
+// its usual address range (for FlashWear), as are the vectors of the boot image
+// at 0x08004000 and of the image it launches at 0x08008000.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+
+#define HOST_LAYER
+#include "jee.h"
+
+constexpr uint32_t CPU_HZ = 168000000; // pretend to be an STM32F407
+constexpr int FIBER_STACK = 64 * 1024;
+constexpr int MAX_FIBERS = 32;
+
+void SVC_Handler (); // in the kernel
+
+volatile uint32_t ticks;
+uint32_t* hostPsp;
+int hostRequest;
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Memory-mapped registers, kept in a small hash table.
+
+struct Register { uint32_t addr, value; };
+static Register registers [128];
+
+static uint32_t cycles () {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * CPU_HZ + (uint64_t) ts.tv_nsec * 168 / 1000;
+}
+
+volatile uint32_t& hostMmio (uint32_t addr) {
+    uint32_t i = (addr * 2654435761U) >> 25;
+    while (registers[i].addr != addr && registers[i].addr != 0)
+        i = (i + 1) % 128;
+    registers[i].addr = addr;
+    if (addr == 0xE0001004) // DWT->CYCCNT
+        registers[i].value = cycles();
+    if (addr == 0xE000E018) { // SYST_CVR, counts down to the next tick
+        itimerval itv;
+        getitimer(ITIMER_REAL, &itv);
+        registers[i].value = (itv.it_value.tv_sec * 1000000 +
+                                itv.it_value.tv_usec) * (CPU_HZ / 1000000);
+    }
+    return registers[i].value;
+}
+
+VTable& VTableRam () {
+    static VTable vtable;
+    return vtable;
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Console and other bits of JeeH. Output avoids stdio, since tasks can be
+// preempted anywhere, and note that write() and read() are system call stubs.
+
+// output is buffered, as a real UART would, and flushed on each tick, so that
+// the cost of a host write per character doesn't swamp all other timings
+static char outBuf [4096];
+static volatile int outFill;
+static volatile bool outBusy; // set while adding, ticks won't flush then
+
+static void outFlush () {
+    if (outFill > 0)
+        syscall(SYS_write, 1, outBuf, outFill);
+    outFill = 0;
+}
+
+void hostPutc (int c) {
+    outBusy = true;
+    if (outFill >= (int) sizeof outBuf)
+        outFlush();
+    outBuf[outFill] = c;
+    outFill = outFill + 1;
+    outBusy = false;
+}
+
+int hostGetc () {
+    char ch;
+    if (syscall(SYS_read, 0, &ch, 1) <= 0)
+        hostExit(0); // end of input, stop the simulation
+    return ch;
+}
+
+// at the end of piped input, this keeps returning false, i.e. waiting for more
+bool hostReadable () {
+    int n = 0;
+    syscall(SYS_ioctl, 0, FIONREAD, &n);
+    return n > 0;
+}
+
+void veprintf (void (*emit)(int), char const* fmt, va_list ap) {
+    char buf [200];
+    int n = vsnprintf(buf, sizeof buf, fmt, ap);
+    for (int i = 0; i < n && i < (int) sizeof buf - 1; ++i)
+        emit(buf[i]);
+}
+
+void wait_ms (uint32_t ms) {
+    usleep(ms * 1000);
+}
+
+uint32_t fullSpeedClock () {
+    return CPU_HZ;
+}
+
+void hostExit (int e) {
+    outFlush();
+    fflush(stdout);
+    _exit(e);
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Internal flash, with the same erase and write semantics as the real one.
+
+constexpr uintptr_t FLASH_LO = 0x00010000, FLASH_HI = 0x00120000;
+
+void Flash::erasePage (void const* addr) {
+    uintptr_t a = (uintptr_t) addr;
+    if (a < FLASH_LO || a >= FLASH_HI)
+        return; // not in the emulated area
+    if (a < 0x20000) // a 64K sector, followed by 128K ones
+        memset((void*) 0x10000, 0xFF, 0x10000);
+    else
+        memset((void*) (a & ~0x1FFFF), 0xFF, 0x20000);
+}
+
+// flash writes can only clear bits, the same as on real hardware
+void Flash::write8 (void const* addr, uint8_t val) {
+    *(uint8_t*) addr &= val;
+}
+
+void Flash::write16 (void const* addr, uint16_t val) {
+    *(uint16_t*) addr &= val;
+}
+
+void Flash::write32 (void const* addr, uint32_t val) {
+    *(uint32_t*) addr &= val;
+}
+
+void Flash::write32buf (void const* addr, uint32_t const* ptr, int len) {
+    for (int i = 0; i < len; ++i)
+        write32((uint32_t const*) addr + i, ptr[i]);
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Fibers, one per task, created on first use.
+
+struct Fiber {
+    void* key; // the task
+    ucontext_t ctx;
+};
+
+static Fiber fibers [MAX_FIBERS];
+
+static void trampoline (uint32_t pc, uint32_t r0, uint32_t lr) {
+    ((void (*)(void*)) (uintptr_t) pc)((void*) (uintptr_t) r0);
+    ((int (*)(int)) (uintptr_t) lr)(0); // i.e. texit, which doesn't return
+}
+
+static Fiber& fiberFor (void* key, uint32_t pc, uint32_t r0, uint32_t lr) {
+    int i = 0;
+    while (fibers[i].key != key && fibers[i].key != 0)
+        if (++i >= MAX_FIBERS) {
+            fprintf(stderr, "host: too many fibers\n");
+            hostExit(1);
+        }
+    Fiber& f = fibers[i];
+    if (f.key == 0) {
+        f.key = key;
+        getcontext(&f.ctx);
+        if (pc != 0) {
+            void* stack = mmap(0, FIBER_STACK, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+            if (stack == MAP_FAILED) {
+                perror("host: fiber stack");
+                hostExit(1);
+            }
+            f.ctx.uc_stack.ss_sp = stack;
+            f.ctx.uc_stack.ss_size = FIBER_STACK;
+            f.ctx.uc_link = 0;
+            sigemptyset(&f.ctx.uc_sigmask); // tasks run with ticks enabled
+            makecontext(&f.ctx, (void (*)()) trampoline, 3, pc, r0, lr);
+        }
+    }
+    return f;
+}
+
+void hostSwitch (void* from, void* to, uint32_t pc, uint32_t r0, uint32_t lr) {
+    Fiber& f = fiberFor(from, 0, 0, 0);
+    Fiber& t = fiberFor(to, pc, r0, lr);
+    swapcontext(&f.ctx, &t.ctx);
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Exceptions: SVC, SysTick, and PendSV.
+
+static sigset_t alarmSet;
+static uint32_t periodMs = 1; // current tick timer interval
+static uint32_t elapsedMs, runMs;
+
+static void setInterval (uint32_t ms) {
+    itimerval itv = {{ 0, (long) ms * 1000 }, { 0, (long) ms * 1000 }};
+    itv.it_interval.tv_sec = itv.it_value.tv_sec = ms / 1000;
+    itv.it_interval.tv_usec = itv.it_value.tv_usec = (ms % 1000) * 1000;
+    setitimer(ITIMER_REAL, &itv, 0);
+    periodMs = ms;
+}
+
+// follow changes to the SysTick reload value, i.e. tickless mode
+static void followReload () {
+    uint32_t ms = (hostMmio(0xE000E014) + 1) / (CPU_HZ / 1000);
+    if (ms != periodMs)
+        setInterval(ms > 0 ? ms : 1);
+}
+
+// run PendSV if it has been triggered, as on return from an exception
+static void exceptionReturn () {
+    volatile uint32_t& icsr = hostMmio(0xE000ED04);
+    if (icsr & (1<<28)) {
+        icsr &= ~(1<<28);
+        VTableRam().pend_sv();
+    }
+}
+
+extern "C" int hostSvc (uintptr_t a, uintptr_t b, uintptr_t c, uintptr_t d,
+                        int req) {
+    sigset_t saved;
+    sigprocmask(SIG_BLOCK, &alarmSet, &saved);
+
+    // room for the registers which PendSV would save, then the stack frame
+    uint32_t frame [16 + 8] = {};
+    uint32_t* hw = frame + 16;
+    hw[0] = a; hw[1] = b; hw[2] = c; hw[3] = d;
+    hostPsp = hw;
+    hostRequest = req;
+
+    VTable& v = VTableRam();
+    if (v.sv_call)
+        v.sv_call();
+    else
+        SVC_Handler();
+    exceptionReturn(); // may switch away, and come back later
+
+    sigprocmask(SIG_SETMASK, &saved, 0);
+    return hw[0];
+}
+
+// run an interrupt handler, with SIGALRM blocked
+static void interrupt (void (*handler)()) {
+    uint32_t frame [16 + 8] = {};
+    hostPsp = frame + 16;
+    handler();
+    followReload(); // the handler may have changed the tick period
+    exceptionReturn(); // may switch away, and come back later
+}
+
+// the UART receive interrupt, which keeps firing as long as there is input
+static void uartIrq () {
+    hostMmio(0x40011000) |= 1<<5; // USART1->SR |= RXNE
+    VTableRam().usart1();
+    hostMmio(0x40011000) &= ~(1<<5);
+}
+
+static void onTick (int) {
+    int e = errno;
+
+    VTable& v = VTableRam();
+    if (v.systick)
+        interrupt(v.systick);
+    else
+        ticks += 1; // as done by JeeH
+    if (v.usart1 && hostReadable())
+        interrupt(uartIrq);
+
+    if (!outBusy)
+        outFlush();
+
+    elapsedMs += periodMs;
+    if (runMs > 0 && elapsedMs >= runMs) {
+        fprintf(stderr, "\nhost: stopped after %u ms\n", elapsedMs);
+        hostExit(0);
+    }
+    errno = e;
+}
+
+// wait for the next tick, or for input, which then raises the RX interrupt
+void hostIdle () {
+    sigprocmask(SIG_BLOCK, &alarmSet, 0);
+    if (!outBusy)
+        outFlush(); // don't wait for the next tick, it may be a while
+
+    sigset_t none;
+    sigemptyset(&none);
+    pollfd fds = { 0, POLLIN, 0 };
+    if (ppoll(&fds, 1, 0, &none) > 0) {
+        if (hostReadable() && VTableRam().usart1)
+            interrupt(uartIrq);
+        else
+            sigsuspend(&none); // end of input, only wait for ticks
+    }
+    sigprocmask(SIG_UNBLOCK, &alarmSet, 0);
+}
+
+void hostStart (void* first, uint32_t pc, uint32_t r0, uint32_t lr) {
+    struct sigaction sa = {};
+    sa.sa_handler = onTick;
+    sa.sa_flags = SA_RESTART;
+    sigaction(SIGALRM, &sa, 0);
+    setInterval(1);
+
+    static int mainKey; // the original stack, which is never resumed
+    hostSwitch(&mainKey, first, pc, r0, lr);
+    hostExit(1);
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Memory layout, as set up by the linker script and boot images on hardware.
+
+// the system stack is only used for the initial task frame, see main(), the
+// other linker symbols are only printed, see LDFLAGS in the Makefile
+uint8_t hostStack [4096] __attribute__((aligned(8)));
+asm (".globl _ebss, _estack\n"
+     ".set _ebss, hostStack\n.set _estack, hostStack+4096");
+
+extern "C" int bootMain (); // src/boot/main.c, see boot.c
+extern "C" int demoMain () __attribute__((weak)); // src/demo/main.c, demo.c
+
+static void hostImage (void*) {} // stands in for the image at 0x08008000
+
+__attribute__((constructor))
+static void hostInit () {
+    sigemptyset(&alarmSet);
+    sigaddset(&alarmSet, SIGALRM);
+    hostMmio(0xE000E014) = CPU_HZ / 1000 - 1; // SYST_RVR, 1 ms ticks
+
+    char const* s = getenv("ASIOS_SECONDS");
+    runMs = 1000 * (s ? atoi(s) : 10);
+
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE;
+    void* flash = mmap((void*) FLASH_LO, FLASH_HI - FLASH_LO,
+                        PROT_READ | PROT_WRITE, flags, -1, 0);
+    void* vecs = mmap((void*) 0x08000000, 0x10000,
+                        PROT_READ | PROT_WRITE, flags, -1, 0);
+    void* ccm = mmap((void*) 0x10000000, 0x10000, // used for Z80 memory
+                        PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (flash == MAP_FAILED || vecs == MAP_FAILED || ccm == MAP_FAILED) {
+        perror("host: can't map flash memory (check vm.mmap_min_addr)");
+        exit(1);
+    }
+    memset(flash, 0xFF, FLASH_HI - FLASH_LO); // erased
+
+    // the boot image gets its own stack, the image it launches shares it
+    // (only the initial stack frame is stored there, tasks run on fibers)
+    static uint8_t bootStack [1024] __attribute__((aligned(8)));
+    uint32_t* boot = (uint32_t*) 0x08004000;
+    boot[0] = (uintptr_t) (bootStack + sizeof bootStack);
+    boot[1] = (uintptr_t) bootMain;
+    uint32_t* image = (uint32_t*) 0x08008000;
+    image[0] = (uintptr_t) (bootStack + sizeof bootStack / 2);
+    image[1] = demoMain ? (uintptr_t) demoMain : (uintptr_t) hostImage;
+}
@@ -0,0 +1,95 @@
+// Stand-in for the parts of JeeH used by the asios kernel, for the host build.
+//
+// Memory-mapped registers end up in a small table, so that the kernel can keep
+// writing to SCB, SysTick, and DWT registers. A few of them are given meaning
+// in host.cpp: PENDSVSET in ICSR triggers a "PendSV" on the next return from a
+// system call or tick, the SysTick reload value sets the tick timer interval,
+// its current value reads the time left until the next tick, and the DWT cycle
+// counter reads the host's time stamp counter.
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+
+volatile uint32_t& hostMmio (uint32_t addr);
+
+#define MMIO32(a) (hostMmio(a))
+#define MMIO16(a) (*(volatile uint16_t*) &hostMmio(a))
+#define MMIO8(a)  (*(volatile uint8_t*) &hostMmio(a))
+
+extern volatile uint32_t ticks;
+
+// services of the host layer, see host.cpp
+extern uint32_t* hostPsp;   // hardware stack frame of the current "exception"
+extern int hostRequest;     // the request code of the current system call
+extern "C" int hostSvc (uintptr_t a, uintptr_t b, uintptr_t c, uintptr_t d,
+                        int req);
+void hostSwitch (void* from, void* to, uint32_t pc, uint32_t r0, uint32_t lr);
+void hostStart (void* first, uint32_t pc, uint32_t r0, uint32_t lr);
+void hostIdle ();
+void hostExit (int e);
+void hostPutc (int c);
+int hostGetc ();
+bool hostReadable ();
+
+void veprintf (void (*emit)(int), char const* fmt, va_list ap);
+#ifndef HOST_LAYER // host.cpp uses stdio, where printf is the libc version
+int printf (char const* fmt, ...); // defined in the kernel
+#endif
+void wait_ms (uint32_t ms);
+uint32_t fullSpeedClock ();
+
+enum class Pinmode { out };
+
+template< char port, int pin >
+struct Pin {
+    static void mode (Pinmode) {}
+    Pin& operator= (int) { return *this; }
+    operator int () const { return 0; }
+};
+
+template< int N > using PinA = Pin<'A',N>;
+template< int N > using PinE = Pin<'E',N>;
+
+struct VTable {
+    void (*hard_fault)();
+    void (*memory_manage_fault)();
+    void (*bus_fault)();
+    void (*usage_fault)();
+    void (*sv_call)();
+    void (*pend_sv)();
+    void (*systick)();
+    void (*usart1)();
+};
+
+VTable& VTableRam ();
+
+// reads stdin, the RX interrupt is raised when there is input, see host.cpp
+template< typename TX, typename RX, int N =100 >
+struct UartBufDev {
+    struct base {
+        static void putc (int c) { hostPutc(c); }
+    };
+    static void init () { VTableRam().usart1 = []() {}; }
+    static void baud (uint32_t, uint32_t) {}
+    static void putc (int c) { hostPutc(c); }
+    static int getc () { return hostGetc(); }
+    static bool readable () { return hostReadable(); }
+    static bool writable () { return true; }
+};
+
+struct DWT {
+    static void start () { MMIO32(0xE0001000) |= 1; }
+    static void stop () {}
+    static uint32_t count () { return MMIO32(0xE0001004); }
+};
+
+// internal flash, mapped into host memory at the same addresses, see host.cpp
+struct Flash {
+    static void erasePage (void const* addr);
+    static void write8 (void const* addr, uint8_t val);
+    static void write16 (void const* addr, uint16_t val);
+    static void write32 (void const* addr, uint32_t val);
+    static void write32buf (void const* addr, uint32_t const* ptr, int len);
+    static void finish () {}
+};
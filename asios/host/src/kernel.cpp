@@ -0,0 +1,2 @@
+// the asios kernel, unchanged, with host hooks enabled through ASIOS_HOST
+#include "../../kernel/src/core/main.cpp"
@@ -0,0 +1,3 @@
+// system call stubs for tasks, jumping to hostSvc() instead of using "svc"
+#define DEFINE_SYSCALLS
+#include "syslib.h"
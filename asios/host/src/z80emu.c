@@ -0,0 +1,2 @@
+// the Z80 emulator, used by the CP/M demo image, see demo.c
+#include "../../kernel/src/demo/z80emu.c"
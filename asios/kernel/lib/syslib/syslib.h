@@ -10,7 +10,6 @@ enum {
     SYSCALL_ipcSend,
     SYSCALL_ipcCall,
     SYSCALL_ipcRecv,
-    //SYSCALL_ipcPass,
     SYSCALL_noop,
     SYSCALL_demo,
     SYSCALL_texit,
@@ -22,14 +21,63 @@ enum {
     SYSCALL_tfork,
     SYSCALL_twait,
     SYSCALL_yield,
+    SYSCALL_ipcCallTimeout,
+    SYSCALL_ipcRecvTimeout,
+    SYSCALL_trace,
+    SYSCALL_submit,
+    SYSCALL_ipcNotify,
+    SYSCALL_ipcPass,
+    SYSCALL_ipcFetch,
+    SYSCALL_ipcStore,
     SYSCALL_MAX
 };
 
 typedef int Message [8];
 
+// a memory window which is passed along with an ipcPass call, the receiving
+// task can then access it through ipcFetch and ipcStore until it replies
+typedef struct { void* base; int len; int rights; } Grant;
+
+enum { GRANT_READ = 1, GRANT_WRITE = 2 };
+
+// ioctl requests for the console: bytes available, and a one-shot request to
+// be notified (see ipcNotify) once there is input, i.e. a select-like wait
+enum { IOCTL_FIONREAD, IOCTL_NOTIFY };
+
+// batched system calls: requests are queued in the task's own memory, and are
+// processed by task #0 in one go, before the task's next request which reaches
+// task #0, or when it calls submit, see bwrite below - note that the ipc*
+// calls and yield are handled by the kernel itself, and don't flush the batch,
+// so call submit first if queued output has to appear before one of those
+// the batch has to be registered first, by calling submit once on it
+enum { BATCH_SIZE = 8, BATCH_DATA = 248 };
+
+typedef struct {
+    int req, args [3], result;
+} BatchEntry;
+
+typedef struct {
+    unsigned char count;    // entries queued by the task
+    unsigned char done;     // entries completed in last batch, i.e. results
+    unsigned short fill;    // bytes used in data
+    BatchEntry q [BATCH_SIZE];
+    unsigned char data [BATCH_DATA]; // copies of queued data, e.g. writes
+} SysBatch;
+
 // helper to define system call stubs (up to 4 typed args, returning int)
 #ifndef DEFINE_SYSCALLS
 #define SYSCALL_STUB(name, args) extern int name args;
+#elif defined(ASIOS_HOST)
+// on the host simulator, the request code is passed as 5th arg to hostSvc()
+#if defined(__x86_64__)
+#define SYSCALL_STUB(name, args) \
+    __attribute__((naked)) int name args \
+    { asm volatile ("movl %0, %%r8d; jmp hostSvc" :: "i" (SYSCALL_ ## name)); }
+#else // aarch64
+#define SYSCALL_STUB(name, args) \
+    __attribute__((naked)) int name args \
+    { asm volatile ("mov w4, %0; b hostSvc" :: "i" (SYSCALL_ ## name)); }
+#endif
 #else
 // TODO find a way to inline asm code, "svc #n" is shorter & faster than a call
 // the problem is that gcc fails to set up the arg regs when inlining is forced
@@ -44,12 +92,20 @@ typedef int Message [8];
 SYSCALL_STUB(ipcSend, (int dst, Message* msg))
 SYSCALL_STUB(ipcCall, (int dst, Message* msg))
 SYSCALL_STUB(ipcRecv, (Message* msg))
-//SYSCALL_STUB(ipcPass, (int dst, Message* msg))
+SYSCALL_STUB(ipcPass, (int dst, Message* msg, Grant const* grant))
+SYSCALL_STUB(ipcFetch, (int src, int pos, void* ptr, int len))
+SYSCALL_STUB(ipcStore, (int src, int pos, void const* ptr, int len))
+SYSCALL_STUB(ipcCallTimeout, (int dst, Message* msg, int ms))
+// a zero timeout only polls, i.e. fails with -1 right away if nothing is queued
+SYSCALL_STUB(ipcRecvTimeout, (Message* msg, int ms))
+// makes the receive of dst return -2, right away or when it next listens
+SYSCALL_STUB(ipcNotify, (int dst))
 
 // tests, trials, and other loose ends
 SYSCALL_STUB(noop, (void))
 SYSCALL_STUB(demo, (int a, int b, int c, int d))
 SYSCALL_STUB(gpio, (int gpioPin, int gpioCmd))
+SYSCALL_STUB(trace, (void))
 
 // device I/O
 SYSCALL_STUB(write, (int fd, void const* ptr, int len))
@@ -63,6 +119,33 @@ SYSCALL_STUB(twait, (int id))
 SYSCALL_STUB(texit, (int e))
 SYSCALL_STUB(yield, (int ms))
 
+// batching, the kernel only supports writes for now
+SYSCALL_STUB(submit, (SysBatch* batch))
+
+// queue a write, consecutive ones to the same fd are coalesced into one entry
+// the data is copied, so the caller can re-use its buffer right away
+static inline int bwrite (SysBatch* b, int fd, void const* ptr, int len) {
+    if (len > BATCH_DATA - b->fill) {
+        submit(b);
+        if (len > BATCH_DATA)
+            return write(fd, ptr, len);
+    }
+    BatchEntry* e = b->count > 0 ? b->q + b->count - 1 : 0;
+    if (e == 0 || e->req != SYSCALL_write || e->args[0] != fd) {
+        if (b->count >= BATCH_SIZE)
+            submit(b);
+        e = b->q + b->count++;
+        e->req = SYSCALL_write;
+        e->args[0] = fd;
+        e->args[1] = b->fill; // offset in data
+        e->args[2] = 0;
+    }
+    for (int i = 0; i < len; ++i)
+        b->data[b->fill++] = ((unsigned char const*) ptr)[i];
+    e->args[2] += len;
+    return len;
+}
+
 #ifdef __cplusplus
 }
 #endif
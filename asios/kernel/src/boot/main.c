@@ -1,3 +1,4 @@
+#include <stdint.h>
 #include "syslib.h"
 
 int main () {
@@ -7,7 +8,8 @@ int main () {
 
     // fork a new task, also in flash memory, for some additional experiments
     int* task = (int*) 0x08008000;
-    int tid = tfork((void*) task[0], (void (*)(void*)) task[1], 0);
+    int tid = tfork((void*) (uintptr_t) task[0],
+                    (void (*)(void*)) (uintptr_t) task[1], 0);
 
 #if 1
     // test the "yield(ms)" timer
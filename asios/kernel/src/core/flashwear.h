@@ -74,7 +74,7 @@ class FlashWear {
             //if (remain <= 30) // TODO needs more logic to migrate remaining
             if (remain == 0) {
                 // changes have been merged back, now clean up the mods page
-                Flash::erasePage(&mods);
+                Flash::erasePage(mods);
                 for (int i = 0; i < SEGSUSED; ++i)
                     Flash::write8(mods->phys + i, newPhys[i]);
                 fill = remain; // TODO will always be zero for now
@@ -128,13 +128,12 @@ public:
                     sizeof (FlashWear), sizeof (ModPage), sizeof (Segment));
         if (erase || !valid()) {
             printf("initialising internal flash\n");
-            Flash::erasePage(&mods);
+            Flash::erasePage(mods);
             for (int i = 0; i < SEGSUSED; ++i)
                 Flash::write8(mods->phys + i, i+2);
         }
-        for (fill = NUM_MODS; mods->map[fill-1] == 0xFFFF; --fill)
-            if (fill == 0)
-                break;
+        for (fill = NUM_MODS; fill > 0 && mods->map[fill-1] == 0xFFFF; --fill)
+            ;
         if (DEBUG) {
             printf("fill %d, phys:", fill);
             for (int i = 0; i < SEGSUSED; ++i)
@@ -170,6 +169,9 @@ public:
         Flash::write16(mods->map + n, pos);
         Flash::write32buf(mods->sectors[n], (uint32_t const*) buf, SECLEN/4);
     }
+
+    // nothing is buffered, each write goes straight to flash
+    static void flush () {}
 };
 
 FlashWear::ModPage const* FlashWear::mods;
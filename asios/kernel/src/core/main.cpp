@@ -3,9 +3,6 @@
 
 #include "syslib.h"
 
-#include "flashwear.h" // TODO this probably shouldn't be in the kernel
-FlashWear disk;
-
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // Console device and exception handler debugging.
 
@@ -27,9 +24,14 @@ void kputs (char const* msg) {
 // give up, but not before trying to send a final message to the console port
 void panic (char const* msg) {
     for (int i = 0; i < 10000000; ++i) asm (""); // give uart time to settle
+#ifdef ASIOS_HOST
+    kputs("\n*** panic: "); kputs(msg); kputs(" ***\n");
+    hostExit(1);
+#else
     asm volatile ("cpsid if"); // disable interrupts and faults
     kputs("\n*** panic: "); kputs(msg); kputs(" ***\n");
     while (true) {} // hang
+#endif
 }
 
 // set up and enable the main fault handlers
@@ -41,6 +43,11 @@ void setupFaultHandlers () {
     MMIO32(0xE000ED24) |= 0b111<<16; // SCB->SHCSR |= (USG|BUS|MEM)FAULTENA
 }
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Kernel event tracing, off unless built with "-DTRACE=1", see trace.h.
+
+#include "trace.h"
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // General-purpose code.
 
@@ -58,27 +65,42 @@ T grab (T& x) {
 
 // Note: currently, R4 to R11 are saved on the stack, but they could also be
 // stored in the task object, reducing PSP stack usage by 32 bytes. Not sure
-// which is better, and there's still the FPU regs to deal with (128 bytes!).
-constexpr int PSP_EXTRA = 8; // R4 to R11
+// which is better. The FPU regs are only saved for tasks which use the FPU:
+// with lazy stacking enabled, the hardware reserves room for S0 to S15 and
+// FPSCR in an extended frame, but only stores them when needed, and PendSV
+// only saves S16 to S31 when the EXC_RETURN value says the task used the FPU.
+constexpr int PSP_EXTRA = 9;    // R4 to R11, plus the EXC_RETURN value
+constexpr int PSP_EXTRA_FP = 16; // S16 to S31, saved above R4 if FPU is used
 
 struct HardwareStackFrame {
     uint32_t r[4], r12, lr, pc, psr;
+    // in an extended frame, 18 words follow: S0 to S15, FPSCR, and a filler
 };
 
+constexpr uint32_t EXC_RETURN_NOFP = 0xFFFFFFFD; // thread mode, PSP, no FPU
+
 // use a struct to force these two variables next to each other in memory
 struct {
     uint32_t** curr; // current task pointer, MUST be first
     uint32_t** next; // next task to schedule, MUST be second
 } pspSw;
 
-// context switcher, includes updating MPU maps, no floating point support
+#ifdef ASIOS_HOST
+#include "host-switch.h" // fibers instead of PendSV, see asios/host/
+#else
+
+// context switcher, includes updating MPU maps and lazy FPU state saving
 // this doesn't need to know about tasks, just a pointer to its first 2 fields
-void PendSV_Handler () {
-    //DWT::start();
+// it's naked, since it returns with the EXC_RETURN value of the next task in
+// LR, which a compiler-generated prologue and epilogue could otherwise undo
+__attribute__((naked)) void PendSV_Handler () {
     asm volatile ("\
         // save current context \n\
         mrs    r0, psp      // get current process stack pointer value \n\
-        stmdb  r0!,{r4-r11} // push R4 to R11 to task stack (8 regs) \n\
+        tst    lr, #0x10    // EXC_RETURN bit 4 is 0 if the FPU was used \n\
+        it     eq \n\
+        vstmdbeq r0!,{s16-s31} // push S16 to S31 to task stack (16 regs) \n\
+        stmdb  r0!,{r4-r11,lr} // push R4 to R11 and EXC_RETURN (9 regs) \n\
         ldr    r1,=pspSw \n\
         ldr    r2,[r1]      // get current task ptr \n\
         str    r0,[r2]      // save PSP value into current task \n\
@@ -91,10 +113,14 @@ void PendSV_Handler () {
         ldr    r1,=0xE000ED9C // load address of first MPU RBAR reg \n\
         stm    r1,{r2-r5}   // store 2 new maps in MPU regs (4 regs) \n\
         // TODO dsb+isb // DAI 0321A p.39: add for M7, not M4 (see p.46) \n\
-        ldmia  r0!,{r4-r11} // pop R4 to R11 from task stack (8 regs) \n\
+        ldmia  r0!,{r4-r11,lr} // pop R4 to R11 and EXC_RETURN (9 regs) \n\
+        tst    lr, #0x10    // did this task use the FPU? \n\
+        it     eq \n\
+        vldmiaeq r0!,{s16-s31} // pop S16 to S31 from task stack (16 regs) \n\
         msr    psp, r0      // set PSP to next task \n\
+        bx     lr           // return, using the next task's EXC_RETURN \n\
+        .ltorg              // literal pool for the ldr's above \n\
     ");
-    //DWT::stop();
 }
 
 void startTasks (void* firstTask) {
@@ -127,6 +153,8 @@ void changeTask (void* next) {
         MMIO32(0xE000ED04) |= 1<<28; // SCB->ICSR |= PENDSVSET
 }
 
+#endif // ASIOS_HOST
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // Tasks and task management with message-based IPC.
 
@@ -136,19 +164,35 @@ class Task {
     uint32_t* pspSaved; // MUST be first in task objects, see PendSV_Handler
     uint32_t* mpuMaps;  // MUST be second in task objects, see PendSV_Handler
     Message* message;   // set while recv or reply can take a new message
-    // these task ptrs could be made indices, freeing 12b of 16b if <256 tasks
     Task* blocking;     // set while waiting, to task we're queued on, or self
-    Task* incoming;     // tasks waiting for their call to be accepted
-    Task* inProgress;   // tasks waiting for their call to be completed
-    Task* next;         // used in waiting tasks, i.e. when on some linked list
+    Task* next;         // used in runnable tasks, to link its ready queue
+
+    // wait queues are doubly-linked through task indices plus one, so that
+    // zero means "none", and appending or removing a task is always O(1)
+    struct Queue { uint8_t head, tail; };
+
+    Queue incoming;     // tasks waiting for their call to be accepted
+    Queue inProgress;   // tasks waiting for their call to be completed
+    uint8_t waitNext;   // links to neighbours while on one of those queues
+    uint8_t waitPrev;
+    uint8_t queued;     // which queue of the blocking task we're on, if any
 public:
     enum { Early, App, Server, Driver }; // type of task
 
+    // default priority for each type of task, higher values run first
+    enum { PRIO_APP = 8, PRIO_SERVER = 16, PRIO_DRIVER = 24, PRIO_SYSTEM = 31 };
+
     uint8_t type :2;    // set once the first SVC call is made
+    uint8_t prio :5;    // scheduling priority, 0..31
     uint8_t request;    // request number of current system call
-    uint8_t spare[2];   // pad the total task size to 32 bytes
+    uint8_t budget;     // ticks left in the current time slice
+    uint8_t timerNext;  // next task in the timer queue, see startTimer()
+    uint8_t readyPrev;  // previous task in its ready queue, see makeReady()
 
     static constexpr int MAX_TASKS = 25;
+    static constexpr int SLICE = 32; // time slice, in ticks
+    static constexpr uint8_t NONE = 0xFF; // end marker for the timer queue
+    static constexpr int NOTIFIED = -2; // receive result, see notify()
     static Task vec [MAX_TASKS];
 
     // find the next free task slot and initialise it
@@ -164,21 +208,105 @@ public:
     // return pointer to saved registers on this task's process stack
     uint32_t* regs () const {
         // careful: pspSaved is NOT valid for the active task
-        return pspSaved + PSP_EXTRA;
+        bool fp = (pspSaved[PSP_EXTRA-1] & 0x10) == 0; // saved EXC_RETURN
+        return pspSaved + PSP_EXTRA + (fp ? PSP_EXTRA_FP : 0);
+    }
+
+    // the highest-priority runnable task, or null if there are none
+    // there is one ready queue per priority level, and a bitmap of non-empty
+    // queues, so this doesn't depend on the number of tasks in any way
+    static Task* best () {
+        if (readyMask == 0)
+            return 0;
+        int level = 31 - __builtin_clz(readyMask);
+        return readyTail[level]->next; // the head, since queues are circular
+    }
+
+    // switch to the best runnable task, if it's not the current one already
+    static void reschedule () {
+        Task* tp = best();
+        if (tp != 0)
+            switchTo(tp);
+    }
+
+    // charge one tick to the current task, and move it to the end of its
+    // ready queue when its time slice is used up, i.e. round-robin per level
+    static void tick () {
+        Task& t = current();
+        ++cpuTicks[t.index()];
+        if (--t.budget == 0) {
+            t.budget = SLICE;
+            if (t.next != 0 && readyTail[t.prio]->next == &t)
+                readyTail[t.prio] = &t; // the head becomes the new tail
+        }
+    }
+
+    // wake up this task after a number of ticks, or a little later if some
+    // other wakeup is already due within the slack time, so that the two will
+    // be handled in the same tick (the slack is 1/8th of the requested delay)
+    // the queue is sorted by wakeup time, so only its head needs to be checked
+    void startTimer (uint32_t delay) {
+        stopTimer();
+        uint32_t when = ticks + delay, slack = delay >> 3;
+        uint8_t* pp = &timerHead;
+        while (*pp != NONE && (int) (timerAt[*pp] - when) < 0)
+            pp = &vec[*pp].timerNext;
+        if (*pp != NONE && timerAt[*pp] - when <= slack) {
+            when = timerAt[*pp]; // coalesce, i.e. queue up after all of these
+            while (*pp != NONE && timerAt[*pp] == when)
+                pp = &vec[*pp].timerNext;
+        }
+        timerAt[index()] = when;
+        timerNext = *pp;
+        *pp = index();
+        timing |= 1 << index();
+    }
+
+    // cancel the timer of this task, if there is one
+    void stopTimer () {
+        if ((timing & (1 << index())) == 0)
+            return;
+        uint8_t* pp = &timerHead;
+        while (*pp != index())
+            pp = &vec[*pp].timerNext;
+        *pp = timerNext;
+        timing &= ~(1 << index());
+    }
+
+    // resume all tasks whose timer has expired, when none have, this is O(1)
+    static void expireTimers (uint32_t now) {
+        while (timerHead != NONE && (int) (timerAt[timerHead] - now) <= 0) {
+            Task& t = vec[timerHead];
+            timerHead = t.timerNext;
+            timing &= ~(1 << t.index());
+            traceEvent(TR_TIMEOUT, t.index());
+            t.timeout();
+        }
     }
 
-    // find the next runnable task to switch to, might be same as current one
-    static Task* nextRunnable () {
-        Task* tp = &current();
-        do
-            if (++tp - vec >= MAX_TASKS)
-                tp = vec;
-        while (tp->state() < Runnable);
-        return tp;
+    // ticks until the first timer expires, or -1 if there are no timers
+    static int nextTimer (uint32_t now) {
+        return timerHead == NONE ? -1 : timerAt[timerHead] - now;
+    }
+
+    // change the priority, also moves the task to another queue if runnable
+    void setPriority (int level) {
+        bool queued = next != 0;
+        unready();
+        prio = level;
+        if (queued)
+            makeReady();
     }
 
     // try to deliver a message to this task
     int deliver (Task& from, Message* msg) {
+        int e = tryDeliver(from, msg);
+        traceEvent(TR_DELIVER, from.index(), index(), e == 0);
+        return e;
+    }
+
+    // the actual delivery, returns 0 if the message was accepted
+    int tryDeliver (Task& from, Message* msg) {
         //printf("S: deliver %08x %d => %d req %d\n",
         //    msg, from.index(), index(), from.request);
         if (blocking && blocking != this) // am I waiting for a reply?
@@ -192,46 +320,84 @@ public:
         if (buf != (Message*) regs()) { // if it was a receive, not syscall
             memcpy(buf, msg, sizeof *msg);  // copy message to destination
             *regs() = from.index();  // return sender's task id
-        }
+        } else
+            *regs() = (*msg)[0]; // the reply to a system call is only r0
         resume();
         return 0; // successful delivery
     }
 
+    // attach a grant to the current call, it stays valid until the reply
+    void setGrant (Grant const& g) {
+        grants[index()] = g;
+    }
+
+    // copy from or to the grant of a caller whose request is currently being
+    // handled by this task, this is a "safe copy" as in Minix 3: the kernel
+    // checks the rights and bounds, then does a single copy between the tasks
+    int copyGrant (int src, int pos, void* ptr, int len, int rights) {
+        if ((unsigned) src >= MAX_TASKS)
+            return -1;
+        Grant& g = grants[src];
+        if (vec[src].waitQueue() != &inProgress || (g.rights & rights) == 0 ||
+                pos < 0 || len < 0 || pos + len > g.len)
+            return -1;
+        uint8_t* p = (uint8_t*) g.base + pos;
+        if (rights & GRANT_WRITE)
+            memcpy(p, ptr, len);
+        else
+            memcpy(ptr, p, len);
+        return len;
+    }
+
     // deal with an incoming message which expects a reply
     int replyTo (Message* msg) {
         Task& from = current();
+        traceEvent(TR_CALL, from.index(), index());
         //printf("S:   reply %08x %d => %d req %d\n",
         //    msg, from.index(), index(), from.request);
         int e = deliver(from, msg);
+        from.suspend(this, msg); // also takes the task off its ready queue
         // either try delivery again later, or wait for reply
         from.appendTo(e < 0 ? incoming : inProgress);
-        from.suspend(this, msg);
         return -1; // will be adjusted before resuming
     }
 
     // listen for incoming messages, block each sender while handling calls
     int listen (Message* msg) {
         //printf("S:  listen %08x   at %d\n", msg, index());
-        if (incoming == 0) {
+        if (incoming.head == 0) {
+            if (notified & (1 << index())) { // messages go first
+                notified &= ~(1 << index());
+                return NOTIFIED;
+            }
             suspend(this, msg);
             return -1; // will be adjusted before resuming
         }
-        Task& from = *incoming;
+        Task& from = *at(incoming.head);
         //printf("S:     got %08x %d => %d req %d\n",
         //    from.message, from.index(), index(), from.request);
-        incoming = grab(incoming->next);
+        from.removeFrom(incoming);
         from.appendTo(inProgress);
+        traceEvent(TR_ACCEPT, index(), from.index());
         memcpy(msg, from.message, sizeof *msg); // copy msg to this task
         return from.index();
     }
 
+    // same as listen, but never blocks: fails with -1 if nothing is queued
+    int poll (Message* msg) {
+        if (incoming.head == 0 && (notified & (1 << index())) == 0)
+            return -1;
+        return listen(msg);
+    }
+
     // forward current call to this destination
     bool forward (Task& from, Message* msg) {
         bool found = from.removeFrom(current().inProgress);
         //printf("S: forward %08x %d => %d req %d found %d\n",
         //    msg, from.index(), index(), from.request, found);
         if (found) {
-            from.blocking = 0; // TODO figure this out, also request = 0 ?
+            traceEvent(TR_FORWARD, from.index(), index());
+            from.blocking = this; // now waiting on the new destination
             memcpy(from.message, msg, sizeof *msg); // copy req back to sender
             int e = deliver(from, from.message); // re-deliver
             from.appendTo(e < 0 ? incoming : inProgress);
@@ -239,6 +405,23 @@ public:
         return found;
     }
 
+    // suspend the current task, without accepting any messages
+    void sleep () {
+        suspend(this, 0);
+    }
+
+    // signal this task without a message: if it's waiting in a receive, that
+    // receive ends with NOTIFIED, else the next receive will return right away
+    // this can also be called from interrupt handlers, see consoleDriver()
+    void notify () {
+        if (blocking == this && message != 0) { // waiting for a message
+            message = 0;
+            regs()[0] = NOTIFIED;
+            resume();
+        } else
+            notified |= 1 << index();
+    }
+
     // change this task from waiting on another task to suspended
     Message* detach () {
         if (!removeFrom(blocking->inProgress))
@@ -247,21 +430,46 @@ public:
         return grab(message); // return the message buffer and clear it
     }
 
-    // unblock all tasks which are in yield() and have expired
-    static uint32_t resumeAllExpired (uint32_t now) {
-        int wakeup = 1<<30; // a really big value: over 12 days in milliseconds
-        for (int i = 0; i < Task::MAX_TASKS; ++i)
-            Task::vec[i].checkTimeout(now, &wakeup);
-        return now + wakeup; // new best next yield expiration time
-    }
-
     // dump all tasks in use, using console & printf
     static void dumpAll () {
+        printf("  ready mask %08x timers %08x\n", readyMask, timing);
         for (int i = 0; i < MAX_TASKS; ++i)
             Task::vec[i].dump();
     }
 
+    void init (void* top, void (*proc)(void*), void* arg) {
+        // use the C++11 compiler to verify some design choices
+        static_assert(sizeof (Message) == 32); // fixed/known msg buffer size
+#ifndef ASIOS_HOST // 64-bit pointers make tasks bigger, but that's ok there
+        static_assert((sizeof *this & (sizeof *this - 1)) == 0); // power of 2
+#endif
+        static_assert(MAX_TASKS < 255); // wait queues use 8-bit links
+
+        HardwareStackFrame* psp = (HardwareStackFrame*) top - 1;
+        psp->r[0] = (uintptr_t) arg;
+        psp->lr = (uintptr_t) texit;
+        psp->pc = (uintptr_t) proc;
+        psp->psr = 0x01000000;
+        pspSaved = (uint32_t*) psp - PSP_EXTRA;
+        pspSaved[PSP_EXTRA-1] = EXC_RETURN_NOFP; // the FPU hasn't been used
+        static const uint32_t dummyMaps [4] = {}; // two disabled regions
+        mpuMaps = (uint32_t*) dummyMaps;
+
+        prio = this == vec ? PRIO_SYSTEM : PRIO_APP; // raised later if needed
+        budget = SLICE;
+        makeReady();
+    }
+
 private:
+    static uint32_t readyMask;      // bit N is set if ready queue N has tasks
+    static Task* readyTail [32];    // tail of each circular ready queue
+    static uint32_t cpuTicks [MAX_TASKS]; // ticks used by each task, for dumps
+    static uint8_t timerHead;       // first task in the timer queue, or NONE
+    static uint32_t timing;         // bit N is set if task N is in that queue
+    static uint32_t timerAt [MAX_TASKS]; // wakeup time of each queued task
+    static Grant grants [MAX_TASKS];     // memory passed along with a call
+    static uint32_t notified;       // bit N is set if task N has a notification
+
     static Task& current () { return *(Task*) pspSw.curr; }
 
     uint32_t index () const { return this - vec; }
@@ -276,88 +484,144 @@ private:
                                Active;      // currently running
     }
 
-    void init (void* top, void (*proc)(void*), void* arg) {
-        // use the C++11 compiler to verify some design choices
-        static_assert(sizeof (Message) == 32); // fixed/known msg buffer size
-        static_assert((sizeof *this & (sizeof *this - 1)) == 0); // power of 2
-
-        HardwareStackFrame* psp = (HardwareStackFrame*) top - 1;
-        psp->r[0] = (uint32_t) arg;
-        psp->lr = (uint32_t) texit;
-        psp->pc = (uint32_t) proc;
-        psp->psr = 0x01000000;
-        pspSaved = (uint32_t*) psp - PSP_EXTRA;
-        static const uint32_t dummyMaps [4] = {}; // two disabled regions
-        mpuMaps = (uint32_t*) dummyMaps;
-    }
-
     void suspend (Task* reason, Message* msg) {
         if (pspSw.curr != &pspSaved) // could be supported, but no need so far
             printf(">>> SUSPEND? %08x != curr %08x\n", this, pspSw.curr);
 
-        void* next = nextRunnable();
-        if (next == pspSw.curr)
+        unready();
+        Task* tp = best();
+        if (tp == 0)
             panic("no runnable tasks left");
-        changeTask(next); // will trigger PendSV tail-chaining
+        switchTo(tp); // will trigger PendSV tail-chaining
 
         blocking = reason;
         message = msg;
     }
 
+    // request a context switch, also records it when tracing
+    static void switchTo (Task* tp) {
+        if (tp != &current() && tp != (Task*) pspSw.next)
+            traceEvent(TR_SWITCH, current().index(), tp->index());
+        changeTask(tp);
+    }
+
     // make a suspended or waiting task runnable again
     void resume () {
+        stopTimer(); // in case it was a receive or call with a timeout
+        grants[index()].rights = 0; // a reply ends access to the grant
         request = 0;
         blocking = 0; // then allow it to run again
+        makeReady();
     }
 
-    // append this task to the end of a list
-    void appendTo (Task*& list) {
-        if (next)
+    // append this task to the ready queue for its priority level
+    // the queues are also linked backwards, through task indices, so that
+    // any task can be taken off its queue in O(1), see unready()
+    void makeReady () {
+        if (next != 0)
+            return; // already queued
+        Task*& tail = readyTail[prio];
+        if (tail == 0) {
+            next = this; // a queue with just one task points to itself
+            readyPrev = index();
+            readyMask |= 1 << prio;
+        } else {
+            next = tail->next;
+            readyPrev = tail->index();
+            next->readyPrev = index();
+            tail->next = this;
+        }
+        tail = this;
+    }
+
+    // take this task off its ready queue, wherever it is in that queue
+    void unready () {
+        if (next == 0)
+            return; // not queued
+        Task*& tail = readyTail[prio];
+        Task* prev = vec + readyPrev;
+        prev->next = next;
+        next->readyPrev = readyPrev;
+        if (tail == this)
+            tail = prev != this ? prev : 0;
+        if (tail == 0)
+            readyMask &= ~(1 << prio);
+        next = 0;
+    }
+
+    static Task* at (uint8_t link) { return link ? vec + link - 1 : 0; }
+
+    uint8_t link () const { return index() + 1; }
+
+    // the queue this task is on, which is always one of the blocking task's
+    Queue* waitQueue () const {
+        return queued == 0 ? 0 :
+               queued == 1 ? &blocking->incoming : &blocking->inProgress;
+    }
+
+    // append this task to the end of a queue of the task it's blocking on
+    void appendTo (Queue& q) {
+        if (queued)
             panic("item already in list");
-        while (list)
-            list = list->next;
-        list = this;
-    }
-
-    // remove this task from a list
-    bool removeFrom (Task*& list) {
-        while (list != this)
-            if (list)
-                list = list->next;
-            else
-                return false;
-        list = grab(next);
+        waitNext = 0;
+        waitPrev = q.tail;
+        if (q.tail)
+            at(q.tail)->waitNext = link();
+        else
+            q.head = link();
+        q.tail = link();
+        queued = &q == &blocking->incoming ? 1 : 2;
+    }
+
+    // remove this task from a queue, fails if it's not on that one
+    bool removeFrom (Queue& q) {
+        if (waitQueue() != &q)
+            return false;
+        if (waitPrev)
+            at(waitPrev)->waitNext = waitNext;
+        else
+            q.head = waitNext;
+        if (waitNext)
+            at(waitNext)->waitPrev = waitPrev;
+        else
+            q.tail = waitPrev;
+        queued = 0;
         return true;
     }
 
-    // unblock task if in yield() and it has expired
-    void checkTimeout (uint32_t now, int* wakeup) {
-        // true when this task is suspended while in a yield system call
-        // this is one of the few places where the kernel knows about req codes
-        if (request == SYSCALL_yield && blocking == this) {
-            // never the current active task, for which blocking == 0
-            uint32_t timeout = regs()[1]; // i.e. the unused arg trick
-            int msToGo = timeout - now;
-            if (msToGo <= 0)
-                resume(); // this yield timer has expired
-            else if (msToGo < *wakeup)
-                *wakeup = msToGo; // this is the best next wakeup time so far
+    // the timer has expired: end the yield, or fail the receive or call
+    void timeout () {
+        if (message != 0) { // still waiting for a message or a reply
+            if (queued)
+                removeFrom(*waitQueue());
+            message = 0;
+            regs()[0] = -1; // the result of ipcRecvTimeout or ipcCallTimeout
         }
+        resume();
     }
 
     // a crude task dump for basic debugging, using console & printf
     void dump () const {
         if (pspSaved) {
-            printf("  [%03x] %2d: %c%c sp %08x", (uint32_t) this & 0xFFF,
-                    this - vec, " *<~"[type], "USWRA"[state()], pspSaved);
-            printf(" blk %2d pq %08x fq %08x buf %08x req %d\n",
+            printf("  [%03x] %2d: %c%c p%-2d sp %08x", (uintptr_t) this & 0xFFF,
+                    this - vec, " *<~"[type], "USWRA"[state()], prio, pspSaved);
+            printf(" blk %2d pq %2d fq %2d buf %08x req %d cpu %d\n",
                     blocking == 0 ? -1 : blocking->index(),
-                    incoming, inProgress, message, request);
+                    incoming.head - 1, inProgress.head - 1, message, request,
+                    cpuTicks[index()]);
         }
     }
 };
 
 Task Task::vec [];
+uint32_t Task::readyMask;
+Task* Task::readyTail [];
+uint32_t Task::cpuTicks [];
+uint8_t Task::timerHead = Task::NONE;
+uint32_t Task::timing;
+uint32_t Task::timerAt [];
+Grant Task::grants [];
+uint32_t Task::notified;
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // The kernel code above needs to know almost nothing about everything below.
@@ -371,23 +635,45 @@ Task Task::vec [];
 // This is ok, as context switches only happen in PendSV, i.e. outside SVCs.
 
 void SVC_Handler () {
+#ifdef ASIOS_HOST
+    HardwareStackFrame* sfp = (HardwareStackFrame*) hostPsp;
+    uint8_t req = hostRequest;
+#else
     HardwareStackFrame* sfp;
     asm volatile ("mrs %0, psp" : "=r" (sfp));
     uint8_t req = ((uint8_t*) (sfp->pc))[-2];
+#endif
 #if 0
     printf("< svc.%d psp %08x r0.%d lr %08x pc %08x psr %08x >\n",
             req, sfp, sfp->r[0], sfp->lr, sfp->pc, sfp->psr);
 #endif
     Task& t = *(Task*) pspSw.curr;
+    traceEvent(TR_SVC, &t - Task::vec, req);
 
     // fully-automated task categorisation: the first SVC request made by a
     // task will configure its type, and therefore its system permissions
+    // servers get a higher priority, so that they will preempt apps as soon as
+    // a message arrives for them, but making a call says nothing about how
+    // urgent a task is: drivers get their priority when created, see below
     if (t.type == Task::Early)
         switch (req) {
-            case SYSCALL_ipcSend:                        break; // no change
-            case SYSCALL_ipcCall: t.type = Task::Driver; break;
-            case SYSCALL_ipcRecv: t.type = Task::Server; break;
-            default:              t.type = Task::App;    break;
+            case SYSCALL_ipcSend:
+            case SYSCALL_ipcNotify:
+                break; // no change
+            case SYSCALL_ipcCall:
+            case SYSCALL_ipcCallTimeout:
+            case SYSCALL_ipcPass:
+                t.type = Task::Driver;
+                break;
+            case SYSCALL_ipcRecv:
+            case SYSCALL_ipcRecvTimeout:
+                t.type = Task::Server;
+                if (&t != Task::vec) // the system task is already the highest
+                    t.setPriority(Task::PRIO_SERVER);
+                break;
+            default:
+                t.type = Task::App;
+                break;
         }
 
     // there's no need to enforce these permissions right now, that can be
@@ -397,7 +683,7 @@ void SVC_Handler () {
         // non-blocking message send, behaves as atomic test-and-set
         case SYSCALL_ipcSend: {
             int dst = sfp->r[0];
-            Message* msg = (Message*) sfp->r[1];
+            Message* msg = (Message*) (uintptr_t) sfp->r[1];
             // ... validate dst and msg
             sfp->r[0] = Task::vec[dst].deliver(t, msg);
             break;
@@ -406,7 +692,7 @@ void SVC_Handler () {
         // blocking send + receive, used for request/reply sequences
         case SYSCALL_ipcCall: {
             int dst = sfp->r[0];
-            Message* msg = (Message*) sfp->r[1];
+            Message* msg = (Message*) (uintptr_t) sfp->r[1];
             // ... validate dst and msg
             sfp->r[0] = Task::vec[dst].replyTo(msg);
             break;
@@ -414,22 +700,98 @@ void SVC_Handler () {
 
         // blocking receive, used by drivers and servers
         case SYSCALL_ipcRecv: {
-            Message* msg = (Message*) sfp->r[0];
+            Message* msg = (Message*) (uintptr_t) sfp->r[0];
+            // ... validate msg
+            sfp->r[0] = t.listen(msg);
+            break;
+        }
+
+        // same as ipcCall, but fails with -1 if no reply arrives in time
+        case SYSCALL_ipcCallTimeout: {
+            int dst = sfp->r[0];
+            Message* msg = (Message*) (uintptr_t) sfp->r[1];
+            // ... validate dst and msg
+            sfp->r[0] = Task::vec[dst].replyTo(msg);
+            t.startTimer(sfp->r[2]);
+            break;
+        }
+
+        // same as ipcRecv, but fails with -1 if no message arrives in time
+        case SYSCALL_ipcRecvTimeout: {
+            Message* msg = (Message*) (uintptr_t) sfp->r[0];
             // ... validate msg
+            if (sfp->r[1] == 0) { // no waiting at all, just check the queue
+                sfp->r[0] = t.poll(msg);
+                break;
+            }
             sfp->r[0] = t.listen(msg);
+            if ((int) sfp->r[0] == -1) // not right away, wait a while
+                t.startTimer(sfp->r[1]);
             break;
         }
 
-        //case SYSCALL_ipcPass: do_ipcPass(sfp); break;
+        // signal a task without sending a message, never blocks
+        case SYSCALL_ipcNotify: {
+            int dst = sfp->r[0];
+            // ... validate dst
+            Task::vec[dst].notify();
+            sfp->r[0] = 0;
+            break;
+        }
+
+        // same as ipcCall, but with access to some memory for the receiver
+        case SYSCALL_ipcPass: {
+            int dst = sfp->r[0];
+            Message* msg = (Message*) (uintptr_t) sfp->r[1];
+            Grant const* grant = (Grant const*) (uintptr_t) sfp->r[2];
+            // ... validate dst, msg, and grant
+            t.setGrant(*grant); // copied, the caller's struct can be temporary
+            sfp->r[0] = Task::vec[dst].replyTo(msg);
+            break;
+        }
+
+        // copy data from a caller's grant to a buffer, returns count or -1
+        case SYSCALL_ipcFetch: {
+            int src = sfp->r[0], pos = sfp->r[1], len = sfp->r[3];
+            void* ptr = (void*) (uintptr_t) sfp->r[2];
+            // ... validate ptr
+            sfp->r[0] = t.copyGrant(src, pos, ptr, len, GRANT_READ);
+            break;
+        }
+
+        // copy data from a buffer to a caller's grant, returns count or -1
+        case SYSCALL_ipcStore: {
+            int src = sfp->r[0], pos = sfp->r[1], len = sfp->r[3];
+            void* ptr = (void*) (uintptr_t) sfp->r[2];
+            // ... validate ptr
+            sfp->r[0] = t.copyGrant(src, pos, ptr, len, GRANT_WRITE);
+            break;
+        }
+
+        // suspend the current task for a number of ms, handled right here
+        // (and not in task #0) since the timer queue is only used in handlers
+        case SYSCALL_yield: {
+            int ms = sfp->r[0];
+            sfp->r[0] = 0;
+            t.request = req;
+            t.sleep();
+            t.startTimer(ms);
+            break;
+        }
 
         // wrap everything else into an ipcCall to task #0
         default: {
-            Message* msg = (Message*) t.regs(); // not a real msg buffer
+            Message* msg = (Message*) sfp; // not a real msg buffer, i.e. regs()
             t.request = req; // save SVC number in task object
             (void) Task::vec[0].replyTo(msg); // XXX explain void
             break;
         }
     }
+
+    traceEvent(TR_SVCEND, &t - Task::vec, req, sfp->r[0]);
+
+    // a message may have made a higher-priority task runnable, switch to it
+    Task::reschedule();
 }
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -447,22 +809,300 @@ struct SysRoute {
 SysRoute routes [256]; // indexed by the SVC request code, i.e. 0..255
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// Task zero, the special system task. It's the only one started by main().
+// Batched system calls, see SysBatch in syslib.h. These are run by task #0
+// before any other request from the same task, i.e. while that task is blocked.
+
+SysBatch* batches [Task::MAX_TASKS]; // registered by each task's first submit
+
+int writeConsole (uint8_t const* ptr, int len) {
+    for (int i = 0; i < len; ++i)
+        console.putc(ptr[i]);
+    return len;
+}
+
+// process all queued requests, returns the number of completed entries
+int runBatch (SysBatch& b) {
+    int n = b.count;
+    for (int i = 0; i < n; ++i) {
+        BatchEntry& e = b.q[i];
+        e.result = -1;
+        switch (e.req) {
+            case SYSCALL_write: { // args: fd, offset in data, length
+                int pos = e.args[1], len = e.args[2];
+                // ... validate fd
+                if (pos >= 0 && len >= 0 && pos + len <= BATCH_DATA)
+                    e.result = writeConsole(b.data + pos, len);
+                break;
+            }
+        }
+    }
+    b.done = n;
+    b.count = 0;
+    b.fill = 0;
+    return n;
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Console driver task. It owns the UART receiver, and handles the read and
+// ioctl requests which task #0 forwards to it, so that task #0 never waits for
+// input. Readers are served in FIFO order, and stay blocked until input comes
+// in, which the RX interrupt signals with a notification.
+
+int consoleTask;
+void (*uartHandler)(); // JeeH's own UART interrupt handler
+
+void consoleDriver (void*) {
+    uint8_t readers [Task::MAX_TASKS]; // FIFO of tasks blocked in a read
+    int rdHead = 0, rdCount = 0;
+    uint8_t* rdPtr [Task::MAX_TASKS]; // buffer and size of each read
+    int rdLen [Task::MAX_TASKS];
+    uint32_t subscribers = 0; // tasks to notify once there is input
+
+    while (true) {
+        Message msg;
+        int src = ipcRecv(&msg); // returns NOTIFIED when input has arrived
+
+        if (src >= 0) {
+            // msg is a copy of the caller's args, i.e. r0..r3
+            switch (Task::vec[src].request) {
+                case SYSCALL_read: // args: fd, ptr, len
+                    // ... validate ptr and len
+                    rdPtr[src] = (uint8_t*) (uintptr_t) msg[1];
+                    rdLen[src] = msg[2];
+                    readers[(rdHead + rdCount++) % Task::MAX_TASKS] = src;
+                    break;
+
+                case SYSCALL_ioctl: { // args: fd, req, ptr
+                    int* ptr = (int*) (uintptr_t) msg[2];
+                    // ... validate ptr
+                    msg[0] = -1;
+                    switch (msg[1]) {
+                        case IOCTL_FIONREAD:
+                            *ptr = console.readable();
+                            msg[0] = 0;
+                            break;
+                        case IOCTL_NOTIFY:
+                            subscribers |= 1 << src;
+                            msg[0] = 0;
+                            break;
+                    }
+                    ipcSend(src, &msg);
+                    break;
+                }
+
+                default:
+                    msg[0] = -1;
+                    ipcSend(src, &msg);
+            }
+        }
+
+        // hand out input to the readers, each gets what's there, but at least 1
+        while (rdCount > 0 && console.readable()) {
+            int r = readers[rdHead];
+            rdHead = (rdHead + 1) % Task::MAX_TASKS;
+            --rdCount;
+
+            int n = 0;
+            while (n < rdLen[r] && console.readable())
+                rdPtr[r][n++] = console.getc();
+
+            Message reply;
+            reply[0] = n;
+            ipcSend(r, &reply);
+        }
+
+        // wake up all tasks waiting for input, they have to ask again
+        if (subscribers != 0 && console.readable()) {
+            for (int i = 0; i < Task::MAX_TASKS; ++i)
+                if (subscribers & (1 << i))
+                    ipcNotify(i);
+            subscribers = 0;
+        }
+    }
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Disk driver task. Task #0 forwards all diskio requests to it, so that disk
+// transfers no longer hold up every other system call. Each client has at most
+// one request queued, since it's blocked until the reply. These are served in
+// elevator order: the lowest position at or after where the last transfer
+// ended, and wrapping around once nothing is left beyond it (i.e. C-SCAN).
+// A request which continues exactly where the previous one ended, in the same
+// direction, is merged into the same run. The disk's buffer is flushed, and
+// the replies are sent, once a run is complete.
+//
+// The driver never touches its clients' memory: task #0 attaches a grant for
+// the request's buffer when forwarding it, and each sector is then copied in
+// or out with ipcFetch or ipcStore, which check the rights and bounds.
+//
+// Transfers are polled, so this task keeps the priority of an app: it gets
+// time-sliced with the other apps, instead of preempting them until it's done.
+// The limit is that next to CPU-bound apps, each request waits for their time
+// slices (32 ms each), and so do its clients, which are apps as well: raising
+// only the driver's priority doesn't help them. E.g. the diskio benchmark in
+// test_tasks.h (tasks 16 and 17) reports nothing for many seconds when run
+// together with the float tests (tasks 10 and 11).
+//
+// Requests of more than DISK_MAXCNT sectors, or whose buffer can't be reached
+// through the grant, fail with -1.
 
-volatile uint32_t nextWakeup;
+constexpr int DISK_MAXCNT = 64; // sectors per request, i.e. 8 KB
 
-//#define msWait yield
+#if DISK_SDCARD // build with "-DDISK_SDCARD=1" to use an SD card iso flash
+#include <jee/spi-sdcard.h>
+#include "sddisk.h"
+SdDisk< SpiHw< PinA<7>, PinA<6>, PinA<5>, PinA<4> > > disk;
+#else
+#include "flashwear.h"
+FlashWear disk;
+#endif
+
+int diskTask;
+
+void diskDriver (void*) {
+    disk.init();
+
+    uint32_t pending = 0; // bit N is set if task N has a request queued
+    uint32_t done = 0; // bit N is set if task N's request is done, not replied
+    uint32_t failed = 0; // bit N is set if task N's request needs a -1 reply
+    uint32_t rqPos [Task::MAX_TASKS]; // position, etc of each request
+    uint8_t rqCnt [Task::MAX_TASKS];
+    bool rqOut [Task::MAX_TASKS];
+    uint32_t at = 0; // the position where the last transfer ended
+    bool out = false; // the direction of the last transfer
+
+    while (true) {
+        // collect all requests, but only wait when there's nothing else to do
+        Message msg;
+        int src = pending | done ? ipcRecvTimeout(&msg, 0) : ipcRecv(&msg);
+
+        if (src >= 0) {
+            // msg is a copy of the caller's args, i.e. r0..r3
+            if (Task::vec[src].request == SYSCALL_diskio &&
+                    msg[3] > 0 && msg[3] <= DISK_MAXCNT) {
+                // args: rw, pos, buf, cnt - the buffer is only used via a grant
+                rqOut[src] = msg[0] != 0;
+                rqPos[src] = msg[1];
+                rqCnt[src] = msg[3];
+                pending |= 1 << src;
+            } else {
+                msg[0] = -1;
+                ipcSend(src, &msg);
+            }
+            continue; // until there are no more incoming requests
+        }
+
+        // the unsigned distance puts positions before the current one last
+        int next = -1;
+        for (int i = 0; i < Task::MAX_TASKS; ++i)
+            if ((pending & (1 << i)) &&
+                    (next < 0 || rqPos[i] - at < rqPos[next] - at))
+                next = i;
+
+        // end the current run if the next request doesn't continue it
+        if (next < 0 || rqPos[next] != at || rqOut[next] != out) {
+            disk.flush();
+            for (int i = 0; i < Task::MAX_TASKS; ++i)
+                if (done & (1 << i)) {
+                    Message reply;
+                    reply[0] = failed & (1 << i) ? -1 : 0;
+                    ipcSend(i, &reply);
+                }
+            done = failed = 0;
+            if (next < 0)
+                continue;
+        }
+
+        uint8_t buf [128];
+        out = rqOut[next];
+        at = rqPos[next];
+        for (int i = 0; i < rqCnt[next]; ++i) {
+            int n;
+            if (out) {
+                n = ipcFetch(next, i * sizeof buf, buf, sizeof buf);
+                if (n == sizeof buf)
+                    disk.writeSector(at, buf);
+            } else {
+                disk.readSector(at, buf);
+                n = ipcStore(next, i * sizeof buf, buf, sizeof buf);
+            }
+            ++at; // keep the run going, even if this sector failed
+            if (n != sizeof buf)
+                failed |= 1 << next;
+        }
+        pending &= ~(1 << next);
+        done |= 1 << next;
+    }
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Task zero, the special system task. It's the only one started by main().
 
 VTable* irqVec;     // see below TODO this can be fixed in JeeH
+int idleTask;       // runs when no other task can, see systemTask below
+
+// Tickless mode: when only the idle task can run, the next SysTick period is
+// stretched up to the first timer expiry, so that an idle system is no longer
+// woken up at 1 kHz. Interrupt handlers which make a task runnable must call
+// endTickless(), since that task needs timers and time slices while it runs.
+#define TICKLESS 1
+
+uint32_t tickReload;        // SysTick reload value for 1 ms, as set by JeeH
+uint32_t tickPeriod = 1;    // length of the current SysTick period, in ms
+
+// change the SysTick period, only called from the SysTick handler itself, so
+// that the counter has just been reloaded and restarting it costs no time
+void setTickPeriod (uint32_t ms) {
+    uint32_t limit = 0xFFFFFF / (tickReload + 1); // it's a 24-bit counter
+    if (ms > limit)
+        ms = limit;
+    if (ms != tickPeriod) {
+        tickPeriod = ms;
+        MMIO32(0xE000E014) = ms * (tickReload + 1) - 1; // SYST_RVR
+        MMIO32(0xE000E018) = 0; // SYST_CVR, reloads on the next clock
+    }
+}
+
+// cut a stretched SysTick period short, adding the whole ms which have passed
+// so far to ticks, and go back to 1 ms ticks, loses less than 1 ms each time
+// only called from handlers at the same priority as SysTick, see systemTask
+void endTickless () {
+    if (tickPeriod == 1 || (MMIO32(0xE000ED04) & (1<<26))) // ICSR & PENDSTSET
+        return; // not stretched, or the SysTick handler is about to run anyway
+    uint32_t left = MMIO32(0xE000E018); // SYST_CVR, counts down to zero
+    ticks += (tickPeriod * (tickReload + 1) - 1 - left) / (tickReload + 1);
+    setTickPeriod(1);
+}
 
 // call the given function while briefly switched into privileged handler mode
 // note that for this to be robust, the system task must never be preempted
 void runPrivileged (void (*fun)()) {
     irqVec->sv_call = fun;
+#ifdef ASIOS_HOST
+    hostSvc(0, 0, 0, 0, 0);
+#else
     asm volatile ("svc #0");
+#endif
     irqVec->sv_call = SVC_Handler;
 }
 
+// create a task while the system is running, this must not be interrupted by
+// SysTick, since creation also puts the new task on a ready queue
+int createTask (void* top, void (*proc)(void*), void* arg) {
+    static struct { void* top; void (*proc)(void*); void* arg; int id; } a;
+    a = { top, proc, arg, -1 };
+    runPrivileged([] { a.id = Task::create(a.top, a.proc, a.arg); });
+    return a.id;
+}
+
+// create one of the tasks which the system can't do without, or give up
+int createSystemTask (void* top, void (*proc)(void*)) {
+    int id = Task::create(top, proc, 0);
+    if (id < 0)
+        panic("no free task slot");
+    return id;
+}
+
 void systemTask (void* arg) {
     // This is task #0, running in thread mode. Since the MPU has not yet been
     // enabled and we have full R/W access to the interrupt vector in RAM, we
@@ -480,35 +1120,94 @@ void systemTask (void* arg) {
         // also lower the priority of SysTicks so they won't interrupt SVCs and
         // so task switches + timeout wakeups don't happen during syscalls
         MMIO8(0xE000ED23) = 0xFF; // SHPR3->PRI_15 = 0xFF
+
+        // same for the UART, since its handler wakes up the console driver
+        MMIO8(0xE000E400 + 37) = 0xFF; // NVIC->IP[USART1_IRQn] = 0xFF
+
+        tickReload = MMIO32(0xE000E014); // SYST_RVR, can't read it unprivileged
     });
 
+    // set up task 1, using the stack and entry point found in flash memory
+    uint32_t* task1 = (uint32_t*) arg;
+    createSystemTask((void*) (uintptr_t) task1[0],
+                        (void (*)(void*)) (uintptr_t) task1[1]);
+#if TEST_TASKS // build with "-DTEST_TASKS=1" to include these
+#include "test_tasks.h"
+#endif
+
+    // the console driver is created after the test tasks, which use fixed slots
+    // (if they leave too few slots free, the tasks below can't be created)
+    // it's woken up by the RX interrupt, and gets the driver priority right
+    // away, so that it preempts apps and servers as soon as there is input
+    alignas(8) static uint8_t consoleStack [512];
+    consoleTask = createSystemTask(consoleStack + sizeof consoleStack,
+                                    consoleDriver);
+    Task::vec[consoleTask].type = Task::Driver;
+    Task::vec[consoleTask].setPriority(Task::PRIO_DRIVER);
+
+    // the disk driver is marked as server right away, so that its first receive
+    // doesn't raise its priority, see the comments above diskDriver()
+    alignas(8) static uint8_t diskStack [1024];
+    diskTask = createSystemTask(diskStack + sizeof diskStack, diskDriver);
+    Task::vec[diskTask].type = Task::Server;
+
+    // the idle task has the lowest priority of all, it sleeps until the next
+    // interrupt, and it never makes system calls, so it needs very little stack
+    alignas(8) static uint8_t idleStack [128];
+    idleTask = createSystemTask(idleStack + sizeof idleStack, [](void*) {
+        while (true)
+#ifdef ASIOS_HOST
+            hostIdle();
+#else
+            asm volatile ("wfi");
+#endif
+    });
+    Task::vec[idleTask].setPriority(0);
+
     // periodic system tick, this never runs while SVC or other IRQs are active
     // note: pspSw.curr & Task::current() are valid, but curr->regs() isn't
+    // the ready queues are only safe to change from handlers once this is set
+    // up, i.e. tasks must be created before this point, or via createTask()
     irqVec->systick = []() {
-        ++ticks;
+        ticks += tickPeriod; // more than one after a stretched tickless period
 
-        bool expire = (int) (nextWakeup - ticks) < 0; // careful with overflow
-        if (expire)
-            nextWakeup = Task::resumeAllExpired(ticks);
-        else
-            expire = ticks % 32 == 0; // time to preempt
+        Task::expireTimers(ticks); // only looks at the head of the timer queue
+
+        Task::tick(); // time-slice accounting, may rotate the ready queue
 
         // TODO maybe the system task needs to raise its base priority instead?
-        if (expire && (Task*) pspSw.curr != Task::vec)
-            changeTask(Task::nextRunnable()); // don't preempt system task
-    };
+        if ((Task*) pspSw.curr != Task::vec)
+            Task::reschedule(); // don't preempt system task
 
-    disk.init(); // TODO flashwear disk shouldn't be here
+#if TICKLESS
+        // stretch the next period if there's nothing to do, else back to 1 ms
+        int ms = Task::best() == Task::vec + idleTask ? Task::nextTimer(ticks) : 1;
+        setTickPeriod(ms < 0 ? ~0U : ms);
+#endif
+    };
 
-    // set up task 1, using the stack and entry point found in flash memory
-    uint32_t* task1 = (uint32_t*) arg;
-    Task::create((void*) task1[0], (void (*)(void*)) task1[1], 0);
-#if 0
-#include "test_tasks.h"
+    // wake up the console driver when a byte has been received, after JeeH's
+    // own handler has put it in the receive buffer
+    uartHandler = irqVec->usart1;
+    irqVec->usart1 = []() {
+        bool rx = MMIO32(0x40011000) & (1<<5); // USART1->SR & RXNE
+        uartHandler();
+        if (rx) {
+            traceEvent(TR_IRQ, (Task*) pspSw.curr - Task::vec, 16 + 37);
+            Task::vec[consoleTask].notify();
+#if TICKLESS
+            endTickless(); // the console driver may have to run for a while
 #endif
+            if ((Task*) pspSw.curr != Task::vec)
+                Task::reschedule(); // don't preempt system task
+        }
+    };
 
     // these requests are forwarded to other tasks
     routes[SYSCALL_gpio].set(7, 0);
+    routes[SYSCALL_read].set(consoleTask, SYSCALL_read);
+    routes[SYSCALL_ioctl].set(consoleTask, SYSCALL_ioctl);
+    routes[SYSCALL_diskio].set(diskTask, SYSCALL_diskio);
 
     while (true) {
         Message sysMsg;
@@ -520,6 +1219,11 @@ void systemTask (void* arg) {
         uint32_t* args = from.regs();
         bool isCall = true; /// always? TODO from.blocking == Task::vec;
 
+        // the task's queued requests go first, so that everything stays in order
+        if (req == SYSCALL_submit)
+            batches[src] = (SysBatch*) (uintptr_t) args[0]; // ... validate
+        int batched = batches[src] != 0 ? runBatch(*batches[src]) : 0;
+
         // decide what to do with this request
         SysRoute& sr = routes[(uint8_t) req]; // index is never out of range
 
@@ -530,6 +1234,15 @@ void systemTask (void* arg) {
             if (isCall) {
                 //printf("S: rerouting req #%d from %d to %d\n",
                 //        req, src, sr.task);
+                // the disk driver can only reach the caller's buffer through
+                // this grant, it ends when the driver replies
+                if (req == SYSCALL_diskio) { // args: rw, pos, buf, cnt
+                    Grant g;
+                    g.base = (void*) (uintptr_t) args[2]; // ... validate
+                    g.len = (int) args[3] <= DISK_MAXCNT ? args[3] * 128 : 0;
+                    g.rights = args[0] ? GRANT_READ : GRANT_WRITE;
+                    from.setGrant(g);
+                }
                 from.request = sr.num; // adjust request code before forward
                 bool f = Task::vec[sr.task].forward(from, &sysMsg);
                 if (!f)
@@ -557,6 +1270,14 @@ void systemTask (void* arg) {
             case SYSCALL_noop:
                 break;
 
+            case SYSCALL_trace: // send all new trace events to the console
+                reply = traceDrain();
+                break;
+
+            case SYSCALL_submit: // registers the batch, and it has just run
+                reply = batched;
+                break;
+
             case SYSCALL_demo: {
                 printf("\t<demo %d %d %d %d>\n",
                         args[0], args[1], args[2], args[3]);
@@ -564,51 +1285,18 @@ void systemTask (void* arg) {
                 break;
             }
 
-            case SYSCALL_read: {
-                int /*fd = args[0],*/ len = args[2];
-                uint8_t* ptr = (uint8_t*) args[1];
-                for (int i = 0; i < len; ++i)
-                    ptr[i] = console.getc();
-                reply = len;
-                break;
-            }
-
             case SYSCALL_write: {
                 int /*fd = args[0],*/ len = args[2];
-                uint8_t const* ptr = (uint8_t const*) args[1];
-                for (int i = 0; i < len; ++i)
-                    console.putc(ptr[i]);
-                reply = len;
-                break;
-            }
-
-            case SYSCALL_ioctl: { // assumes FIONREAD on stdin for now
-                //int fd = args[0], req = args[2];
-                int* ptr = (int*) args[2];
-                *ptr = console.readable();
-                reply = 0;
-                break;
-            }
-
-            case SYSCALL_diskio: {
-                uint32_t rw = args[0], pos = args[1], cnt = args[3];
-                uint8_t* ptr = (uint8_t*) args[2];
-                for (uint32_t i = 0; i < cnt; ++i) {
-                    if (rw)
-                        disk.writeSector(pos + i, ptr);
-                    else
-                        disk.readSector(pos + i, ptr);
-                    ptr += 128;
-                }
-                reply = 0;
+                uint8_t const* ptr = (uint8_t const*) (uintptr_t) args[1];
+                reply = writeConsole(ptr, len);
                 break;
             }
 
             case SYSCALL_tfork: {
-                void* top = (void*) args[0];
-                void (*proc)(void*) = (void (*)(void*)) args[1];
-                void* arg = (void*) args[2];
-                reply = Task::create(top, proc, arg);
+                void* top = (void*) (uintptr_t) args[0];
+                void (*proc)(void*) = (void (*)(void*)) (uintptr_t) args[1];
+                void* arg = (void*) (uintptr_t) args[2];
+                reply = createTask(top, proc, arg);
                 printf("%d S: tfork by %d => %d sp %08x pc %08x arg %d\n",
                         ticks, src, reply, top, proc, arg);
                 break;
@@ -628,26 +1316,14 @@ void systemTask (void* arg) {
                 continue; // don't reply & resume, this task has ended
             }
 
-            case SYSCALL_yield: {
-                uint32_t now = ticks; // read volatile "ticks" counter once
-                int ms = args[0];
-                // the trick: calculate and store wakeup time in unused 2nd arg
-                args[1] = now + ms;
-                if ((uint32_t*) from.detach() != args)
-                    ;//panic("detach mixup");
-                // if this timer expires before the next wakeup time, fix it
-                if (ms < (int) (nextWakeup - now)) // careful with overflow
-                    nextWakeup = now + ms;
-                continue; // don't reply & resume now, timeout will do it
-            }
         }
 
         // unblock the originating task if it's waiting
         if (isCall) {
+            sysMsg[0] = reply; // the caller only gets r0 back, see deliver()
             /*int e =*/ ipcSend(src, &sysMsg);
             //printf("%d 0: replied to %d with %d status %d\n",
             //        ticks, src, reply, e);
-            args[0] = reply; // replace resume's result with actual one
         }
     }
 }
@@ -663,7 +1339,9 @@ int main () {
     wait_ms(200); // give platformio's console time to connect
 
     extern uint8_t _estack[];
-    uint8_t* systemStack = _estack - 1024; // leave 1k for the MSP stack
+    // leave 1k for the MSP stack, going through uintptr_t, since gcc would
+    // otherwise warn about the task frame being written below _estack
+    uint8_t* systemStack = (uint8_t*) ((uintptr_t) _estack - 1024);
 
     // display some memory usage info for the kernel + system task
     extern uint8_t _stext[], _sidata[], _sdata[], _edata[], _sbss[], _ebss[];
@@ -672,14 +1350,20 @@ int main () {
            "text %08x,%db data %08x,%db bss %04x,%db sp %04x,%db msp %04x,%db"
            "\n",
         _stext, textSz, _sdata, _edata - _sdata,
-        (uint16_t) (int) _sbss, _ebss - _sbss,
-        (uint16_t) (int) _ebss, systemStack - _ebss,
-        (uint16_t) (int) systemStack, _estack - systemStack);
+        (uint16_t) (uintptr_t) _sbss, _ebss - _sbss,
+        (uint16_t) (uintptr_t) _ebss, systemStack - _ebss,
+        (uint16_t) (uintptr_t) systemStack, _estack - systemStack);
 /*
 text 08000010,4744b data 2001E000,0b bss E000,2992b sp EBB0,4176b msp FC00,1024b
 */
     irqVec = &VTableRam(); // this call can't be used in thread mode
 
+    // enable the FPU for all tasks, with automatic and lazy state preservation
+    MMIO32(0xE000ED88) |= 0xF<<20; // SCB->CPACR: full access to CP10 & CP11
+    MMIO32(0xE000EF34) |= 0b11<<30; // FPU->FPCCR |= ASPEN | LSPEN
+
+    traceInit(); // starts the cycle counter, if tracing has been enabled
+
     // initialize the very first task, and give it the vector of the second one
     Task::create(systemStack, systemTask, (void*) 0x08004000);
 
@@ -0,0 +1,56 @@
+// CP/M-sized sectors on an SD card, using JeeH's SdCard driver over SPI.
+//
+// Each 512-byte block holds four 128-byte sectors. The last block used is kept
+// in a buffer, so that a run of sector reads only goes to the card once per
+// block, and writes are collected in it until flush() is called (or another
+// block is needed), so that a run of sector writes also writes each block once.
+
+template< typename SPI >
+class SdDisk {
+    static constexpr int SECLEN = 128;
+    static constexpr int PER_BLOCK = 512 / SECLEN;
+
+    SPI spi;
+    SdCard< SPI > sd;
+    uint8_t buf [512];
+    int block;  // the block currently in buf, or -1 if none
+    bool dirty; // buf has changes which have not been written to the card
+
+    // make sure the requested block is in the buffer
+    void load (int blk) {
+        if (blk != block) {
+            flush();
+            sd.read512(blk, buf);
+            block = blk;
+        }
+    }
+
+public:
+    // use a constructor to avoid initialised data, for better bss alignment
+    SdDisk () : block (-1), dirty (false) {}
+
+    // returns 0 if no card was found
+    int init () {
+        spi.init();
+        return sd.init() ? 1 : 0;
+    }
+
+    void readSector (int pos, void* ptr) {
+        load(pos / PER_BLOCK);
+        memcpy(ptr, buf + (pos % PER_BLOCK) * SECLEN, SECLEN);
+    }
+
+    void writeSector (int pos, void const* ptr) {
+        load(pos / PER_BLOCK); // read-modify-write, the other sectors stay
+        memcpy(buf + (pos % PER_BLOCK) * SECLEN, ptr, SECLEN);
+        dirty = true;
+    }
+
+    // write the buffered block back to the card, if it has been changed
+    void flush () {
+        if (dirty) {
+            sd.write512(block, buf);
+            dirty = false;
+        }
+    }
+};
@@ -4,6 +4,51 @@
 alignas(8) static uint8_t stack_##num [stacksize]; \
 Task::vec[num].init(stack_##num + stacksize, [](void*) { body }, 0);
 
+#if 0
+// IPC stress test: 16 clients wake up in the same tick and all call the same
+// server, which is pinned below the priority of apps, so they all end up queued
+// on it before it gets to run. The server then replies to one after the other,
+// and each reply switches to its client right away, which notes the time, so
+// the spread of those times / 15 is the cost of serving one queued request,
+// i.e. a reply, two switches, and a receive which finds the next caller. This
+// uses task slots 2..18, and replaces all the other tests below.
+
+DEFINE_TASK(2, 256,
+    DWT::start(); // bus faults unless in priviliged mode, see startTasks()
+    while (true) {
+        Message msg;
+        int src = ipcRecv(&msg);
+        int e = ipcSend(src, &msg);
+        if (e != 0)
+            printf("%d 2: reply? %d\n", ticks, e);
+    }
+)
+Task::vec[2].type = Task::Server; // so that its first receive keeps this prio
+Task::vec[2].setPriority(Task::PRIO_APP - 1);
+
+constexpr int NUM_CLIENTS = 16;
+static uint32_t replied [NUM_CLIENTS]; // when each client got its reply
+alignas(8) static uint8_t clientStacks [NUM_CLIENTS][256];
+for (int i = 0; i < NUM_CLIENTS; ++i)
+    Task::vec[3+i].init(clientStacks[i] + sizeof clientStacks[i],
+                        [](void* arg) {
+        int n = (intptr_t) arg;
+        while (true) {
+            yield(1000); // the timers of all clients will coalesce
+            Message msg;
+            msg[0] = n;
+            int e = ipcCall(2, &msg);
+            replied[n] = DWT::count();
+            if (e < 0 || msg[0] != n)
+                printf("%d %d: call? %d\n", ticks, 3+n, e);
+            if (n == NUM_CLIENTS-1)
+                printf("%d %d: %d cycles per queued request\n", ticks, 3+n,
+                        (replied[n] - replied[0]) / (NUM_CLIENTS-1));
+        }
+    }, (void*) (intptr_t) i);
+
+#else
+
 DEFINE_TASK(2, 256,
     yield(1000);
     printf("%d 2: start listening\n", ticks);
@@ -110,6 +155,159 @@ DEFINE_TASK(7, 256,
     }
 )
 
+#if 0
+// disk throughput through the disk driver task, which copies each sector into
+// the caller's buffer with ipcStore, using the grant which task #0 attaches to
+// each diskio request, with 1 to 8 sectors per call, i.e. per grant
+DEFINE_TASK(9, 1536,
+    yield(500);
+    constexpr int N = 1024; // sectors
+    uint8_t buf [8*128];
+    for (int cnt = 1; cnt <= 8; cnt *= 2) {
+        uint32_t t = ticks;
+        for (int i = 0; i < N; i += cnt)
+            diskio(0, i % 128, buf, cnt);
+        t = ticks - t;
+        printf("%d 9: %d sectors in %d ms, %d per call\n", ticks, N, t, cnt);
+    }
+)
+#endif
+
+#if 0
+// two tasks doing float math at the same time, each checks that its results
+// stay the same, while time slices keep switching between them mid-loop
+DEFINE_TASK(10, 512,
+    float expect = 0;
+    for (int pass = 0; true; ++pass) {
+        float x = 0;
+        for (int i = 0; i < 100000; ++i)
+            x = x * 0.999f + i * 0.5f;
+        if (pass == 0)
+            expect = x;
+        else if (x != expect)
+            printf("%d 10: pass %d float mismatch\n", ticks, pass);
+    }
+)
+
+DEFINE_TASK(11, 512,
+    float expect = 0;
+    for (int pass = 0; true; ++pass) {
+        float x = 1;
+        for (int i = 0; i < 77777; ++i)
+            x = x * 1.0001f - 0.25f;
+        if (pass == 0)
+            expect = x;
+        else if (x != expect)
+            printf("%d 11: pass %d float mismatch\n", ticks, pass);
+        if (pass % 100 == 0)
+            printf("%d 11: pass %d\n", ticks, pass);
+    }
+)
+
+// cost of the FPU in context switches: a call + reply between two tasks, i.e.
+// two switches, first without any FPU use, then with both tasks using it
+DEFINE_TASK(12, 256,
+    volatile float f = 1;
+    while (true) {
+        Message msg;
+        int src = ipcRecv(&msg);
+        if (msg[0])
+            f = f * 1.5f; // from now on, this task's FPU regs need saving
+        ipcSend(src, &msg);
+    }
+)
+
+DEFINE_TASK(13, 256,
+    yield(500);
+    DWT::start(); // bus faults unless in priviliged mode, see startTasks()
+    volatile float f = 1;
+    for (int useFpu = 0; useFpu <= 1; ++useFpu) {
+        constexpr int N = 1000;
+        Message msg;
+        msg[0] = useFpu;
+        if (useFpu)
+            f = f * 1.5f;
+        ipcCall(12, &msg); // let the server switch to FPU use as well
+        uint32_t t = DWT::count();
+        for (int i = 0; i < N; ++i)
+            ipcCall(12, &msg);
+        t = DWT::count() - t;
+        printf("%d 13: %d cycles per round trip, %s FPU\n",
+                ticks, t / N, useFpu ? "with" : "without");
+    }
+)
+#endif
+
+#if 0
+// IPC throughput: a round trip is one call, plus one reply and one receive in
+// the server, i.e. three system calls and two task switches, so the cost of a
+// switch can be estimated by subtracting three plain system calls (a send to
+// an unused task slot, which fails right away) and halving the rest
+// this also works in the host simulator, where DWT cycles are 168 MHz ticks
+DEFINE_TASK(14, 256,
+    while (true) {
+        Message msg;
+        int src = ipcRecv(&msg);
+        ipcSend(src, &msg);
+    }
+)
+
+DEFINE_TASK(15, 256,
+    yield(500);
+    DWT::start(); // bus faults unless in priviliged mode, see startTasks()
+    constexpr int N = 10000;
+    while (true) {
+        Message msg;
+        uint32_t t = DWT::count();
+        for (int i = 0; i < N; ++i)
+            ipcSend(16, &msg);
+        uint32_t svc = (DWT::count() - t) / N;
+        t = DWT::count();
+        for (int i = 0; i < N; ++i)
+            ipcCall(14, &msg);
+        uint32_t call = (DWT::count() - t) / N;
+        printf("%d 15: svc %d, round trip %d, switch ~%d cycles, %d calls/s\n",
+                ticks, svc, call, (int) (call - 3 * svc) / 2,
+                call > 0 ? fullSpeedClock() / call : 0);
+        yield(1000);
+    }
+)
+#endif
+
+#if 0
+// diskio latency and throughput with two concurrent clients, each reading 4
+// sectors per call, in alternate chunks of the same area, so that their
+// requests are adjacent and can be merged by the disk driver
+alignas(8) static uint8_t diskStacks [2][1024];
+for (int n = 0; n < 2; ++n)
+    Task::vec[16+n].init(diskStacks[n] + sizeof diskStacks[n],
+                         [](void* arg) {
+        int odd = (uintptr_t) arg; // which of the alternate chunks to read
+        yield(500);
+        DWT::start(); // bus faults unless in priviliged mode, see startTasks()
+        constexpr int N = 10000; // calls
+        constexpr int CNT = 4; // sectors per call
+        uint8_t buf [CNT*128];
+        uint32_t us = fullSpeedClock() / 1000000;
+        while (true) {
+            uint32_t worst = 0;
+            uint32_t t = DWT::count();
+            for (int i = 0; i < N; ++i) {
+                uint32_t t0 = DWT::count();
+                diskio(0, (2*i + odd) * CNT % 2048, buf, CNT);
+                uint32_t dt = DWT::count() - t0;
+                if (dt > worst)
+                    worst = dt;
+            }
+            t = DWT::count() - t;
+            uint32_t ms = t / us / 1000;
+            printf("%d %d: avg %d us, max %d us, %d KB/s\n", ticks, 16 + odd,
+                    t / N / us, worst / us, ms > 0 ? N * CNT * 128 / ms : 0);
+            yield(1000);
+        }
+    }, (void*) (uintptr_t) n);
+#endif
+
 #if 0
 DEFINE_TASK(7, 256,
     PinA<7> led3;
@@ -122,3 +320,5 @@ DEFINE_TASK(7, 256,
     }
 )
 #endif
+
+#endif
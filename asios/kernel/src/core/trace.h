@@ -0,0 +1,98 @@
+// Kernel event tracing, into a ring buffer of compact binary records in RAM.
+//
+// Each event is 8 bytes: a DWT cycle count, an event type, the task id which
+// caused it, and two type-specific bytes. Events are only recorded in handler
+// mode, where slots are claimed with an atomic increment, so that interrupts
+// can also add events without any locking. Task #0 drains the ring over the
+// console as "~T ..." text lines, which tracedump.py turns into a timeline and
+// a latency histogram per IPC pair. When the ring overflows, the oldest events
+// are lost, and a "~L <count>" line reports how many. Draining first takes a
+// snapshot of all new events with interrupts masked, so that printing them
+// can't race with new events overwriting the same slots.
+//
+// Recording is off unless TRACE is set to 1, in which case all the calls in
+// the kernel are compiled in, at a cost of some 15 cycles each.
+
+#ifndef TRACE
+#define TRACE 0
+#endif
+
+enum {
+    TR_SWITCH,  // context switch requested, a = next task
+    TR_SVC,     // SVC entry, a = request code
+    TR_SVCEND,  // SVC exit, a = request code, b = low byte of result
+    TR_CALL,    // call queued, a = destination
+    TR_ACCEPT,  // call accepted by a listening task, a = caller
+    TR_DELIVER, // message delivery, a = destination, b = 1 if successful
+    TR_FORWARD, // call forwarded, a = new destination
+    TR_TIMEOUT, // timer expired, i.e. end of yield, or a receive/call failed
+    TR_IRQ,     // interrupt, a = exception number
+};
+
+struct TraceEvent {
+    uint32_t cycles;
+    uint8_t type, task, a, b;
+};
+
+constexpr int TRACE_SIZE = 128; // must be a power of 2
+
+TraceEvent traceRing [TRACE_SIZE];
+uint32_t traceHead; // total number of events ever recorded
+uint32_t traceTail; // total number of events drained so far
+
+// enable the DWT cycle counter, needs to be called in privileged mode
+void traceInit () {
+#if TRACE
+    MMIO32(0xE000EDFC) |= 1<<24; // DEMCR |= TRCENA
+    MMIO32(0xE0001000) |= 1;     // DWT->CTRL |= CYCCNTENA
+#endif
+}
+
+// record an event, can only be called from handler mode
+void traceEvent (int type, int task, int a =0, int b =0) {
+#if TRACE
+    uint32_t n = __atomic_fetch_add(&traceHead, 1, __ATOMIC_RELAXED);
+    TraceEvent& e = traceRing[n % TRACE_SIZE];
+    e.cycles = MMIO32(0xE0001004); // DWT->CYCCNT
+    e.type = type;
+    e.task = task;
+    e.a = a;
+    e.b = b;
+#endif
+}
+
+void runPrivileged (void (*fun)()); // see main.cpp
+
+// send all new events to the console, returns the number of lost events
+// this runs in task #0, events added while printing are left for next time
+int traceDrain () {
+    static TraceEvent copy [TRACE_SIZE];
+    static uint32_t count, lost;
+
+    // copy the new events out in handler mode, where no other handler can be
+    // halfway through recording one, and with interrupts masked, so that no
+    // events can be added until the ring has been caught up to the head
+    runPrivileged([] {
+#ifndef ASIOS_HOST // the host runs all handlers with SIGALRM blocked
+        asm volatile ("cpsid i");
+#endif
+        uint32_t head = traceHead;
+        count = head - traceTail;
+        lost = count > TRACE_SIZE ? count - TRACE_SIZE : 0; // overwritten
+        count -= lost;
+        for (uint32_t i = 0; i < count; ++i)
+            copy[i] = traceRing[(head - count + i) % TRACE_SIZE];
+        traceTail = head;
+#ifndef ASIOS_HOST
+        asm volatile ("cpsie i");
+#endif
+    });
+
+    if (lost)
+        printf("~L %d\n", lost);
+    for (uint32_t i = 0; i < count; ++i) {
+        TraceEvent const& e = copy[i];
+        printf("~T %08x %d %d %d %d\n", e.cycles, e.type, e.task, e.a, e.b);
+    }
+    return lost;
+}
@@ -18,36 +18,42 @@ const uint8_t ram [] = {
 
 Context context;
 
+// console output is queued and only sent out on the next system call, and the
+// console status check is skipped a few times while output is pending, since
+// CP/M's BDOS checks for a keypress before every character it outputs
+SysBatch out;
+int skipped;
+
 void systemCall (Context *ctx, int req, uint16_t pc) {
     Z80_STATE* state = &ctx->state;
 
     switch (req) {
 
         case 0: { // return true if there's input
+            if (out.count > 0 && ++skipped < 64) {
+                A = 0x00;
+                break;
+            }
+            skipped = 0;
             int n = 0;
-            ioctl(0, /*FIONREAD*/ 0, &n);
+            ioctl(0, IOCTL_FIONREAD, &n);
             A = n ? 0xFF : 0x00;
             break;
         }
 
         case 1: { // wait for input, return in A
-            // TODO should be a read which suspends until there is data
-            // this polls for now, and has a race condition with two readers
             int n = 0;
-            do
-                ioctl(0, /*FIONREAD*/ 0, &n);
-            while (n == 0);
-            read(0, &n, 1);
+            read(0, &n, 1); // blocks in the console driver until there is data
             A = n;
             break;
         }
 
         case 2: // output the character in C
-            write(1, &C, 1);
+            bwrite(&out, 1, &C, 1);
             break;
 
         case 3: // output the string in DE until null byte
-            write(1, CCMEM + DE, strlen((char*) CCMEM + DE));
+            bwrite(&out, 1, CCMEM + DE, strlen((char*) CCMEM + DE));
             break;
 
         case 4: { // r/w diskio
@@ -60,7 +66,8 @@ void systemCall (Context *ctx, int req, uint16_t pc) {
         case 100: { // run a host task, i.e. escape out of The Matrix!
             int* task = (int*) (CCMEM + DE);
             // fork task and wait for its completion before resuming Z80 mode
-            twait(tfork((void*) task[0], (void (*)(void*)) task[1], 0));
+            twait(tfork((void*) (uintptr_t) task[0],
+                        (void (*)(void*)) (uintptr_t) task[1], 0));
             break;
         }
 
@@ -98,11 +105,14 @@ int main (void) {
     // leave a copy of HEXSAVE.COM at 0x0100
     memcpy(CCMEM + 0x0100, ram, sizeof ram);
 
-    // start emulating
+    // start emulating, don't let queued output linger while the Z80 is busy
+    submit(&out);
     Z80Reset(&context.state);
-    do
+    do {
         Z80Emulate(&context.state, 2000000, &context);
-    while (!context.done);
+        if (out.count > 0)
+            submit(&out);
+    } while (!context.done);
 
     return 0;
 }
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+# Decode kernel trace events, as drained to the console by the "trace" syscall.
+#
+# Usage: tracedump.py [-m MHz] [logfile]
+#
+# Reads a console log (or stdin), picks out the "~T" and "~L" lines produced
+# by traceDrain() in src/core/trace.h, and prints a timeline of all events,
+# followed by a histogram of call latencies for each (caller, replier) pair,
+# i.e. the time from a call being queued until the reply is delivered. Only a
+# delivery by the task which the call was sent (or last forwarded) to counts as
+# its reply, and a call which times out is dropped.
+
+import sys
+
+SWITCH, SVC, SVCEND, CALL, ACCEPT, DELIVER, FORWARD, TIMEOUT, IRQ = range(9)
+
+def describe (type, task, a, b):
+    if type == SWITCH:
+        return 'switch %d -> %d' % (task, a)
+    if type == SVC:
+        return 'svc #%d' % a
+    if type == SVCEND:
+        return 'svc #%d done, r0 %d' % (a, b)
+    if type == CALL:
+        return 'call to %d' % a
+    if type == ACCEPT:
+        return 'accepts call from %d' % a
+    if type == DELIVER:
+        return 'deliver to %d%s' % (a, '' if b else ' REJECTED')
+    if type == FORWARD:
+        return 'forwarded to %d' % a
+    if type == TIMEOUT:
+        return 'timer expired'
+    if type == IRQ:
+        return 'irq %d' % a
+    return '? %d %d %d' % (type, a, b)
+
+def main (args):
+    mhz = 168
+    if len(args) >= 2 and args[0] == '-m':
+        mhz = float(args[1])
+        args = args[2:]
+    f = open(args[0]) if args else sys.stdin
+
+    events, lost = [], 0
+    for line in f:
+        w = line.split()
+        if len(w) == 6 and w[0] == '~T':
+            events.append((int(w[1], 16),) + tuple(int(x) for x in w[2:]))
+        elif len(w) == 2 and w[0] == '~L':
+            lost += int(w[1])
+    if not events:
+        print('no trace events found')
+        return
+
+    # timeline, the 32-bit cycle counter may wrap, so accumulate differences
+    print('%12s %10s  task  event' % ('usecs', 'delta'))
+    now, prev = 0, events[0][0]
+    pending = {}    # caller => (destination, time of its call)
+    latencies = {}  # (caller, replier) => list of cycle counts
+    for cycles, type, task, a, b in events:
+        delta = (cycles - prev) & 0xFFFFFFFF
+        prev = cycles
+        now += delta
+        print('%12.3f %+10.3f  %4d  %s' % (now / mhz, delta / mhz, task,
+                                           describe(type, task, a, b)))
+        if type == CALL:
+            pending[task] = (a, now)
+        elif type == FORWARD and task in pending:
+            pending[task] = (a, pending[task][1])
+        elif type == TIMEOUT:
+            pending.pop(task, None)
+        elif type == DELIVER and b and pending.get(a, (None,))[0] == task:
+            latencies.setdefault((a, task), []).append(now - pending.pop(a)[1])
+
+    if lost:
+        print('\n%d events were lost, the trace ring overflowed' % lost)
+
+    # latency histograms, in power-of-2 buckets of cycles
+    for (caller, replier), times in sorted(latencies.items()):
+        times.sort()
+        print('\ncalls from %d replied by %d: %d, min %.2f med %.2f max %.2f us'
+                % (caller, replier, len(times), times[0] / mhz,
+                   times[len(times)//2] / mhz, times[-1] / mhz))
+        buckets = {}
+        for t in times:
+            n = max(t, 1).bit_length()
+            buckets[n] = buckets.get(n, 0) + 1
+        for n in range(min(buckets), max(buckets) + 1):
+            count = buckets.get(n, 0)
+            print('  < %8d cycles %6d %s' % (1 << n, count, '#' * min(count, 50)))
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -0,0 +1,225 @@
+// Host-side soak test of the DMA serial bridge in ../common/uart-bridge.h
+//
+// The two USARTs and their DMA channels are modelled at the byte level, with
+// bytes arriving and leaving at the configured baud rates. On one side is the
+// console host, on the other the eZ80, both sending a known byte sequence and
+// checking what they get. The bridge is polled on the same events which cause
+// an interrupt on the STM32, optionally delayed to mimic a busy MCU. Each run
+// reports the sustained rate, the number of dropped bytes, the average chunk
+// size per DMA transfer, and the number of interrupts.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <uart-bridge.h>
+
+constexpr uint64_t NS = 1000000000;
+
+// one USART with its receive and transmit DMA channels, and the far end
+struct Port {
+    uint32_t baud;
+    // circular receive DMA
+    uint8_t* ring;
+    int ringLen, left;
+    // transmit DMA, the far end checks the data it receives
+    uint8_t const* txPtr;
+    int txLeft;
+    uint64_t txFree;            // time when the line is free again
+    uint64_t lastAt;            // when the last byte was received
+    uint64_t idleAt;            // when the receive line goes idle, if set
+    uint32_t rcvd, errors, transfers;
+    // the far end's sender, rate 0 is off, stops a little after RTS is raised,
+    // the console host gets its data once per ms, as from a USB serial adapter
+    uint32_t rate, sendLimit, sent, skid;
+    uint64_t credit, sendAt;    // credit is in millionths of a byte
+    bool usb;
+    bool stop;
+
+    uint64_t byteTime () const { return 10 * NS / baud; }
+};
+
+static Port ports [2]; // 0 = console on USART1, 1 = eZ80 on USART2
+
+static Port& byUart (uint32_t uart) {
+    return ports[uart == bridgeUart1 ? 0 : 1];
+}
+
+static Port& byChan (int ch) {
+    return ports[ch == 4 || ch == 5 ? 0 : 1]; // 4/5 = USART1, 6/7 = USART2
+}
+
+static uint64_t now;
+static uint64_t latency, pollAt; // interrupt delay, and when the next poll is due
+static bool rxEvent [2];    // a receive event has been seen, for up and down
+static UartBridge* active;
+
+// an interrupt, it's handled after the set delay, unless one is already pending
+static void irq (int rx =-1) {
+    if (rx >= 0)
+        rxEvent[rx] = true;
+    if (pollAt == 0)
+        pollAt = now + latency;
+}
+
+void bridgeRxStart (int ch, uint32_t, uint8_t* ring, int len) {
+    Port& p = byChan(ch);
+    p.ring = ring;
+    p.ringLen = p.left = len;
+}
+
+int bridgeRxLeft (int ch) {
+    return byChan(ch).left;
+}
+
+void bridgeTxStart (int ch, uint32_t, uint8_t const* ptr, int len) {
+    Port& p = byChan(ch);
+    p.txPtr = ptr;
+    p.txLeft = len;
+    ++p.transfers;
+}
+
+bool bridgeTxBusy (int ch) {
+    return byChan(ch).txLeft != 0;
+}
+
+void bridgeFlow (uint32_t) {}
+
+void bridgeIrqs (UartBridge* bridge) {
+    active = bridge;
+}
+
+void bridgeRts (uint32_t uart, bool stop) {
+    Port& p = byUart(uart);
+    p.stop = stop;
+    if (stop)
+        p.skid = 16; // the eZ80's UART FIFO may still send this much
+}
+
+// the byte sequence sent from each side, n is the index in that sequence
+static uint8_t pattern (int side, uint32_t n) {
+    return (n * (side ? 7 : 13) + (n >> 8)) & 0xFF;
+}
+
+// advance the model by one microsecond
+static void step () {
+    now += 1000;
+    for (int i = 0; i < 2; ++i) {
+        Port& p = ports[i];
+        Port& q = ports[1-i]; // the bridge sends p's input out through q
+
+        // the far end sends at its own rate, as long as it's allowed to
+        if (!p.usb)
+            p.credit += p.rate;
+        else if (now % 1000000 == 0)
+            p.credit += 1000 * p.rate;
+        if (p.credit >= 1000000 && p.sent < p.sendLimit && now >= p.sendAt &&
+                (!p.stop || p.skid > 0)) {
+            if (p.stop)
+                --p.skid;
+            p.credit -= 1000000;
+            p.sendAt = now + p.byteTime();
+            if (p.ring) {
+                p.ring[p.ringLen - p.left] = pattern(i, p.sent);
+                if (--p.left == 0)
+                    p.left = p.ringLen;
+                if (p.left == p.ringLen || p.left == p.ringLen/2)
+                    irq(i); // TC or HT on the receive channel
+                p.idleAt = now + p.byteTime();
+            }
+            ++p.sent;
+        }
+        if (p.idleAt && now >= p.idleAt) {
+            p.idleAt = 0;
+            irq(i); // IDLE
+        }
+
+        // the transmitter takes one byte at a time from its DMA channel
+        if (q.txLeft > 0 && now >= q.txFree) {
+            if (*q.txPtr++ != pattern(i, q.rcvd))
+                ++q.errors;
+            ++q.rcvd;
+            q.lastAt = now;
+            // back to back, or starting from an idle line
+            q.txFree = (now - q.txFree < 1000 ? q.txFree : now) + q.byteTime();
+            if (--q.txLeft == 0)
+                irq(); // TC on the transmit channel
+        }
+    }
+}
+
+static UartBridge bridge;
+
+// send for a few seconds, then let it drain, and report the results
+static bool soak (char const* what, uint32_t conBaud, uint32_t conRate,
+                    uint32_t ezBaud, uint32_t ezRate, int delayUs, bool flow,
+                    bool lossy =false) {
+    constexpr int SECS = 10;
+    memset(ports, 0, sizeof ports);
+    ports[0].baud = conBaud; ports[0].rate = conRate; ports[0].usb = true;
+    ports[1].baud = ezBaud; ports[1].rate = ezRate;
+    for (auto& p : ports)
+        p.sendLimit = SECS * p.rate;
+    now = pollAt = 0;
+    latency = delayUs * 1000;
+    bridge.init(flow);
+
+    uint32_t irqs = 0;
+    uint64_t end = 0;
+    while (end == 0 || now < end) {
+        step();
+        if (pollAt && now >= pollAt) {
+            pollAt = 0;
+            active->up.poll(rxEvent[0]);
+            active->down.poll(rxEvent[1]);
+            rxEvent[0] = rxEvent[1] = false;
+            ++irqs;
+        }
+        if (end == 0 && ports[0].sent == ports[0].sendLimit &&
+                        ports[1].sent == ports[1].sendLimit)
+            end = now + NS; // one more second, for the last bytes
+    }
+
+    printf("%s:\n", what);
+    bool ok = true;
+    BridgeDir* dirs [] = { &bridge.up, &bridge.down };
+    char const* names [] = { "console -> eZ80", "eZ80 -> console" };
+    for (int i = 0; i < 2; ++i) {
+        Port& p = ports[i];
+        Port& q = ports[1-i];
+        BridgeDir& d = *dirs[i];
+        if (p.sent == 0)
+            continue;
+        printf("  %s: %6u b/s, %5u dropped, %5.1f b/chunk\n", names[i],
+                (uint32_t) (q.rcvd * NS / q.lastAt), d.drops,
+                (double) q.rcvd / q.transfers);
+        // every byte must have arrived or been counted as dropped
+        ok = ok && q.rcvd + d.drops == p.sent && (lossy || d.drops == 0);
+        // if nothing was dropped, it must have arrived unchanged
+        ok = ok && (d.drops > 0 || q.errors == 0);
+    }
+    printf("  %u interrupts/s%s\n", (uint32_t) (irqs * NS / now),
+            ok ? "" : ", *FAILED*");
+    return ok;
+}
+
+int main () {
+    int failures = 0;
+    // the rates as in the Wide Pill builds: 115200 and 9600*36/4 = 86400 baud
+    failures += !soak("eZ80 -> console at full rate",
+                        115200, 0, 86400, 8640, 0, false);
+    failures += !soak("console -> eZ80, paced by the host to the eZ80 rate",
+                        115200, 8640, 86400, 0, 0, false);
+    failures += !soak("both at once, full duplex",
+                        115200, 8640, 86400, 8640, 0, false);
+    failures += !soak("both at once, interrupts delayed by 0.1 ms",
+                        115200, 8640, 86400, 8640, 100, false);
+    failures += !soak("console flooding the slower eZ80 side (lossy)",
+                        115200, 11520, 86400, 0, 0, false, true);
+    failures += !soak("eZ80 flooding a 57600 baud console (lossy)",
+                        57600, 0, 86400, 8640, 0, false, true);
+    failures += !soak("eZ80 flooding a 57600 baud console, with RTS/CTS",
+                        57600, 0, 86400, 8640, 0, true);
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures != 0;
+}
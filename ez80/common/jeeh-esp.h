@@ -1,5 +1,7 @@
 // JeeH-like wrappers
 
+#define MMIO32(x) (*(volatile uint32_t*) (x))
+
 template< int N >
 struct Pin {
     static constexpr int pin = N;
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+# Pack an image for upload via ZDI, to be unpacked on the eZ80, see zdi-lz.h
+#
+# usage: lzpack.py infile outfile
+#
+# If outfile ends in ".h", it's written as a list of C bytes (like "xxd -i"),
+# to be included in an array, else the packed data is written out as is.
+#
+# The format is a 6-byte header followed by an LZ4-style stream of sequences:
+#
+#   header: unpacked length (3 bytes), in-place slack (3 bytes), little-endian
+#   token:  4 bits literal length, 4 bits match length - 4
+#           [literal length - 15, in 255's plus a final byte < 255]
+#           literals
+#           match offset (2 bytes, little-endian), 0 ends the stream
+#           [match length - 19, in 255's plus a final byte < 255]
+#
+# The stream can be unpacked in place: when it is stored so that it ends at
+# "slack" bytes past the end of the unpacked data, no byte will be overwritten
+# before it has been read. The packed result is checked by unpacking it in
+# exactly that way, before it's written out.
+
+import sys
+
+MIN_MATCH = 4
+MAX_OFFSET = 0xFFFF
+MAX_CHAIN = 32  # match candidates to try per position, more is slower
+
+def extLength (out, n):
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+
+def pack (data):
+    out = bytearray()
+    heads = {}      # 4-byte prefix -> most recent position
+    prev = [0] * len(data)  # position -> previous one with the same prefix
+    reach = 0       # max of write pos - read pos, for the in-place slack
+
+    def insert (i):
+        if i + MIN_MATCH <= len(data):
+            key = bytes(data[i:i+MIN_MATCH])
+            prev[i] = heads.get(key, -1)
+            heads[key] = i
+
+    def sequence (lit, litPos, offset, mlen):
+        nonlocal reach
+        token = min(lit, 15) << 4
+        if offset:
+            token |= min(mlen - MIN_MATCH, 15)
+        out.append(token)
+        if lit >= 15:
+            extLength(out, lit - 15)
+        out.extend(data[litPos:litPos+lit])
+        reach = max(reach, litPos + lit - 1 - len(out))
+        out.extend((offset & 0xFF, offset >> 8))
+        if offset and mlen - MIN_MATCH >= 15:
+            extLength(out, mlen - MIN_MATCH - 15)
+        reach = max(reach, litPos + lit + mlen - 1 - len(out))
+
+    i = anchor = 0
+    while i < len(data):
+        best, bestPos = 0, 0
+        if i + MIN_MATCH <= len(data):
+            j = heads.get(bytes(data[i:i+MIN_MATCH]), -1)
+            for _ in range(MAX_CHAIN):
+                if j < 0 or i - j > MAX_OFFSET:
+                    break
+                n = 0
+                while i + n < len(data) and data[j+n] == data[i+n]:
+                    n += 1
+                if n > best:
+                    best, bestPos = n, j
+                j = prev[j]
+        if best >= MIN_MATCH:
+            sequence(i - anchor, anchor, i - bestPos, best)
+            for k in range(i, i + best):
+                insert(k)
+            i += best
+            anchor = i
+        else:
+            insert(i)
+            i += 1
+    sequence(len(data) - anchor, anchor, 0, 0)
+
+    slack = max(0, reach + 1 - (len(data) - len(out)))
+    hdr = bytes((len(data) & 0xFF, (len(data) >> 8) & 0xFF, len(data) >> 16,
+                 slack & 0xFF, (slack >> 8) & 0xFF, slack >> 16))
+    return hdr + out
+
+# unpack in place, the same way as the eZ80 code in zdi-lz.h does, and fail
+# if any input byte gets overwritten before it has been used
+def unpackInPlace (packed):
+    size = packed[0] | (packed[1] << 8) | (packed[2] << 16)
+    slack = packed[3] | (packed[4] << 8) | (packed[5] << 16)
+    stream = packed[6:]
+    mem = bytearray(size + slack)
+    src = len(mem) - len(stream)
+    mem[src:] = stream
+    used = [False] * len(mem)   # written since the input was stored there
+    hl, de = src, 0
+
+    def get ():
+        nonlocal hl
+        assert not used[hl], "input overwritten at %d" % (hl - src)
+        hl += 1
+        return mem[hl-1]
+
+    def put (b):
+        nonlocal de
+        mem[de] = b
+        used[de] = True
+        de += 1
+
+    def length (n):
+        if n == 15:
+            while True:
+                b = get()
+                n += b
+                if b != 255:
+                    break
+        return n
+
+    while True:
+        token = get()
+        for _ in range(length(token >> 4)):
+            put(get())
+        offset = get() | (get() << 8)
+        if offset == 0:
+            break
+        for _ in range(length(token & 0x0F) + MIN_MATCH):
+            put(mem[de - offset])
+    assert de == size, "unpacked %d bytes instead of %d" % (de, size)
+    return bytes(mem[:size])
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        sys.exit("usage: %s infile outfile" % sys.argv[0])
+    data = open(sys.argv[1], 'rb').read()
+    if len(data) >= 1 << 24:
+        sys.exit("input is too large: %d bytes" % len(data))
+
+    packed = pack(data)
+    if unpackInPlace(packed) != data:
+        sys.exit("packing failed, unpacked data differs")
+
+    if sys.argv[2].endswith('.h'):
+        with open(sys.argv[2], 'w') as f:
+            for i in range(0, len(packed), 12):
+                line = ', '.join('0x%02x' % b for b in packed[i:i+12])
+                f.write('  %s%s\n' % (line, ',' if i + 12 < len(packed) else ''))
+    else:
+        open(sys.argv[2], 'wb').write(packed)
+
+    slack = packed[3] | (packed[4] << 8) | (packed[5] << 16)
+    print("%s: %d => %d bytes (%d%%), slack %d" % (sys.argv[1], len(data),
+            len(packed), 100 * len(packed) // max(len(data), 1), slack))
@@ -0,0 +1,209 @@
+// Serial bridge between the console and the eZ80's UART, done with DMA
+//
+// Both USARTs receive into a ring buffer through a circular DMA channel, and
+// whatever has come in is sent out on the other USART as one chunk, by a normal
+// DMA transfer straight from that ring buffer. Nothing is done per byte: poll()
+// runs on interrupts only, when a ring is half or completely filled, when the
+// receive line goes idle after a burst, and when a transfer is done. The MCU can
+// sleep the rest of the time. When more than a ring's worth is waiting to be
+// sent, the oldest bytes are dropped and counted. To keep the chunks large with
+// a steady stream, the end of a transfer only starts the next one if there are
+// at least BRIDGE_MIN bytes, or if a receive event has been seen since.
+//
+// With flow control, RTS (PA1) is raised when the ring for data coming from the
+// eZ80 is 3/4 full, and lowered again below 1/2, while CTS (PA0) makes USART2
+// hold off sending to the eZ80. Console input can't be throttled this way.
+//
+// After init(), USART1 belongs to the bridge: printf and console.putc must not
+// be used anymore. The bridge's interrupt handler replaces the one of UartBufDev
+// and never clears TXEIE, so a console write would cause an interrupt storm.
+//
+// This assumes an STM32F103, with the console on USART1 and the eZ80 on USART2,
+// using DMA1 channels 4..7. The DMA transport of ZDI uses channels 1 and 2, so
+// ZDI access, e.g. by zdi-disk.h, can go on while bridging.
+// A NATIVE build has to provide the bridgeXxx() functions itself.
+
+constexpr int BRIDGE_RING = 256;        // ring buffer size, per direction
+constexpr int BRIDGE_MIN = 32;          // smallest chunk to send without a flush
+constexpr uint32_t bridgeUart1 = 0x40013800; // USART1, the console
+constexpr uint32_t bridgeUart2 = 0x40004400; // USART2, the eZ80
+
+struct UartBridge;
+
+// these are provided by the hardware-specific code below, or by a NATIVE build
+void bridgeRxStart (int ch, uint32_t uart, uint8_t* ring, int len);
+int bridgeRxLeft (int ch);
+void bridgeTxStart (int ch, uint32_t uart, uint8_t const* ptr, int len);
+bool bridgeTxBusy (int ch);
+void bridgeFlow (uint32_t uart);
+void bridgeRts (uint32_t uart, bool stop);
+void bridgeIrqs (UartBridge* bridge);
+
+// one direction of the bridge, from the rxUart to the txUart
+struct BridgeDir {
+    uint8_t ring [BRIDGE_RING];
+    int rxCh, txCh;             // DMA1 channels
+    uint32_t rxUart, txUart;
+    bool rts, stopped;          // RTS is used, and is telling the sender to stop
+    bool flush;                 // send even a short chunk when possible
+    int head, tail, busy;       // ring positions, and number of bytes being sent
+    uint32_t got, sent, drops;  // totals since init
+
+    void init (int rx, int tx, uint32_t from, uint32_t to, bool flow) {
+        rxCh = rx; txCh = tx; rxUart = from; txUart = to;
+        rts = flow; stopped = flush = false;
+        head = tail = busy = 0;
+        got = sent = drops = 0;
+        bridgeRxStart(rxCh, rxUart, ring, sizeof ring);
+    }
+
+    // called on each interrupt, rx is set for the receive events: a chunk is
+    // sent once a receive event has been seen, or when there's enough to send
+    void poll (bool rx) {
+        flush = flush || rx;
+        int h = BRIDGE_RING - bridgeRxLeft(rxCh);
+        got += (h - head + BRIDGE_RING) % BRIDGE_RING;
+        head = h % BRIDGE_RING;
+
+        if (busy > 0 && !bridgeTxBusy(txCh)) {
+            sent += busy;
+            tail = (tail + busy) % BRIDGE_RING;
+            busy = 0;
+        }
+
+        if (busy == 0) {
+            // the ring has been overrun if more than its size is waiting
+            if (got - sent > BRIDGE_RING) {
+                uint32_t lost = got - sent - BRIDGE_RING;
+                drops += lost;
+                sent += lost;
+                tail = (tail + lost) % BRIDGE_RING;
+            }
+            // send as much as possible in one go, i.e. up to the end of the ring
+            // (nothing more will arrive while the sender is held off by RTS)
+            if (got != sent && (flush || stopped || got - sent >= BRIDGE_MIN)) {
+                flush = false;
+                busy = got - sent;
+                if (busy > BRIDGE_RING - tail)
+                    busy = BRIDGE_RING - tail;
+                bridgeTxStart(txCh, txUart, ring + tail, busy);
+            }
+        }
+
+        if (rts) {
+            uint32_t waiting = got - sent;
+            bool stop = waiting > 3*BRIDGE_RING/4 ? true :
+                        waiting < BRIDGE_RING/2 ? false : stopped;
+            if (stop != stopped) {
+                bridgeRts(rxUart, stop);
+                flush = flush || !stop; // don't wait for a receive event
+            }
+            stopped = stop;
+        }
+    }
+};
+
+// both directions, use flow control only if the eZ80's RTS/CTS are wired up
+struct UartBridge {
+    BridgeDir up;   // console to eZ80
+    BridgeDir down; // eZ80 to console
+
+    void init (bool flow) {
+        if (flow)
+            bridgeFlow(bridgeUart2);
+        up.init(5, 7, bridgeUart1, bridgeUart2, false);
+        down.init(6, 4, bridgeUart2, bridgeUart1, flow);
+        bridgeIrqs(this);
+    }
+};
+
+#if !NATIVE
+constexpr uint32_t bridgeDma = 0x40020000;  // DMA1
+constexpr uint32_t bridgeGpio = 0x40010800; // GPIOA
+
+uint32_t bridgeChan (int ch) {
+    return bridgeDma + 0x08 + 20*(ch-1);
+}
+
+// take the USART over from UartBufDev, and start receiving into the ring
+void bridgeRxStart (int ch, uint32_t uart, uint8_t* ring, int len) {
+    while (MMIO32(uart+0x0C) & (1<<7)) {} // wait for TXEIE, i.e. an empty ring
+    while ((MMIO32(uart+0x00) & (1<<6)) == 0) {} // USART->SR & TC
+    MMIO32(uart+0x0C) &= ~((1<<7) | (1<<5)); // USART->CR1: no TXEIE, RXNEIE
+
+    MMIO32(0x40021014) |= 1<<0; // RCC->AHBENR |= DMA1EN
+    uint32_t c = bridgeChan(ch);
+    MMIO32(c) = 0;
+    MMIO32(c+0x04) = len;               // CNDTR
+    MMIO32(c+0x08) = uart + 0x04;       // CPAR = USART->DR
+    MMIO32(c+0x0C) = (uint32_t) ring;   // CMAR
+    // 8-bit mem & periph, mem incr, circular, periph-to-mem, HTIE, TCIE, enable
+    MMIO32(c) = (1<<7) | (1<<5) | (1<<2) | (1<<1) | (1<<0);
+    MMIO32(uart+0x14) |= (1<<7) | (1<<6); // USART->CR3 |= DMAT | DMAR
+}
+
+// number of bytes until the DMA wraps around to the start of the ring
+int bridgeRxLeft (int ch) {
+    return MMIO32(bridgeChan(ch)+0x04); // CNDTR
+}
+
+void bridgeTxStart (int ch, uint32_t uart, uint8_t const* ptr, int len) {
+    uint32_t c = bridgeChan(ch);
+    MMIO32(c) = 0;
+    MMIO32(c+0x04) = len;               // CNDTR
+    MMIO32(c+0x08) = uart + 0x04;       // CPAR = USART->DR
+    MMIO32(c+0x0C) = (uint32_t) ptr;    // CMAR
+    // 8-bit mem & periph, mem incr, mem-to-periph, TCIE, enable
+    MMIO32(c) = (1<<7) | (1<<4) | (1<<1) | (1<<0);
+}
+
+// the last byte may still be going out, but it's no longer needed in the ring
+bool bridgeTxBusy (int ch) {
+    return MMIO32(bridgeChan(ch)+0x04) != 0; // CNDTR
+}
+
+// set up RTS as output and let CTS hold off sending, USART2 only
+void bridgeFlow (uint32_t uart) {
+    if (uart == bridgeUart2) {
+        MMIO32(bridgeGpio+0x10) = 1<<(1+16); // GPIOA->BSRR, PA1 low = go
+        MMIO32(bridgeGpio+0x00) = (MMIO32(bridgeGpio+0x00) & ~(0xF<<4))
+                                    | (0x2<<4); // GPIOA->CRL, PA1 = out 2 MHz
+        MMIO32(uart+0x14) |= 1<<9; // USART->CR3 |= CTSE
+    }
+}
+
+void bridgeRts (uint32_t uart, bool stop) {
+    if (uart == bridgeUart2)
+        MMIO32(bridgeGpio+0x10) = stop ? 1<<1 : 1<<(1+16); // GPIOA->BSRR
+}
+
+static UartBridge* bridgeActive;
+
+// all the bridge's interrupts end up here, to poll both directions
+void bridgeIrq () {
+    uint32_t isr = MMIO32(bridgeDma+0x00); // DMA->ISR
+    MMIO32(bridgeDma+0x04) = isr & (0xFFFF<<12); // DMA->IFCR, channels 4..7
+    bool idle1 = MMIO32(bridgeUart1+0x00) & (1<<4); // USART->SR & IDLE
+    if (idle1)
+        (void) MMIO32(bridgeUart1+0x04); // reading DR clears it
+    bool idle2 = MMIO32(bridgeUart2+0x00) & (1<<4);
+    if (idle2)
+        (void) MMIO32(bridgeUart2+0x04);
+    // a receive event is a half or full ring (HTIF, TCIF), or an idle line
+    bridgeActive->up.poll(idle1 || (isr & (0x6<<16)) != 0); // channel 5
+    bridgeActive->down.poll(idle2 || (isr & (0x6<<20)) != 0); // channel 6
+}
+
+// these all have the same priority, so the handler is never re-entered
+void bridgeIrqs (UartBridge* bridge) {
+    bridgeActive = bridge;
+    auto& vt = VTableRam();
+    vt.dma1_channel4 = vt.dma1_channel5 = bridgeIrq;
+    vt.dma1_channel6 = vt.dma1_channel7 = bridgeIrq;
+    vt.usart1 = vt.usart2 = bridgeIrq; // replaces the ones of UartBufDev
+    MMIO32(bridgeUart1+0x0C) |= 1<<4; // USART->CR1 |= IDLEIE
+    MMIO32(bridgeUart2+0x0C) |= 1<<4;
+    MMIO32(0xE000E100) = 0xF<<14; // NVIC->ISER[0], DMA1 channels 4..7
+    MMIO32(0xE000E104) = 0x3<<5;  // NVIC->ISER[1], USART1 and USART2
+}
+#endif
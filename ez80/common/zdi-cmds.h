@@ -70,9 +70,16 @@
             memoryTest(0x200000, 0x1000, 1<<i);
         }
         break;
+    case 'A': { // test address lines of external 512..2048 KB ram
+        uint32_t bad = memAddrTest(0x200000, 0x200000);
+        if (bad)
+            printf("address lines *FAILED*: %06x\n", bad);
+        else
+            printf("address lines OK\n");
+        break;
+    }
     case 'N': // no wait states for external ram (default is 7)
-        zIns(0x3E,0x08); // ld a,08h
-        zIns(0xED, 0x39, 0xAA); // out0 (0AAh),a
+        zdiScript(zsNoWaits);
         break;
 
     case 'm': { // memory dump
@@ -0,0 +1,175 @@
+// CRC32 checks of eZ80 memory, computed by the eZ80 itself
+//
+// Instead of reading memory back over ZDI, a small ADL-mode routine computes a
+// CRC32 per block of memory, and only those 4-byte results are read back. The
+// routine and its tables (4 x 256 bytes, one per CRC byte) are stored at the
+// top of the on-chip ram, with the stack and results just below. This is used
+// by crcSync to bring a ram disk up to date by rewriting only the blocks which
+// differ, so that after a warm restart hardly anything needs to be sent.
+
+constexpr int CRC_DONE = 0x4D;      // offset of the final "jr $" in crcCode
+constexpr int CRC_BLOCK = 4096;     // block size used by crcSync
+constexpr int CRC_MAX = 128;        // max number of blocks per crcRun call
+
+// ix = data, iy = results, hl = tables, bc = end of results, de = block size
+static const uint8_t crcCode [] = {
+    0xC5,                   // 00         push bc           ; end of results
+    0xD5,                   // 01         push de
+    0xD9,                   // 02         exx
+    0xD1,                   // 03         pop de            ; de' = block size
+    0xD9,                   // 04         exx
+    0xD9,                   // 05 block:  exx
+    0xD5,                   // 06         push de
+    0xC1,                   // 07         pop bc            ; bc' = count
+    0xD9,                   // 08         exx
+    0x01, 0xFF, 0xFF, 0xFF, // 09         ld bc,0FFFFFFh    ; crc in bcde
+    0x51,                   // 0D         ld d,c
+    0x59,                   // 0E         ld e,c
+    0xDD, 0x7E, 0x00,       // 0F byte:   ld a,(ix+0)
+    0xDD, 0x23,             // 12         inc ix
+    0xAB,                   // 14         xor e
+    0x6F,                   // 15         ld l,a            ; table index
+    0x7E,                   // 16         ld a,(hl)
+    0xAA,                   // 17         xor d
+    0x5F,                   // 18         ld e,a
+    0x24,                   // 19         inc h
+    0x7E,                   // 1A         ld a,(hl)
+    0xA9,                   // 1B         xor c
+    0x57,                   // 1C         ld d,a
+    0x24,                   // 1D         inc h
+    0x7E,                   // 1E         ld a,(hl)
+    0xA8,                   // 1F         xor b
+    0x4F,                   // 20         ld c,a
+    0x24,                   // 21         inc h
+    0x46,                   // 22         ld b,(hl)
+    0x25, 0x25, 0x25,       // 23         dec h (3x)
+    0xD9,                   // 26         exx
+    0x0B,                   // 27         dec bc
+    0x78,                   // 28         ld a,b
+    0xB1,                   // 29         or c
+    0xD9,                   // 2A         exx
+    0x20, 0xE2,             // 2B         jr nz,byte
+    0xFD, 0x73, 0x00,       // 2D         ld (iy+0),e
+    0xFD, 0x72, 0x01,       // 30         ld (iy+1),d
+    0xFD, 0x71, 0x02,       // 33         ld (iy+2),c
+    0xFD, 0x70, 0x03,       // 36         ld (iy+3),b
+    0xFD, 0x23, 0xFD, 0x23, // 39         inc iy (2x)
+    0xFD, 0x23, 0xFD, 0x23, // 3D         inc iy (2x)
+    0xD1,                   // 41         pop de
+    0xD5,                   // 42         push de
+    0xE5,                   // 43         push hl
+    0xFD, 0xE5,             // 44         push iy
+    0xE1,                   // 46         pop hl
+    0xB7,                   // 47         or a
+    0xED, 0x52,             // 48         sbc hl,de         ; all done?
+    0xE1,                   // 4A         pop hl
+    0x20, 0xB8,             // 4B         jr nz,block
+    0x18, 0xFE,             // 4D done:   jr done
+};
+
+static uint32_t crcTable [256];
+
+// the usual CRC32, as used by zlib, start with crc = 0
+uint32_t crc32 (uint32_t crc, const void* ptr, unsigned len) {
+    if (crcTable[1] == 0)
+        for (int i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int j = 0; j < 8; ++j)
+                c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            crcTable[i] = c;
+        }
+    crc = ~crc;
+    for (unsigned i = 0; i < len; ++i)
+        crc = crcTable[(crc ^ ((const uint8_t*) ptr)[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+// send the code and tables, ramTop must be a multiple of 256
+void crcLoad (uint32_t ramTop) {
+    crc32(0, 0, 0); // fill in crcTable
+    uint8_t buf [256];
+    zCmd(0x08); // set ADL
+    for (int n = 0; n < 4; ++n) {
+        for (int i = 0; i < 256; ++i)
+            buf[i] = crcTable[i] >> (8*n);
+        writeMem(ramTop - 0x400 + 0x100*n, buf, sizeof buf);
+    }
+    writeMem(ramTop - 0x480, crcCode, sizeof crcCode);
+}
+
+// get the CRC32's of count consecutive blocks of up to 64 KB each, crcLoad
+// must have been called first, returns false if the code didn't finish
+bool crcRun (uint32_t addr, unsigned size, unsigned count, uint32_t* crcs,
+                uint32_t ramTop) {
+    uint32_t code = ramTop - 0x480;
+    uint32_t results = code - 0x40 - 4*CRC_MAX;
+    zCmd(0x08); // set ADL
+    setReg(0x84, addr); // IX
+    setReg(0x85, results); // IY
+    setReg(0x83, ramTop - 0x400); // HL
+    setReg(0x81, results + 4*count); // BC
+    setReg(0x82, size); // DE
+    setReg(0x86, code); // SP, the stack grows down from the code
+    setPC(code);
+    if (!runUntil(code + CRC_DONE, 5000))
+        return false;
+    readMem(results, crcs, 4*count); // little-endian, as on ARM
+    for (unsigned i = 0; i < count; ++i)
+        crcs[i] = ~crcs[i];
+    return true;
+}
+
+// make the ram at dst match an image of len bytes, rewriting the 4 KB blocks
+// which differ, the last block only covers the rest of the image, so nothing
+// past its end is touched, file must have ioSect()
+// returns the number of blocks written, or -1 if the result can't be verified
+template< typename F >
+int crcSync (F& file, int len, uint32_t dst, uint32_t ramTop) {
+    static uint32_t want [CRC_MAX], have [CRC_MAX];
+    constexpr int SECTS = CRC_BLOCK / 512;
+    uint8_t buf [512];
+    int written = 0;
+
+    // read sector n of the image, returns the number of bytes in it
+    auto getSect = [&](int n) {
+        int pos = n * 512;
+        if (!file.ioSect(false, n, buf))
+            printf("? fat map error at %d\n", pos);
+        return len - pos < 512 ? len - pos : 512;
+    };
+
+    crcLoad(ramTop);
+    int blocks = (len + CRC_BLOCK - 1) / CRC_BLOCK;
+    int full = len / CRC_BLOCK;
+    for (int first = 0, n; first < blocks; first += n) {
+        // full blocks go in groups, a final partial one is checked on its own
+        int size = first < full ? CRC_BLOCK : len - first * CRC_BLOCK;
+        n = first >= full ? 1 : full - first < CRC_MAX ? full - first : CRC_MAX;
+        int sects = (size + 511) / 512;
+        uint32_t addr = dst + first * CRC_BLOCK;
+        if (!crcRun(addr, size, n, have, ramTop))
+            return -1;
+
+        bool changed = false;
+        for (int b = 0; b < n; ++b) {
+            uint32_t crc = 0;
+            for (int s = 0; s < sects; ++s)
+                crc = crc32(crc, buf, getSect((first + b) * SECTS + s));
+            want[b] = crc;
+            if (have[b] != crc) {
+                for (int s = 0; s < sects; ++s) {
+                    int k = getSect((first + b) * SECTS + s);
+                    writeMem(addr + b * CRC_BLOCK + s * 512, buf, k);
+                }
+                ++written;
+                changed = true;
+            }
+        }
+
+        // anything written is checked again, on the eZ80
+        if (changed && (!crcRun(addr, size, n, have, ramTop) ||
+                            memcmp(have, want, 4*n) != 0))
+            return -1;
+    }
+    return written;
+}
@@ -0,0 +1,165 @@
+// Block device service for the eZ80, served from a disk image on the SD card
+//
+// The eZ80's driver fills in a request in a mailbox in its own memory, and then
+// calls the "bell" address. This address is set as ZDI breakpoint, so the call
+// puts the eZ80 in break mode, which poll() notices by reading ZDI_STAT. The
+// STM32 reads the request, moves the data between the image and the eZ80's
+// memory with readMem and writeMem, writes back the status, and then does the
+// "ret" for the eZ80: the return address is popped off its stack, and the eZ80
+// continues after its call, with the request done. The eZ80 never has to poll.
+//
+// Requests are for up to 255 consecutive 512-byte blocks. The CRC32 of all the
+// data is returned for reads, and checked for writes unless it's zero. A write
+// with a bad CRC has already been written to the image: sending the request
+// again fixes that. Writes go straight through to the SD card, there is no
+// write-back, but the last few blocks are also kept in a small LRU cache.
+//
+// The mailbox and bell must be in the 64 KB bank of MBASE if the driver runs
+// in Z80 mode. Their addresses are 24-bit, as is the buffer address.
+
+constexpr int DISK_CMD = 0;     // 'R' or 'W', cleared when the request is done
+constexpr int DISK_COUNT = 1;   // number of 512-byte blocks
+constexpr int DISK_STATUS = 2;  // one of the DISK_OK .. DISK_CRC codes
+constexpr int DISK_BLOCK = 4;   // 32-bit block number in the image
+constexpr int DISK_ADDR = 8;    // 24-bit buffer address in eZ80 memory
+constexpr int DISK_CRCS = 12;   // 32-bit CRC32 of the data
+constexpr int DISK_REQ = 16;    // size of the mailbox
+
+enum { DISK_OK, DISK_BAD, DISK_IO, DISK_CRC };
+
+template< typename F, int N =8 >
+struct DiskServer {
+    F& file;                    // must have ioSect(), as FileMap
+    int sects;                  // size of the image, in 512-byte blocks
+    uint32_t mbox, bell;        // mailbox and bell addresses in eZ80 memory
+    uint32_t reqs, blocks, hits, errors; // totals since init
+
+    DiskServer (F& f) : file (f), sects (0) {}
+
+    // start serving the image of len bytes, this leaves the eZ80 running
+    void init (int len, uint32_t mb, uint32_t bl) {
+        sects = len / 512;
+        mbox = mb;
+        bell = bl;
+        reqs = blocks = hits = errors = 0;
+        for (auto& e : cache) {
+            e.sect = -1;
+            e.used = 0;
+        }
+        stamp = 0;
+        uint8_t addr [] = { (uint8_t) bell, (uint8_t) (bell >> 8),
+                            (uint8_t) (bell >> 16) };
+        zdiOutBlock(0x00, addr, sizeof addr); // ZDI_ADDR0_L/H/U
+        zdiOut(0x10, 0x08); // ZDI_BRK_CTL = BRK_ADDR0, continue
+    }
+
+    // serve a request if the eZ80 is waiting for one, returns true if it was
+    bool poll () {
+        uint8_t stat = zdiIn(0x03); // ZDI_STAT
+        if ((stat & 0x80) == 0) // not in break mode
+            return false;
+        bool adl = stat & 0x10;
+        uint32_t pc = getPC(), sp = getReg(0x06); // SPL or SPS, as per mode
+        uint32_t bank = getMbase() << 16;
+        if (!adl) {
+            pc = bank | (pc & 0xFFFF);
+            sp = bank | (sp & 0xFFFF);
+        }
+        if (pc != bell)
+            return false; // not stopped by the driver, leave it alone
+
+        zCmd(0x08); // set ADL
+        uint8_t req [DISK_REQ];
+        readMem(mbox, req, sizeof req);
+        serve(req);
+        writeMem(mbox, req, sizeof req);
+
+        // return from the call to the bell, with a 3- or 2-byte address
+        uint8_t ret [3] = { 0, 0, 0 };
+        readMem(sp, ret, adl ? 3 : 2);
+        if (!adl)
+            zCmd(0x09); // reset ADL
+        setReg(0x86, sp + (adl ? 3 : 2)); // SP
+        setPC((ret[2] << 16) | (ret[1] << 8) | ret[0]);
+        zdiOut(0x10, 0x08); // continue, with the bell still as breakpoint
+        return true;
+    }
+
+private:
+    struct {
+        int sect;               // block in this entry, or -1
+        uint32_t used;          // stamp of the last use, for LRU
+        uint8_t data [512];
+    } cache [N];
+    uint32_t stamp;
+
+    static uint32_t get32 (uint8_t const* p) {
+        return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+    }
+
+    // the cache entry for a block, which is read in if load is set, returns 0
+    // if that fails, a new entry replaces the least recently used one
+    uint8_t* entry (int sect, bool load) {
+        int lru = 0;
+        for (int i = 0; i < N; ++i) {
+            if (cache[i].sect == sect) {
+                cache[i].used = ++stamp;
+                hits += load;
+                return cache[i].data;
+            }
+            if (cache[i].used < cache[lru].used)
+                lru = i;
+        }
+        auto& e = cache[lru];
+        e.sect = -1;
+        if (load && !file.ioSect(false, sect, e.data))
+            return 0;
+        e.sect = sect;
+        e.used = ++stamp;
+        return e.data;
+    }
+
+    // handle one request, and fill in its status and CRC
+    void serve (uint8_t* req) {
+        uint8_t cmd = req[DISK_CMD];
+        int count = req[DISK_COUNT];
+        uint32_t block = get32(req + DISK_BLOCK);
+        uint32_t addr = get32(req + DISK_ADDR) & 0xFFFFFF;
+        uint32_t want = get32(req + DISK_CRCS), crc = 0;
+        uint8_t status = DISK_OK;
+        ++reqs;
+
+        if ((cmd != 'R' && cmd != 'W') || count == 0 ||
+                block > (uint32_t) sects || count > sects - (int) block)
+            status = DISK_BAD;
+        for (int i = 0; status == DISK_OK && i < count; ++i) {
+            uint8_t* p = entry(block + i, cmd == 'R');
+            if (cmd == 'R') {
+                if (p == 0) {
+                    status = DISK_IO;
+                    break;
+                }
+                writeMem(addr + 512*i, p, 512);
+            } else {
+                readMem(addr + 512*i, p, 512);
+                if (!file.ioSect(true, block + i, p)) {
+                    for (auto& e : cache)
+                        if (e.data == p)
+                            e.sect = -1; // no longer matches the image
+                    status = DISK_IO;
+                    break;
+                }
+            }
+            crc = crc32(crc, p, 512);
+            ++blocks;
+        }
+        if (status == DISK_OK && cmd == 'W' && want != 0 && crc != want)
+            status = DISK_CRC;
+        errors += status != DISK_OK;
+
+        req[DISK_CMD] = 0;
+        req[DISK_STATUS] = status;
+        for (int i = 0; i < 4; ++i)
+            req[DISK_CRCS+i] = crc >> (8*i);
+    }
+};
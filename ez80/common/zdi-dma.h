@@ -0,0 +1,191 @@
+// Fast ZDI transport, for the data bursts of readMem and writeMem
+//
+// Each burst is encoded as a list of GPIO BSRR words, one per half period of
+// ZCL, which TIM2 then clocks out to the port through DMA. For reads, a second
+// DMA channel samples the port's input register once per half period as well.
+// This is done in chunks, so that the next chunk can be encoded (or the last
+// one decoded) while the DMA is busy, and writes return as soon as the final
+// chunk has started: zdiIdle() waits for it before the pins are used again.
+//
+// This assumes a Wide Pill, i.e. an STM32F103 with ZDA on PB2 and ZCL on PB4.
+// It uses DMA1 channels 1 and 2, which leaves 4..7 free for uart-bridge.h.
+// A NATIVE build has to provide zdiStream() and zdiStreamWait() itself.
+//
+// On an ESP32 (also when NATIVE, to test it), the same words are played out by
+// the CPU instead, through the GPIO set and clear registers, see below. ZDI is
+// fully synchronous, so this loop can be interrupted at any time, it only has
+// to keep ZCL slow enough: each edge waits ZDI_HALF cycles after the previous
+// one, not after where the previous one should have been.
+
+#ifndef ZDI_HALF
+#if ESP32
+#define ZDI_HALF 240 // CPU cycles per half period, i.e. 500 kHz @ 240 MHz
+#else
+#define ZDI_HALF 8  // TIM2 ticks per half period of ZCL, i.e. 4.5 MHz @ 72 MHz
+#endif
+#endif
+
+constexpr int ZDI_CHUNK = 16;   // bytes encoded per DMA transfer
+constexpr int ZDI_WORDS = 18;   // BSRR words per byte, incl separator bit
+constexpr int ZDA_BIT = 2, ZCL_BIT = 4;
+
+constexpr uint32_t ZCL_LO = 1 << (ZCL_BIT+16), ZCL_HI = 1 << ZCL_BIT;
+constexpr uint32_t ZDA_LO = 1 << (ZDA_BIT+16), ZDA_HI = 1 << ZDA_BIT;
+
+static uint32_t zdiWave [2][ZDI_CHUNK*ZDI_WORDS];
+static uint8_t zdiSamples [2][ZDI_CHUNK*ZDI_WORDS];
+
+#if ESP32
+constexpr uint32_t zdiOutSet = 0x3FF44008;  // GPIO_OUT_W1TS_REG
+constexpr uint32_t zdiOutClr = 0x3FF4400C;  // GPIO_OUT_W1TC_REG
+constexpr uint32_t zdiGpioIn = 0x3FF4403C;  // GPIO_IN_REG
+
+// send count words, one per ZDI_HALF CPU cycles, also sampling ZDA at the end
+// of each half period if samples is set, this returns when all is done
+void zdiStream (uint32_t const* words, int count, uint8_t* samples) {
+    static_assert(decltype(ZCL)::pin < 32 && decltype(ZDA)::pin < 32,
+                    "ZCL and ZDA must be on GPIO 0..31");
+    constexpr uint32_t zcl = 1 << decltype(ZCL)::pin;
+    constexpr uint32_t zda = 1 << decltype(ZDA)::pin;
+    uint32_t t = ESP.getCycleCount();
+    for (int i = 0; i < count; ++i) {
+        uint32_t w = words[i];
+        // clear first, so ZDA only changes once ZCL is low
+        if (w & (ZCL_LO | ZDA_LO))
+            MMIO32(zdiOutClr) = (w & ZCL_LO ? zcl : 0) | (w & ZDA_LO ? zda : 0);
+        if (w & (ZCL_HI | ZDA_HI))
+            MMIO32(zdiOutSet) = (w & ZCL_HI ? zcl : 0) | (w & ZDA_HI ? zda : 0);
+        t += ZDI_HALF;
+        uint32_t now;
+        while ((int32_t) ((now = ESP.getCycleCount()) - t) < 0) {}
+        t = now; // later than planned after an interrupt, don't catch up
+        if (samples)
+            samples[i] = MMIO32(zdiGpioIn) & zda ? 1 << ZDA_BIT : 0;
+    }
+}
+
+void zdiStreamWait () {}
+#elif NATIVE
+void zdiStream (uint32_t const* words, int count, uint8_t* samples);
+void zdiStreamWait ();
+#else
+constexpr uint32_t zdiTim = 0x40000000;   // TIM2
+constexpr uint32_t zdiDma = 0x40020000;   // DMA1
+constexpr uint32_t zdiDmaTx = zdiDma + 0x08 + 20*1; // channel 2, TIM2_UP
+constexpr uint32_t zdiDmaRx = zdiDma + 0x08 + 20*0; // channel 1, TIM2_CH3
+constexpr uint32_t zdiGpio = 0x40010C00;  // GPIOB
+
+// start sending count words to BSRR, also sampling IDR if samples is set
+void zdiStream (uint32_t const* words, int count, uint8_t* samples) {
+    static bool inited;
+    if (!inited) {
+        MMIO32(0x40021014) |= 1<<0; // RCC->AHBENR |= DMA1EN
+        MMIO32(0x4002101C) |= 1<<0; // RCC->APB1ENR |= TIM2EN
+        MMIO32(zdiTim+0x2C) = ZDI_HALF - 1; // TIM2->ARR
+        MMIO32(zdiTim+0x3C) = ZDI_HALF / 2; // TIM2->CCR3, mid-way samples
+        inited = true;
+    }
+    MMIO32(zdiDmaTx) = 0; // disable both channels, so they can be set up
+    MMIO32(zdiDmaRx) = 0;
+    MMIO32(zdiDma+0x04) = (0xF<<4) | (0xF<<0); // DMA->IFCR, clear 2 and 1
+
+    MMIO32(zdiDmaTx+0x04) = count;            // CNDTR
+    MMIO32(zdiDmaTx+0x08) = zdiGpio + 0x10;   // CPAR = GPIOB->BSRR
+    MMIO32(zdiDmaTx+0x0C) = (uint32_t) words; // CMAR
+    // high prio, 32-bit mem & periph, mem incr, mem-to-periph, enable
+    MMIO32(zdiDmaTx) = (2<<12) | (2<<10) | (2<<8) | (1<<7) | (1<<4) | (1<<0);
+    uint32_t dier = 1<<8; // UDE
+
+    if (samples) {
+        MMIO32(zdiDmaRx+0x04) = count;             // CNDTR
+        MMIO32(zdiDmaRx+0x08) = zdiGpio + 0x08;    // CPAR = GPIOB->IDR
+        MMIO32(zdiDmaRx+0x0C) = (uint32_t) samples; // CMAR
+        // high prio, 8-bit mem, 32-bit periph, mem incr, periph-to-mem, enable
+        MMIO32(zdiDmaRx) = (2<<12) | (0<<10) | (2<<8) | (1<<7) | (1<<0);
+        dier |= 1<<11; // CC3DE
+    }
+
+    MMIO32(zdiTim+0x0C) = dier; // TIM2->DIER
+    MMIO32(zdiTim+0x14) = 1<<0; // TIM2->EGR = UG, sends the first word now
+    MMIO32(zdiTim+0x00) = 1<<0; // TIM2->CR1 = CEN
+}
+
+// wait for the current transfer to finish, then stop the timer
+void zdiStreamWait () {
+    if (MMIO32(zdiTim+0x00) & (1<<0)) {
+        uint32_t done = (1<<5) | (MMIO32(zdiDmaRx) & (1<<0) ? 1<<1 : 0);
+        while ((MMIO32(zdiDma+0x00) & done) != done) {} // TCIF2 & TCIF1
+        MMIO32(zdiTim+0x00) = 0;
+    }
+}
+#endif
+
+static void zdiIdle () {
+    zdiStreamWait();
+}
+
+// encode one byte, with ZDA changing on the falling edge of ZCL
+static uint32_t* zdiEncode (uint32_t* wp, uint8_t b, bool last) {
+    for (int i = 0; i < 8; ++i) {
+        *wp++ = ZCL_LO | (b & 0x80 ? ZDA_HI : ZDA_LO);
+        *wp++ = ZCL_HI;
+        b <<= 1;
+    }
+    *wp++ = ZCL_LO | (last ? ZDA_HI : ZDA_LO);
+    *wp++ = ZCL_HI;
+    return wp;
+}
+
+// encode the clocks to read one byte, ZDA only changes for the separator
+static uint32_t* zdiClocks (uint32_t* wp, bool last) {
+    for (int i = 0; i < 8; ++i) {
+        *wp++ = ZCL_LO;
+        *wp++ = ZCL_HI;
+    }
+    *wp++ = ZCL_LO | (last ? ZDA_HI : ZDA_LO);
+    *wp++ = ZCL_HI;
+    return wp;
+}
+
+// extract the bytes read, using the samples taken while ZCL was high
+static void zdiDecode (uint8_t const* samples, uint8_t* ptr, unsigned len) {
+    for (unsigned i = 0; i < len; ++i) {
+        uint8_t b = 0;
+        for (int j = 0; j < 8; ++j)
+            b = (b << 1) | ((samples[2*j+1] >> ZDA_BIT) & 1);
+        ptr[i] = b;
+        samples += ZDI_WORDS;
+    }
+}
+
+static void zdiOutBurst (const uint8_t* ptr, unsigned len) {
+    for (int buf = 0; len > 0; buf ^= 1) {
+        unsigned n = len < ZDI_CHUNK ? len : ZDI_CHUNK;
+        uint32_t* wp = zdiWave[buf];
+        for (unsigned i = 0; i < n; ++i)
+            wp = zdiEncode(wp, ptr[i], i >= len-1);
+        zdiStreamWait();
+        zdiStream(zdiWave[buf], wp - zdiWave[buf], 0);
+        ptr += n;
+        len -= n;
+    }
+}
+
+static void zdiInBurst (uint8_t* ptr, unsigned len) {
+    uint8_t* prev = 0; // the previous chunk, it still needs to be decoded
+    unsigned prevLen = 0;
+    for (int buf = 0; len > 0 || prevLen > 0; buf ^= 1) {
+        unsigned n = len < ZDI_CHUNK ? len : ZDI_CHUNK;
+        uint32_t* wp = zdiWave[buf];
+        for (unsigned i = 0; i < n; ++i)
+            wp = zdiClocks(wp, i >= len-1);
+        zdiStreamWait();
+        if (n > 0)
+            zdiStream(zdiWave[buf], wp - zdiWave[buf], zdiSamples[buf]);
+        zdiDecode(zdiSamples[buf^1], prev, prevLen);
+        prev = ptr;
+        prevLen = n;
+        ptr += n;
+        len -= n;
+    }
+}
@@ -0,0 +1,100 @@
+// Packed uploads, which are unpacked by the eZ80 itself
+//
+// Images are packed at build time by lzpack.py, see there for the format. The
+// packed data is sent via ZDI, along with the small ADL-mode routine below,
+// which then unpacks it at full speed. The packed data is stored such that it
+// ends "slack" bytes past the end of the unpacked image, so that the image can
+// be unpacked in place, and no ram beyond that is used, other than the on-chip
+// ram for this code and its stack.
+
+constexpr int LZ_HDR = 6;           // header size: unpacked length, slack
+constexpr int LZ_DONE = 0x33;       // offset of the final "jr $" in lzCode
+constexpr int LZ_GETLEN = 0x35;     // offset of the getlen routine in lzCode
+
+// hl = packed stream, de = destination, sp = stack, ends in a tight loop
+static const uint8_t lzCode [] = {
+    0x7E,                   // 00 loop:   ld a,(hl)         ; token
+    0x23,                   // 01         inc hl
+    0xF5,                   // 02         push af
+    0x0F, 0x0F, 0x0F, 0x0F, // 03         rrca (4x)
+    0xE6, 0x0F,             // 07         and 0Fh
+    0x28, 0x06,             // 09         jr z,nolit
+    0xCD, 0, 0, 0,          // 0B         call getlen
+    0xED, 0xB0,             // 0F         ldir              ; literals
+    0x01, 0x00, 0x00, 0x00, // 11 nolit:  ld bc,0
+    0x4E,                   // 15         ld c,(hl)
+    0x23,                   // 16         inc hl
+    0x46,                   // 17         ld b,(hl)
+    0x23,                   // 18         inc hl
+    0x78,                   // 19         ld a,b
+    0xB1,                   // 1A         or c
+    0x28, 0x16,             // 1B         jr z,done         ; offset 0
+    0xF1,                   // 1D         pop af
+    0xE5,                   // 1E         push hl
+    0xD5,                   // 1F         push de
+    0xE1,                   // 20         pop hl
+    0xB7,                   // 21         or a
+    0xED, 0x42,             // 22         sbc hl,bc         ; match source
+    0xE3,                   // 24         ex (sp),hl
+    0xCD, 0, 0, 0,          // 25         call getlen
+    0x03, 0x03, 0x03, 0x03, // 29         inc bc (4x)
+    0xE3,                   // 2D         ex (sp),hl
+    0xED, 0xB0,             // 2E         ldir              ; match
+    0xE1,                   // 30         pop hl
+    0x18, 0xCD,             // 31         jr loop
+    0x18, 0xFE,             // 33 done:   jr done
+    0xE6, 0x0F,             // 35 getlen: and 0Fh
+    0x01, 0x00, 0x00, 0x00, // 37         ld bc,0
+    0x4F,                   // 3B         ld c,a
+    0xFE, 0x0F,             // 3C         cp 0Fh
+    0xC0,                   // 3E         ret nz
+    0x7E,                   // 3F more:   ld a,(hl)
+    0x23,                   // 40         inc hl
+    0xE5,                   // 41         push hl
+    0x21, 0x00, 0x00, 0x00, // 42         ld hl,0
+    0x6F,                   // 46         ld l,a
+    0x09,                   // 47         add hl,bc
+    0xE5,                   // 48         push hl
+    0xC1,                   // 49         pop bc
+    0xE1,                   // 4A         pop hl
+    0x3C,                   // 4B         inc a             ; was it 255?
+    0x28, 0xF1,             // 4C         jr z,more
+    0xC9,                   // 4E         ret
+};
+
+// where to store packed data, given its header, so it can be unpacked in place
+uint32_t lzStaging (uint32_t dst, const uint8_t* hdr, uint32_t packedLen) {
+    uint32_t size = hdr[0] | (hdr[1] << 8) | (hdr[2] << 16);
+    uint32_t slack = hdr[3] | (hdr[4] << 8) | (hdr[5] << 16);
+    return dst + size + slack - packedLen;
+}
+
+// unpack the data at src (which starts with its header) to dst, using the top
+// of the on-chip ram for the code and stack, returns false if it didn't finish
+bool lzUnpack (uint32_t dst, uint32_t src, uint32_t ramTop) {
+    uint32_t code = ramTop - sizeof lzCode;
+    uint8_t buf [sizeof lzCode];
+    memcpy(buf, lzCode, sizeof buf);
+    static const int calls [] = { 0x0C, 0x26 }; // patch the two getlen calls
+    for (int pos : calls) {
+        buf[pos] = code + LZ_GETLEN;
+        buf[pos+1] = (code + LZ_GETLEN) >> 8;
+        buf[pos+2] = (code + LZ_GETLEN) >> 16;
+    }
+
+    zCmd(0x08); // set ADL
+    writeMem(code, buf, sizeof buf);
+    setReg(0x83, src + LZ_HDR); // HL
+    setReg(0x82, dst); // DE
+    setReg(0x86, code); // SP, the stack grows down from the code
+    setPC(code);
+    return runUntil(code + LZ_DONE, 5000);
+}
+
+// upload a packed image from memory and unpack it on the eZ80
+bool lzUpload (uint32_t dst, const uint8_t* packed, uint32_t len, uint32_t ramTop) {
+    uint32_t src = lzStaging(dst, packed, len);
+    zCmd(0x08); // set ADL
+    writeMem(src, packed, len);
+    return lzUnpack(dst, src, ramTop);
+}
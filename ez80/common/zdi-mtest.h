@@ -0,0 +1,195 @@
+// Memory tests, with the test patterns generated and checked by the eZ80
+//
+// The patterns are the same as before: each 64 KB bank gets bytes from the LCG
+// in seedBuf, masked to test only some bits. Instead of sending each byte over
+// ZDI and reading it back, a small ADL-mode routine in the top of the on-chip
+// ram writes and checks them, and stops at the first mismatch. Only then is
+// the failing 256-byte block read back over ZDI, to show what went wrong.
+//
+// The LCG's output is bits 8..15 of its 32-bit state, which only depend on the
+// lower 16 bits of that state, so the eZ80 can use a 16-bit version of it:
+// seed * 0x4E35 + 1, done with three 8x8-bit "mlt" multiplies.
+
+constexpr int MT_MASK = 0x06;       // offset of the bit mask in mtCode
+constexpr int MT_WRITE = 0x07;      // offset of the 3-byte store instruction
+constexpr int MT_DONE = 0x2C;       // offset of the final "jr $" in mtCode
+constexpr uint32_t MT_CODE = 0xFFFF80; // where the code goes, on-chip ram
+constexpr uint32_t MT_TIMEOUT = ~0u;   // returned in bad if the code never ends
+
+// the eZ80's clock in MHz, the SLOW builds run it from a 4 MHz clock
+#ifndef EZ_MHZ
+#if SLOW
+#define EZ_MHZ 4
+#else
+#define EZ_MHZ 36
+#endif
+#endif
+
+// ix = address, de = seed, c = number of 256-byte pages (0 = 256), ends with
+// the Z flag set if all is well, else ix points to the first bad byte
+static const uint8_t mtCode [] = {
+    0xC5,                   // 00         push bc
+    0xD9,                   // 01         exx
+    0xC1,                   // 02         pop bc            ; b' = 0, c' = pages
+    0xD9,                   // 03 loop:   exx
+    0x7A,                   // 04         ld a,d
+    0xE6, 0xFF,             // 05         and mask
+    0xDD, 0x77, 0x00,       // 07         ld (ix+0),a       ; or 3x nop
+    0xDD, 0xBE, 0x00,       // 0A         cp (ix+0)
+    0x20, 0x1D,             // 0D         jr nz,done
+    0xDD, 0x23,             // 0F         inc ix
+    0x62,                   // 11         ld h,d
+    0x2E, 0x35,             // 12         ld l,35h
+    0xED, 0x6C,             // 14         mlt hl
+    0x43,                   // 16         ld b,e
+    0x0E, 0x4E,             // 17         ld c,4Eh
+    0xED, 0x4C,             // 19         mlt bc
+    0x7D,                   // 1B         ld a,l
+    0x81,                   // 1C         add a,c
+    0x63,                   // 1D         ld h,e
+    0x2E, 0x35,             // 1E         ld l,35h
+    0xED, 0x6C,             // 20         mlt hl
+    0x84,                   // 22         add a,h
+    0x57,                   // 23         ld d,a
+    0x5D,                   // 24         ld e,l
+    0x13,                   // 25         inc de            ; next seed
+    0xD9,                   // 26         exx
+    0x10, 0xDA,             // 27         djnz loop
+    0x0D,                   // 29         dec c
+    0x20, 0xD7,             // 2A         jr nz,loop
+    0x18, 0xFE,             // 2C done:   jr done
+};
+
+// write (and read back) or only check len bytes at addr on the eZ80, len must
+// be a multiple of 256 and at most 64 KB, returns false with the address of the
+// first mismatch in bad if there is one, or with MT_TIMEOUT if the code hung
+bool memPassRun (uint32_t addr, uint32_t len, uint32_t seed, uint8_t mask,
+                    bool fill, uint32_t& bad) {
+    static const uint8_t store [] = { 0xDD, 0x77, 0x00 };
+    uint8_t buf [sizeof mtCode];
+    memcpy(buf, mtCode, sizeof buf);
+    buf[MT_MASK] = mask;
+    for (int i = 0; i < 3; ++i)
+        buf[MT_WRITE+i] = fill ? store[i] : 0x00;
+
+    zCmd(0x08); // set ADL
+    writeMem(MT_CODE, buf, sizeof buf);
+    setReg(0x84, addr); // IX
+    setReg(0x82, seed); // DE
+    setReg(0x81, (len >> 8) & 0xFF); // BC, b = 0 for 256 bytes per page
+    setReg(0x86, MT_CODE); // SP, the stack grows down from the code
+    setPC(MT_CODE);
+    // allow for 256 clock cycles per byte, about twice what external ram needs
+    if (!runUntil(MT_CODE + MT_DONE, 1000 + len / (4 * EZ_MHZ))) {
+        bad = MT_TIMEOUT;
+        return false;
+    }
+    bad = getReg(0x04); // IX
+    return (getReg(0x00) & 0x40) != 0; // Z flag
+}
+
+// the same, but done over ZDI, for ram which overlaps the code of memPassRun
+bool memPassZdi (uint32_t addr, uint32_t len, uint32_t seed, uint8_t mask,
+                    bool fill, uint32_t& bad) {
+    uint8_t wrBuf [1<<8], rdBuf [1<<8];
+    for (uint32_t offset = 0; offset < len; offset += 1<<8) {
+        seed = seedBuf(seed, mask, wrBuf, sizeof wrBuf);
+        if (fill) {
+            writeMem(addr+offset, wrBuf, sizeof wrBuf);
+            continue;
+        }
+        readMem(addr+offset, rdBuf, sizeof rdBuf);
+        for (unsigned i = 0; i < sizeof wrBuf; ++i)
+            if (wrBuf[i] != rdBuf[i]) {
+                bad = addr + offset + i;
+                return false;
+            }
+    }
+    return true;
+}
+
+// read back the block with the first bad byte, and show what's wrong with it
+void memShowFail (uint32_t addr, uint32_t bad, uint32_t seed, uint8_t mask) {
+    uint8_t wrBuf [1<<8], rdBuf [1<<8];
+    uint32_t block = addr + ((bad - addr) & ~0xFF);
+    for (uint32_t offset = addr; offset <= block; offset += 1<<8)
+        seed = seedBuf(seed, mask, wrBuf, sizeof wrBuf);
+    readMem(block, rdBuf, sizeof rdBuf);
+
+    printf(" *FAILED* in %04xxx", block >> 8);
+    // show differences
+    for (unsigned i = 0; i < sizeof wrBuf; ++i) {
+        if (i % 64 == 0)
+            printf("\n    %06x: ", block+i);
+        printf("%c", wrBuf[i] != rdBuf[i] ? '?' : '.');
+    }
+    if (mask != 0xFF) {
+        // show the bits which have been read as '1'
+        for (unsigned i = 0; i < sizeof wrBuf; ++i) {
+            if (i % 64 == 0)
+                printf("\n    %06x: ", block+i);
+            printf("%c", rdBuf[i] & mask ? '+' : ' ');
+        }
+    } else {
+        // show bytes as written and as read back
+        for (unsigned i = 0; i < sizeof rdBuf; ++i) {
+            if (i % 8 == 0)
+                printf("\n\t%06x:", block+i);
+            printf(" %02x:%02x", wrBuf[i], rdBuf[i]);
+        }
+    }
+    printf("\n");
+}
+
+bool memoryTest (uint32_t base, uint32_t size, uint8_t mask =0xFF) {
+    // the on-chip ram with the test code in it can only be tested over ZDI
+    auto pass = base + size > MT_CODE - 0x10 ? memPassZdi : memPassRun;
+    for (unsigned bank = 0; bank < 32; ++bank) {
+        unsigned addr = base + (bank<<16);
+        if (addr >= base + size)
+            break;
+        uint32_t len = base + size - addr < 1<<16 ? base + size - addr : 1<<16;
+
+        uint32_t seed = (bank+1) * mask, bad;
+        printf("%02xxxxx: %d ", addr >> 16, seed);
+        bool ok = pass(addr, len, seed, mask, true, bad);
+        printf(" => ");
+        if (!ok || !pass(addr, len, seed, mask, false, bad)) {
+            if (bad == MT_TIMEOUT)
+                printf(" *TIMEOUT*\n");
+            else
+                memShowFail(addr, bad, seed, mask);
+            return false;
+        }
+
+        uint8_t buf [1<<8];
+        for (uint32_t offset = 0; offset < len; offset += 1<<8)
+            seed = seedBuf(seed, mask, buf, sizeof buf);
+        printf(" %08x  OK\n", seed);
+    }
+    return true;
+}
+
+// check that each address line works, by storing a different value at each
+// power-of-two offset, returns the address bits which don't (0 if all is well)
+uint32_t memAddrTest (uint32_t base, uint32_t size) {
+    uint8_t v = 0;
+    writeMem(base, &v, 1);
+    for (uint32_t bit = 1; bit < size; bit <<= 1) {
+        ++v;
+        writeMem(base + bit, &v, 1);
+    }
+
+    // a value at base means the address bit for that value is stuck
+    uint32_t bad = 0;
+    readMem(base, &v, 1);
+    if (v != 0 && v <= 24)
+        bad |= 1 << (v-1);
+    uint8_t want = 0;
+    for (uint32_t bit = 1; bit < size; bit <<= 1) {
+        readMem(base + bit, &v, 1);
+        if (v != ++want)
+            bad |= bit;
+    }
+    return bad;
+}
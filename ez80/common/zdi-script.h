@@ -0,0 +1,74 @@
+// Batched ZDI scripts, for bring-up sequences shared by the ARM and ESP builds
+//
+// A script is a byte array of ops, each followed by its operands, written out
+// by hand with a comment per line, as with the eZ80 code in zdi-lz.h. The ops
+// map onto single ZDI transfers: an instruction goes into the instruction store
+// in one go, and so does a register write, i.e. the value plus the command. As
+// all of it is const data, it's fixed at build time and can live in flash.
+//
+// There's no ZDI path to MBASE which is known to work on the chip (see the
+// FIXME in setMbase), so scripts set it by injecting "ld mb,a" as well.
+
+constexpr uint8_t ZS_END = 0x00;    // end of the script
+constexpr uint8_t ZS_INS = 0x10;    // +n: inject n instruction bytes, n = 1..5
+constexpr uint8_t ZS_OUT = 0x20;    // +n: ZDI register, then n bytes for it
+constexpr uint8_t ZS_CMD = 0x30;    // ZDI_RW_CTL command, as for zCmd
+constexpr uint8_t ZS_SET = 0x40;    // CPU write command, then 3 bytes, LSB first
+constexpr uint8_t ZS_GET = 0x50;    // CPU read command, saved as next result
+constexpr uint8_t ZS_WAIT = 0x60;   // number of milliseconds to wait
+
+// a 24-bit value as 3 bytes, for ZS_SET
+#define ZS_24(v) (uint8_t) (v), (uint8_t) ((v) >> 8), (uint8_t) ((v) >> 16)
+
+// no wait states for external ram (default is 7)
+static const uint8_t zsNoWaits [] = {
+    ZS_INS+2, 0x3E, 0x08,           // ld a,08h
+    ZS_INS+3, 0xED, 0x39, 0xAA,     // out0 (0AAh),a
+    ZS_END
+};
+
+// run a script, the values read by ZS_GET are stored in results (if set),
+// returns the number of those values, or -1 if there is an unknown op
+int zdiScript (const uint8_t* ip, uint32_t* results =0) {
+    int count = 0;
+    while (true) {
+        uint8_t op = *ip++, n = op & 0x0F;
+        switch (op & 0xF0) {
+            case ZS_END:
+                return count;
+            case ZS_INS: { // IS4..IS0, i.e. backwards, ending on IS0 at 0x25
+                if (n < 1 || n > 5)
+                    return -1;
+                uint8_t buf [5];
+                for (int i = 0; i < n; ++i)
+                    buf[i] = ip[n-1-i];
+                zdiOutBlock(0x26 - n, buf, n);
+                ip += n;
+                break;
+            }
+            case ZS_OUT:
+                zdiOutBlock(ip[0], ip + 1, n);
+                ip += n + 1;
+                break;
+            case ZS_CMD:
+                zCmd(*ip++);
+                break;
+            case ZS_SET:
+                setReg(ip[0], (ip[3] << 16) | (ip[2] << 8) | ip[1]);
+                ip += 4;
+                break;
+            case ZS_GET: {
+                uint32_t v = getReg(*ip++);
+                if (results)
+                    results[count] = v;
+                ++count;
+                break;
+            }
+            case ZS_WAIT:
+                wait_ms(*ip++);
+                break;
+            default:
+                return -1;
+        }
+    }
+}
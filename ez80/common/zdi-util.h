@@ -1,6 +1,18 @@
 // ZDI access and utility code
+//
+// All ZDI traffic is bit-banged through the ZCL and ZDA pin objects, except
+// for the data bursts of readMem and writeMem when ZDI_DMA is defined: these
+// are then streamed out by timer-triggered DMA instead, or by a tight loop on
+// the GPIO registers of an ESP32, see zdi-dma.h
+
+#if ZDI_DMA
+#include <zdi-dma.h>
+#else
+static void zdiIdle () {} // nothing runs in the background
+#endif
 
 void ezReset (bool run =false) {
+    zdiIdle();
     RST = 1;
     ZCL = 1; // p.257
     ZDA = run; // p.243
@@ -44,10 +56,23 @@ static void zdiOutBits (uint8_t b, bool last =0) {
 }
 
 static void zdiStart (uint8_t b, int rw) {
+    zdiIdle();
     ZDA = 0;
     zdiOutBits((b<<1) | rw);
 }
 
+#if !ZDI_DMA
+static void zdiOutBurst (const uint8_t* ptr, unsigned len) {
+    for (unsigned i = 0; i < len; ++i)
+        zdiOutBits(ptr[i], i >= len-1);
+}
+
+static void zdiInBurst (uint8_t* ptr, unsigned len) {
+    for (unsigned i = 0; i < len; ++i)
+        ptr[i] = zdiInBits(i >= len-1);
+}
+#endif
+
 static uint8_t zdiIn (uint8_t addr) {
     zdiStart(addr, 1);
     ZDA.mode(Pinmode::in_pullup);
@@ -61,6 +86,23 @@ static void zdiOut (uint8_t addr, uint8_t val) {
     zdiOutBits(val, 1);
 }
 
+// write len consecutive ZDI registers in one transfer, the register address
+// advances after each byte, as for the instruction store in zIns below
+static void zdiOutBlock (uint8_t addr, const uint8_t* ptr, unsigned len) {
+    zdiStart(addr, 0);
+    for (unsigned i = 0; i < len; ++i)
+        zdiOutBits(ptr[i], i >= len-1);
+}
+
+// read len consecutive ZDI registers in one transfer
+static void zdiInBlock (uint8_t addr, uint8_t* ptr, unsigned len) {
+    zdiStart(addr, 1);
+    ZDA.mode(Pinmode::in_pullup);
+    for (unsigned i = 0; i < len; ++i)
+        ptr[i] = zdiInBits(i >= len-1);
+    ZDA.mode(Pinmode::out);
+}
+
 void zIns (uint8_t v0) {
     zdiOut(0x25, v0);
 }
@@ -119,19 +161,43 @@ void setMbase (uint8_t b) {
 #endif
 }
 
+// write a CPU register, cmd is one of the ZDI write commands 0x80..0x87, the
+// value goes into ZDI_WR_L/H/U and the command into ZDI_RW_CTL, all at once
+void setReg (uint8_t cmd, uint32_t val) {
+    uint8_t buf [] = { (uint8_t) val, (uint8_t) (val >> 8),
+                        (uint8_t) (val >> 16), cmd };
+    zdiOutBlock(0x13, buf, sizeof buf);
+}
+
+// read a CPU register, cmd is one of the ZDI read commands 0x00..0x07
+uint32_t getReg (uint8_t cmd) {
+    zCmd(cmd);
+    uint8_t buf [3]; // ZDI_RD_L/H/U
+    zdiInBlock(0x10, buf, sizeof buf);
+    return (buf[2]<<16) | (buf[1]<<8) | buf[0];
+}
+
 void setPC (uint32_t addr) {
-    zdiOut(0x13, addr);
-    zdiOut(0x14, addr >> 8);
-    zdiOut(0x15, addr >> 16); // must be in ADL mode
-    zCmd(0x87); // write PC
+    setReg(0x87, addr); // U must be in ADL mode
 }
 
 uint32_t getPC () {
-    zCmd(0x07); // read PC
-    uint8_t l = zdiIn(0x10);
-    uint8_t h = zdiIn(0x11);
-    uint8_t u = zdiIn(0x12); // only useful in ADL mode
-    return (u<<16) | (h<<8) | l;
+    return getReg(0x07); // U is only useful in ADL mode
+}
+
+// run code from the current PC until it reaches a "jr $" at addr, checked once
+// per millisecond, returns false if that didn't happen, CPU is in break after
+bool runUntil (uint32_t addr, int ms) {
+    zdiOut(0x10, 0x00); // continue
+    while (--ms >= 0) {
+        wait_ms(1);
+        zdiOut(0x10, 0x80); // break
+        if (getPC() == addr)
+            return true;
+        zdiOut(0x10, 0x00); // continue
+    }
+    zdiOut(0x10, 0x80); // break
+    return false;
 }
 
 void readMem (uint32_t addr, void *ptr, unsigned len) {
@@ -140,8 +206,7 @@ void readMem (uint32_t addr, void *ptr, unsigned len) {
         zdiStart(0x20, 1);
         ZDA.mode(Pinmode::in_pullup);
         zdiInBits(0); // ignore first read
-        for (unsigned i = 0; i < len; ++i)
-            ((uint8_t*) ptr)[i] = zdiInBits(i >= len-1);
+        zdiInBurst((uint8_t*) ptr, len);
         ZDA.mode(Pinmode::out);
     }
 }
@@ -150,8 +215,7 @@ void writeMem (uint32_t addr, const void *ptr, unsigned len) {
     if (len > 0) {
         setPC(addr);
         zdiStart(0x30, 0);
-        for (unsigned i = 0; i < len; ++i)
-            zdiOutBits(((const uint8_t*) ptr)[i], i >= len-1);
+        zdiOutBurst((const uint8_t*) ptr, len); // may still be busy on return
     }
 }
 
@@ -161,11 +225,8 @@ void dumpReg () {
     };
 
     for (int i = 0; i < 8; ++i) {
-        zCmd(i);
-        uint8_t l = zdiIn(0x10);
-        uint8_t h = zdiIn(0x11);
-        uint8_t u = zdiIn(0x12);
-        printf("  %s = %02x:%02x%02x", regs[i], u, h, l);
+        uint32_t v = getReg(i);
+        printf("  %s = %02x:%04x", regs[i], v >> 16, v & 0xFFFF);
         if (i % 4 == 3)
             printf("\n");
     }
@@ -180,63 +241,6 @@ uint32_t seedBuf (uint32_t seed, uint8_t mask, uint8_t *ptr, unsigned len) {
     return seed;
 }
 
-bool memoryTest (uint32_t base, uint32_t size, uint8_t mask =0xFF) {
-    // needs to be in ADL mode!
-    uint8_t wrBuf [1<<8], rdBuf [1<<8];
-    for (unsigned bank = 0; bank < 32; ++bank) {
-        unsigned addr = base + (bank<<16);
-        if (addr >= base + size)
-            break;
-
-        uint32_t seed = (bank+1) * mask;
-        printf("%02xxxxx: %d ", addr >> 16, seed);
-
-        for (unsigned offset = 0; offset <= 1<<16; offset += 1<<8) {
-            if (addr + offset >= base + size)
-                break;
-            seed = seedBuf(seed, mask, wrBuf, sizeof wrBuf);
-            writeMem(addr+offset, wrBuf, sizeof wrBuf);
-        }
-        printf(" => ");
-
-        seed = (bank+1) * mask;
-        for (unsigned offset = 0; offset <= 1<<16; offset += 1<<8) {
-            if (addr + offset >= base + size)
-                break;
-            seed = seedBuf(seed, mask, wrBuf, sizeof wrBuf);
-            readMem(addr+offset, rdBuf, sizeof rdBuf);
-            if (memcmp(wrBuf, rdBuf, sizeof wrBuf) != 0) {
-                printf(" *FAILED* in %04xxx", (addr+offset) >> 8);
-                // show differences
-                for (unsigned i = 0; i < sizeof wrBuf; ++i) {
-                    if (i % 64 == 0)
-                        printf("\n    %06x: ", addr+offset+i);
-                    printf("%c", wrBuf[i] != rdBuf[i] ? '?' : '.');
-                }
-                if (mask != 0xFF) {
-                    // show the bits which have been read as '1'
-                    for (unsigned i = 0; i < sizeof wrBuf; ++i) {
-                        if (i % 64 == 0)
-                            printf("\n    %06x: ", addr+offset+i);
-                        printf("%c", rdBuf[i] & mask ? '+' : ' ');
-                    }
-                } else {
-                    // show bytes as written and as read back
-                    for (unsigned i = 0; i < sizeof rdBuf; ++i) {
-                        if (i % 8 == 0)
-                            printf("\n\t%06x:", addr+offset+i);
-                        printf(" %02x:%02x", wrBuf[i], rdBuf[i]);
-                    }
-                }
-                printf("\n");
-                return false;
-            }
-        }
-        printf(" %08x  OK\n", seed);
-    }
-    return true;
-}
-
 uint8_t memRepeatMap (uint8_t val) {
     uint8_t r = 0;
     for (int i = 0; i < 8; ++i) {
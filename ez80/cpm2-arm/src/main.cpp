@@ -33,6 +33,12 @@ PinB<4> ZCL;
 PinB<8> RST;
 
 #include <zdi-util.h>
+#include <zdi-crc.h>
+#include <zdi-disk.h>
+#include <zdi-script.h>
+#include <uart-bridge.h>
+
+UartBridge bridge;
 
 // see embello/explore/1608-forth/ezr/asm/hello.asm
 const uint8_t hello [] = {
@@ -73,9 +79,11 @@ void controlCheck () {
 
 void memoryCheck () {
     writeMem(0xFFE000, hello, sizeof hello);
-    uint8_t buf [sizeof hello];
-    readMem(0xFFE000, buf, sizeof buf);
-    if (memcmp(hello, buf, sizeof hello) != 0)
+    // let the eZ80 compute a CRC of what it got, instead of reading it back
+    uint32_t crc;
+    crcLoad(0x1000000);
+    if (!crcRun(0xFFE000, sizeof hello, 1, &crc, 0x1000000) ||
+            crc != crc32(0, hello, sizeof hello))
         printf("? memory read mismatch\n");
 }
 
@@ -134,37 +142,63 @@ void ramDisk () {
     int len = file.open("DISK3   IMG");
     printf("<%d>", len);
 
-    zCmd(0x08); // set ADL
-    uint8_t buf [512];
-    for (int pos = 0; pos < len; pos += 512) {
-        if (!file.ioSect(false, pos/512, buf))
-            printf("? fat map error at %d\n", pos);
-        writeMem(0x3A6000 + pos, buf, sizeof buf);
-    }
+    // only the 4 KB blocks which differ from what's in ram are sent
+    uint32_t t = ticks;
+    int n = crcSync(file, len, 0x3A6000, 0x1000000);
+    if (n < 0)
+        printf("? ram disk mismatch\n");
+    printf("<%d blocks, %d ms>", n, ticks - t);
 }
 
-void romBoot () {
-    // 2) enter ADL mode to switch to 24-bit addressing
-    zCmd(0x08); // set ADL
+// a disk image which is served block by block while the eZ80 runs, the mailbox
+// and bell addresses must match those used by the driver on the eZ80 side, so
+// this stays off until there is such a driver: the bell is a ZDI breakpoint
+#ifndef BLOCK_DISK
+#define BLOCK_DISK 0 // 1 to serve BLOCKS.IMG, see zdi-disk.h
+#endif
+FileMap< decltype(fat), 25 > blocks (fat);
+DiskServer< decltype(blocks) > disk (blocks);
+
+void blockDisk () {
+#if BLOCK_DISK
+    int len = blocks.open("BLOCKS  IMG");
+    printf("<%d>", len);
+    if (len > 0)
+        disk.init(len, 0x20FFE0, 0x20FFF0);
+#endif
+}
 
+// the ZDI steps of romBoot, see zdi-script.h
+static const uint8_t bootSetup [] = {
+    // 2) enter ADL mode to switch to 24-bit addressing
+    ZS_CMD, 0x08,                   // set ADL
     // 3) set MBASE now that we're in ADL mode
-    setMbase(0x20);
-
+    ZS_INS+2, 0x3E, 0x20,           // ld a,20h
+    ZS_INS+2, 0xED, 0x6D,           // ld mb,a
     // 4) disable ERAM and move SRAM to BANK
-    zIns(0x3E, 0x50);       // ld a,80
-    zIns(0xED, 0x39, 0xB4); // out0 (RAM_CTL),a ; disable ERAM
-    zIns(0x3E, 0x20);       // ld a,20h
-    zIns(0xED, 0x39, 0xB5); // out0 (RAM_BANK),a ; SRAM to BANK
+    ZS_INS+2, 0x3E, 0x50,           // ld a,80
+    ZS_INS+3, 0xED, 0x39, 0xB4,     // out0 (RAM_CTL),a ; disable ERAM
+    ZS_INS+2, 0x3E, 0x20,           // ld a,20h
+    ZS_INS+3, 0xED, 0x39, 0xB5,     // out0 (RAM_BANK),a ; SRAM to BANK
+    ZS_END
+};
+static const uint8_t bootStart [] = {
+    // 9) switch from ADL mode to Z80 mode and jump to SLOAD address
+    ZS_SET, 0x87, ZS_24(0x20E380),  // PC = 20E380h
+    ZS_CMD, 0x09,                   // reset ADL
+    ZS_OUT+1, 0x10, 0x00,           // continue
+    ZS_END
+};
+
+void romBoot () {
+    zdiScript(bootSetup);
 
     // 8) load system loader to {BANK,DEST}
     uint8_t buf [128];
     readMem(0x3A6080, buf, sizeof buf);
     writeMem(0x20E380, buf, sizeof buf);
 
-    // 9) switch from ADL mode to Z80 mode and jump to SLOAD address
-    setPC(0x20E380);
-    zCmd(0x09); // reset ADL
-    zdiOut(0x10, 0x00); // continue
+    zdiScript(bootStart);
 }
 
 int main() {
@@ -201,15 +235,22 @@ int main() {
         printf("D"); diskSetup(); // prepare SD card access
         printf("A"); ramDisk();   // load ram disk from SD card
         printf("B"); romBoot();   // simulate rom bootstrap
+        printf("K"); blockDisk(); // serve disk blocks from SD card
     } else
         ezReset(true);
 
     printf("\n");
 
+    // from now on, the console and the eZ80's serial port are bridged by DMA
+    bridge.init(false); // true if the eZ80's RTS/CTS are wired to PA1/PA0
+
+    // disk requests are checked for on each wake-up, i.e. at least once per ms,
+    // and continuously for a while after each one, as more tend to follow
+    uint32_t last = 0;
     while (true) {
-        if (serial.readable())
-            console.putc(serial.getc());
-        if (console.readable())
-            serial.putc(console.getc());
+        if (disk.sects > 0 && disk.poll())
+            last = ticks;
+        else if (ticks - last > 10)
+            asm volatile ("wfi"); // the serial bridge runs in interrupts
     }
 }
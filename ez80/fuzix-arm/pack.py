@@ -0,0 +1,9 @@
+# Pack the FUZIX kernel for upload, whenever fuzix.bin is newer, see lzpack.py
+Import("env")
+
+import os, subprocess, sys
+
+src, dst = "fuzix.bin", "src/fuzix-lz.h"
+if os.path.exists(src) and (not os.path.exists(dst) or
+        os.path.getmtime(src) > os.path.getmtime(dst)):
+    subprocess.check_call([sys.executable, "../common/lzpack.py", src, dst])
@@ -0,0 +1,2324 @@
+  0x3d, 0xa9, 0x00, 0x03, 0x00, 0x00, 0xf0, 0x0b, 0xf3, 0x31, 0x00, 0xf6,
+  0xcd, 0x31, 0x01, 0x21, 0xea, 0x9b, 0x11, 0x00, 0xf4, 0x01, 0xb4, 0x08,
+  0xed, 0xb0, 0x11, 0xe9, 0xb6, 0x01, 0x9e, 0x05, 0xed, 0xb0, 0x13, 0x00,
+  0xf0, 0x44, 0xeb, 0x9b, 0x01, 0x34, 0x1a, 0x36, 0x00, 0xed, 0xb0, 0xcd,
+  0x32, 0x01, 0xcd, 0x79, 0xb8, 0xf3, 0x76, 0x18, 0xfd, 0xc9, 0x21, 0x80,
+  0x03, 0x11, 0x06, 0x1a, 0xed, 0x21, 0xa5, 0xed, 0x29, 0xc3, 0xed, 0x11,
+  0xc0, 0xed, 0x21, 0xc3, 0xed, 0x19, 0xc2, 0x21, 0x00, 0x02, 0x22, 0xf5,
+  0x9b, 0x21, 0xc0, 0x01, 0x22, 0xf7, 0x9b, 0x21, 0x00, 0x00, 0xe5, 0xcd,
+  0x04, 0xf7, 0xe1, 0xc9, 0xed, 0x39, 0xb5, 0xed, 0x6d, 0x40, 0xc3, 0x50,
+  0xf7, 0xd1, 0xe1, 0xe5, 0xd5, 0x7e, 0x32, 0xb0, 0x01, 0x23, 0x7e, 0x32,
+  0xb1, 0x05, 0x00, 0xf1, 0x18, 0xb2, 0x01, 0x23, 0x4e, 0x23, 0x5e, 0x23,
+  0x56, 0x62, 0x6b, 0x19, 0x11, 0x00, 0x08, 0x19, 0x22, 0xb4, 0x01, 0x79,
+  0xe6, 0x80, 0x20, 0x0d, 0x5b, 0x2a, 0xb3, 0x01, 0x00, 0x5b, 0xed, 0x5b,
+  0xb0, 0x01, 0x00, 0x18, 0x0b, 0x5b, 0x2a, 0xb0, 0x0d, 0x00, 0x00, 0x13,
+  0x00, 0xc1, 0x01, 0x00, 0x02, 0x00, 0x49, 0xed, 0xb0, 0xaf, 0x6f, 0x67,
+  0xc9, 0x00, 0x01, 0x00, 0xf0, 0x65, 0x01, 0x01, 0x00, 0x79, 0xc5, 0xf5,
+  0x33, 0xcd, 0xa2, 0x86, 0x33, 0xc1, 0x03, 0x3e, 0x07, 0xb9, 0x3e, 0x00,
+  0x98, 0xe2, 0xce, 0x01, 0xee, 0x80, 0xf2, 0xb9, 0x01, 0xc9, 0xcd, 0xbd,
+  0xf9, 0xe5, 0xcd, 0x61, 0x45, 0xcd, 0xc6, 0xf9, 0xf1, 0xc9, 0xcd, 0x61,
+  0x45, 0xc3, 0x31, 0x4f, 0xc9, 0x2e, 0x00, 0xc9, 0xcd, 0x6f, 0x46, 0x21,
+  0xee, 0xff, 0x39, 0xf9, 0x1e, 0x00, 0xdd, 0x7e, 0x06, 0x3d, 0x20, 0x16,
+  0x3e, 0x09, 0xf5, 0x33, 0xcd, 0x02, 0x0a, 0x33, 0x7c, 0xb5, 0x28, 0x06,
+  0x21, 0xff, 0xff, 0xc3, 0x2f, 0x03, 0x21, 0x02, 0xf4, 0x5e, 0x21, 0x00,
+  0x00, 0x39, 0x4d, 0x44, 0x21, 0x02, 0x00, 0x09, 0xdd, 0x75, 0xfc, 0xdd,
+  0x74, 0xfd, 0x73, 0xed, 0x5b, 0x95, 0xf4, 0x69, 0x60, 0x73, 0x23, 0x72,
+  0x21, 0x04, 0x14, 0x00, 0xf2, 0x4e, 0xfe, 0xdd, 0x74, 0xff, 0xed, 0x5b,
+  0x8f, 0xf4, 0xdd, 0x6e, 0xfe, 0xdd, 0x66, 0xff, 0x73, 0x23, 0x72, 0x59,
+  0x50, 0x13, 0x13, 0x13, 0x3a, 0x93, 0xf4, 0x12, 0xdd, 0xcb, 0x04, 0x46,
+  0x20, 0x04, 0x1a, 0xcb, 0xff, 0x12, 0x2a, 0x93, 0xf4, 0x7d, 0x3d, 0xb4,
+  0xca, 0xeb, 0x02, 0xdd, 0x7e, 0x06, 0xdd, 0x77, 0xf4, 0xdd, 0x36, 0xf5,
+  0x00, 0x69, 0x60, 0xdd, 0x75, 0xf6, 0xdd, 0x74, 0xf7, 0x0a, 0xdd, 0x77,
+  0xf8, 0x03, 0x0a, 0xdd, 0x77, 0xf9, 0x0b, 0xdd, 0x6e, 0xfc, 0xdd, 0x66,
+  0xfd, 0x7e, 0xdd, 0x77, 0xfa, 0xdd, 0x36, 0xfb, 0x00, 0x1a, 0x5f, 0xcb,
+  0xbb, 0x16, 0x00, 0x55, 0x00, 0x90, 0x7e, 0xdd, 0x77, 0xfc, 0x23, 0x7e,
+  0xdd, 0x77, 0xfd, 0x52, 0x00, 0xa2, 0x28, 0x05, 0x21, 0x55, 0x98, 0x18,
+  0x03, 0x21, 0x57, 0x98, 0x7c, 0x00, 0xf2, 0x0f, 0xc5, 0xdd, 0x6e, 0xf4,
+  0xdd, 0x66, 0xf5, 0xe5, 0xdd, 0x6e, 0xf6, 0xdd, 0x66, 0xf7, 0xe5, 0xdd,
+  0x6e, 0xf8, 0xdd, 0x66, 0xf9, 0xe5, 0xdd, 0x6e, 0xfa, 0xdd, 0x66, 0xfb,
+  0xe5, 0xd5, 0x55, 0x00, 0x12, 0xe5, 0x48, 0x00, 0x10, 0xe5, 0x87, 0x01,
+  0xf0, 0x05, 0x21, 0x24, 0x98, 0xe5, 0xcd, 0x45, 0x0f, 0x21, 0x12, 0x00,
+  0x39, 0xf9, 0xc1, 0xc5, 0xcd, 0x65, 0x01, 0xf1, 0x7d, 0x4f, 0xc0, 0x00,
+  0xe3, 0xb7, 0x28, 0x25, 0xdd, 0x71, 0xfe, 0xdd, 0x36, 0xff, 0x00, 0xdd,
+  0x4e, 0x05, 0x06, 0x7a, 0x00, 0x51, 0xe5, 0xd5, 0xc5, 0x21, 0x59, 0x30,
+  0x00, 0xf0, 0x03, 0xf1, 0xf1, 0xf1, 0xf1, 0x21, 0x00, 0x00, 0x18, 0x11,
+  0x2a, 0x93, 0xf4, 0x19, 0xeb, 0xed, 0x53, 0x8f, 0xf4, 0xd5, 0x00, 0xf0,
+  0x18, 0x87, 0x67, 0x2e, 0x00, 0xdd, 0xf9, 0xdd, 0xe1, 0xc9, 0x21, 0x02,
+  0x00, 0x39, 0x7e, 0xd6, 0x04, 0x38, 0x0a, 0x21, 0x13, 0x00, 0x22, 0x0c,
+  0xf4, 0x21, 0xff, 0xff, 0xc9, 0x21, 0x00, 0x00, 0xc9, 0x21, 0x03, 0x00,
+  0x39, 0x7e, 0xf5, 0x33, 0x07, 0x00, 0x98, 0x56, 0x1e, 0x01, 0xd5, 0xcd,
+  0xe8, 0x01, 0xf1, 0x33, 0x15, 0x00, 0x63, 0x7e, 0xf5, 0x33, 0xaf, 0xf5,
+  0x33, 0x17, 0x00, 0x01, 0x43, 0x00, 0x1d, 0x40, 0x43, 0x00, 0x00, 0x17,
+  0x00, 0x33, 0xc6, 0x40, 0x47, 0x2f, 0x00, 0x49, 0xc5, 0x33, 0x3e, 0x01,
+  0x32, 0x00, 0x08, 0x1b, 0x00, 0x0b, 0x4c, 0x00, 0x1f, 0x02, 0x4c, 0x00,
+  0x03, 0x1f, 0x80, 0x4c, 0x00, 0x07, 0x07, 0x1b, 0x00, 0x05, 0x4c, 0x00,
+  0xf0, 0x31, 0x3e, 0xff, 0xfd, 0x21, 0x02, 0x00, 0xfd, 0x39, 0xfd, 0xbe,
+  0x00, 0x3e, 0x04, 0xfd, 0x9e, 0x01, 0x30, 0x03, 0x2e, 0x00, 0xc9, 0x2e,
+  0x01, 0xc9, 0xc9, 0xc1, 0xe1, 0xe5, 0xc5, 0xe5, 0xcd, 0x0f, 0x04, 0xf1,
+  0xcb, 0x45, 0xc0, 0x21, 0x04, 0x00, 0x39, 0x4e, 0x23, 0x46, 0xc5, 0xcd,
+  0x9e, 0x0d, 0x26, 0x3a, 0xe3, 0x33, 0xcd, 0x16, 0x45, 0x33, 0x21, 0x73,
+  0x98, 0xe5, 0xcd, 0x19, 0x57, 0xf1, 0x68, 0x02, 0xf0, 0x26, 0xdd, 0x6e,
+  0x06, 0xdd, 0x66, 0x07, 0xe5, 0xdd, 0x6e, 0x04, 0xdd, 0x66, 0x05, 0xe5,
+  0xcd, 0x0c, 0x06, 0xf1, 0xf1, 0x4d, 0x7c, 0x47, 0xb5, 0x20, 0x56, 0xcd,
+  0xd1, 0x06, 0x4d, 0x44, 0x21, 0x00, 0x02, 0x09, 0xeb, 0x6b, 0x62, 0xdd,
+  0x7e, 0x04, 0x77, 0x23, 0xdd, 0x7e, 0x05, 0x77, 0x21, 0x02, 0x02, 0x09,
+  0xdd, 0x7e, 0x06, 0x0d, 0x00, 0xf0, 0x0d, 0x07, 0x77, 0xdd, 0xcb, 0x08,
+  0x46, 0x20, 0x2e, 0xc5, 0xd5, 0xc5, 0xcd, 0xc4, 0x07, 0xf1, 0xd1, 0xc1,
+  0x7d, 0xb7, 0x20, 0x05, 0x7c, 0xd6, 0x02, 0x28, 0x1c, 0x21, 0x05, 0xda,
+  0x00, 0xd1, 0x3e, 0xff, 0x12, 0x13, 0x12, 0x21, 0x04, 0x02, 0x09, 0x36,
+  0x00, 0x21, 0x05, 0x06, 0x00, 0xa2, 0x00, 0x00, 0x18, 0x02, 0x69, 0x60,
+  0xdd, 0xe1, 0xc9, 0xaf, 0x63, 0x01, 0x01, 0x96, 0x00, 0x20, 0xea, 0x04,
+  0xc9, 0x00, 0x1c, 0x01, 0x12, 0x00, 0xe0, 0xcd, 0x6f, 0x46, 0xf5, 0x21,
+  0x00, 0x00, 0xe3, 0xdd, 0x4e, 0x04, 0xdd, 0x46, 0x05, 0x47, 0x00, 0xf4,
+  0x04, 0xeb, 0xdd, 0x7e, 0x06, 0xb7, 0x28, 0x03, 0x3e, 0x01, 0x12, 0x3e,
+  0x01, 0xdd, 0x96, 0x06, 0x30, 0x24, 0xc5, 0xd5, 0xb5, 0x00, 0x27, 0x10,
+  0x08, 0x7f, 0x00, 0x12, 0x0a, 0x7f, 0x00, 0xf2, 0x10, 0x21, 0xff, 0xff,
+  0xe3, 0xaf, 0x12, 0x21, 0x06, 0x02, 0x09, 0xeb, 0x2a, 0x67, 0xb4, 0x23,
+  0x22, 0x67, 0xb4, 0xfd, 0x21, 0x67, 0xb4, 0xfd, 0x7e, 0x00, 0x12, 0x13,
+  0xfd, 0x7e, 0x01, 0x12, 0x93, 0x00, 0x65, 0xe1, 0xe5, 0xf1, 0xdd, 0xe1,
+  0xc9, 0xea, 0x00, 0x5f, 0x36, 0xff, 0x23, 0x36, 0xff, 0x33, 0x00, 0x06,
+  0xdf, 0x69, 0x60, 0xc5, 0x36, 0x00, 0x5d, 0x54, 0x13, 0x01, 0xff, 0x01,
+  0xed, 0xb0, 0x36, 0x00, 0x18, 0x30, 0xc9, 0xd1, 0xc1, 0x24, 0x01, 0x31,
+  0xc7, 0x04, 0xf1, 0x0a, 0x00, 0x00, 0xcc, 0x00, 0x60, 0x7e, 0xb7, 0xc8,
+  0xe5, 0xc5, 0xc5, 0xb8, 0x00, 0xa1, 0xc1, 0xe1, 0x36, 0x00, 0x69, 0x60,
+  0x11, 0x00, 0x02, 0x19, 0xfc, 0x00, 0xf0, 0x1c, 0xcd, 0x09, 0xf1, 0xc9,
+  0x11, 0x16, 0x9c, 0x7b, 0xd6, 0x3e, 0x7a, 0xde, 0xa6, 0xd0, 0x6b, 0x62,
+  0x01, 0x00, 0x02, 0x09, 0x4e, 0x23, 0x46, 0x0c, 0x20, 0x03, 0x04, 0x28,
+  0x07, 0xd5, 0xd5, 0xcd, 0xc0, 0x05, 0xf1, 0xd1, 0x21, 0x08, 0x02, 0x19,
+  0xeb, 0x18, 0xdc, 0x22, 0x01, 0x52, 0x01, 0x16, 0x9c, 0x59, 0x50, 0x2d,
+  0x00, 0x50, 0x30, 0x65, 0x6b, 0x62, 0xc5, 0x2f, 0x00, 0x50, 0xc1, 0x7e,
+  0xdd, 0x77, 0xfe, 0x94, 0x03, 0xf0, 0x02, 0xff, 0xdd, 0x7e, 0x04, 0xdd,
+  0x96, 0xfe, 0x20, 0x43, 0xdd, 0x7e, 0x05, 0xdd, 0x96, 0xff, 0x20, 0x3b,
+  0x21, 0x00, 0x1a, 0x02, 0x21, 0x00, 0x10, 0x06, 0x21, 0x00, 0x40, 0x22,
+  0xdd, 0x7e, 0x07, 0x21, 0x00, 0x10, 0x1a, 0x15, 0x01, 0xa0, 0x7e, 0x3d,
+  0x20, 0x0c, 0x11, 0x7f, 0x98, 0xe5, 0xc5, 0xd5, 0x22, 0x02, 0x81, 0xc1,
+  0xe1, 0x36, 0x01, 0x69, 0x60, 0x18, 0x0c, 0x74, 0x00, 0x71, 0x4b, 0x42,
+  0x18, 0x93, 0x21, 0x00, 0x00, 0x33, 0x01, 0x02, 0x7d, 0x00, 0x81, 0x79,
+  0xd6, 0x3e, 0x78, 0xde, 0xa6, 0x30, 0x35, 0x27, 0x02, 0xa3, 0x1a, 0xdd,
+  0x77, 0xfe, 0x13, 0x1a, 0xdd, 0x77, 0xff, 0x1b, 0x79, 0x00, 0x13, 0x16,
+  0x79, 0x00, 0x10, 0x0e, 0xff, 0x00, 0x00, 0xba, 0x00, 0x12, 0xc1, 0x14,
+  0x02, 0x74, 0x08, 0x02, 0x09, 0x4d, 0x44, 0x18, 0xc3, 0x48, 0x00, 0x40,
+  0xf5, 0xf5, 0x01, 0x00, 0x1d, 0x02, 0x15, 0xe3, 0xf9, 0x00, 0x20, 0x30,
+  0x51, 0xab, 0x00, 0x12, 0x06, 0xab, 0x00, 0x02, 0x60, 0x04, 0x03, 0x54,
+  0x01, 0xf0, 0x0c, 0xdd, 0x96, 0xfc, 0xdd, 0x77, 0xfe, 0xfd, 0x7e, 0x01,
+  0xdd, 0x9e, 0xfd, 0xdd, 0x77, 0xff, 0xe1, 0xe5, 0xdd, 0x7e, 0xfe, 0x95,
+  0xdd, 0x7e, 0xff, 0x9c, 0x38, 0x17, 0x33, 0x00, 0x10, 0x05, 0x33, 0x00,
+  0x52, 0x3d, 0x28, 0x0b, 0x4b, 0x42, 0x25, 0x04, 0x32, 0x33, 0x33, 0xe5,
+  0x2e, 0x01, 0x82, 0xa7, 0x78, 0xb1, 0x20, 0x0a, 0xc5, 0x21, 0x8f, 0xf8,
+  0x02, 0x11, 0xc1, 0xfe, 0x01, 0x12, 0x01, 0x8a, 0x01, 0x29, 0x28, 0x0b,
+  0x8b, 0x01, 0x01, 0x34, 0x04, 0x00, 0xa8, 0x01, 0x91, 0x69, 0x60, 0x11,
+  0x04, 0x02, 0x19, 0x7e, 0xb7, 0xc0, 0xdb, 0x01, 0x03, 0x80, 0x00, 0xe1,
+  0xc6, 0x18, 0x4f, 0xfd, 0x7e, 0x01, 0xce, 0xfc, 0x47, 0x79, 0x12, 0x13,
+  0x78, 0x12, 0xa8, 0x05, 0x25, 0x68, 0xf4, 0x1e, 0x03, 0x02, 0xad, 0x02,
+  0x90, 0x69, 0x60, 0x11, 0x02, 0x02, 0x19, 0x5e, 0x23, 0x56, 0x8b, 0x04,
+  0xf2, 0x00, 0x21, 0x00, 0x00, 0x22, 0x91, 0xf4, 0x2e, 0x01, 0x22, 0x93,
+  0xf4, 0xed, 0x43, 0x95, 0xf4, 0xf3, 0x00, 0x05, 0x28, 0x00, 0x11, 0x00,
+  0x28, 0x00, 0xf0, 0x16, 0xc5, 0xd5, 0x21, 0x9f, 0x98, 0xe5, 0xd5, 0xcd,
+  0x28, 0x04, 0xf1, 0xf1, 0xd1, 0xc1, 0xd5, 0xc5, 0xcd, 0x90, 0x07, 0xf1,
+  0xd1, 0x4a, 0x06, 0x00, 0x69, 0x60, 0x29, 0x29, 0x09, 0x29, 0x01, 0x72,
+  0x9b, 0x09, 0x01, 0x04, 0x00, 0x07, 0x02, 0x10, 0x53, 0x26, 0x05, 0x9f,
+  0xd5, 0x33, 0x69, 0x60, 0xcd, 0x34, 0x46, 0xf1, 0x33, 0x4c, 0x00, 0x05,
+  0x1f, 0xa6, 0x4c, 0x00, 0x0c, 0x1f, 0x06, 0x4c, 0x00, 0x06, 0x35, 0x21,
+  0xae, 0x98, 0x09, 0x04, 0x00, 0x41, 0x00, 0xf0, 0x03, 0x01, 0x72, 0x9b,
+  0xdd, 0x5e, 0x05, 0x16, 0x00, 0x6b, 0x62, 0x29, 0x29, 0x19, 0x29, 0x09,
+  0x11, 0x04, 0x00, 0xa6, 0x02, 0x71, 0xdd, 0x56, 0x04, 0xdd, 0x7e, 0x06,
+  0xf5, 0xa2, 0x04, 0x0c, 0x41, 0x00, 0x1f, 0xb5, 0x41, 0x00, 0x0b, 0x1f,
+  0x06, 0x41, 0x00, 0x0d, 0x04, 0x3d, 0x00, 0x01, 0xbb, 0x04, 0x43, 0x20,
+  0x0b, 0x21, 0x06, 0xcb, 0x03, 0x21, 0x18, 0x24, 0xfb, 0x05, 0x02, 0xc6,
+  0x00, 0x31, 0x11, 0x72, 0x9b, 0x47, 0x00, 0x9b, 0x5e, 0x06, 0x16, 0x00,
+  0xdd, 0x7e, 0x04, 0xd5, 0xf5, 0x85, 0x00, 0x1a, 0xbd, 0x85, 0x00, 0x04,
+  0x0c, 0x00, 0x2c, 0x89, 0x06, 0x90, 0x00, 0x20, 0x23, 0x23, 0x47, 0x00,
+  0x23, 0x7e, 0x04, 0x41, 0x00, 0x0e, 0x84, 0x00, 0x38, 0x4d, 0xcb, 0x41,
+  0x85, 0x00, 0x1c, 0x4a, 0xd0, 0x00, 0x15, 0x08, 0xd0, 0x00, 0x63, 0x6e,
+  0x08, 0xdd, 0x66, 0x09, 0xe5, 0x4d, 0x05, 0x04, 0xd5, 0x00, 0xf0, 0x06,
+  0xf1, 0x33, 0x4d, 0x44, 0x79, 0x3c, 0x20, 0x11, 0x78, 0x3c, 0x20, 0x0d,
+  0x2a, 0x0c, 0xf4, 0x7c, 0xb5, 0x20, 0x06, 0x21, 0x19, 0x4d, 0x00, 0x01,
+  0x06, 0x05, 0x00, 0xab, 0x00, 0x00, 0xf6, 0x06, 0x25, 0x03, 0x41, 0xaf,
+  0x00, 0x32, 0x62, 0x09, 0xf1, 0x7f, 0x05, 0xb0, 0x28, 0x12, 0x2a, 0x0c,
+  0xf4, 0x7d, 0xd6, 0x19, 0xb4, 0x20, 0x09, 0x42, 0x02, 0x40, 0x0c, 0xf4,
+  0x01, 0x00, 0x9c, 0x02, 0x03, 0x31, 0x03, 0xd0, 0x01, 0xa4, 0x9b, 0xdd,
+  0x7e, 0x04, 0xc6, 0xf9, 0x6f, 0x17, 0x9f, 0x67, 0x29, 0xcd, 0x01, 0x60,
+  0xed, 0x5b, 0x64, 0xf4, 0x2a, 0x66, 0x89, 0x02, 0xe0, 0x3c, 0x18, 0x08,
+  0xcb, 0x2c, 0xcb, 0x1d, 0xcb, 0x1a, 0xcb, 0x1b, 0x3d, 0x20, 0xf5, 0x82,
+  0x02, 0x04, 0x1c, 0x00, 0x90, 0x71, 0xfc, 0xdd, 0x70, 0xfd, 0xdd, 0x36,
+  0xfe, 0x00, 0x49, 0x07, 0xf5, 0x09, 0x7b, 0xdd, 0xa6, 0xfc, 0x5f, 0x7a,
+  0xdd, 0xa6, 0xfd, 0x57, 0x7d, 0xdd, 0xa6, 0xfe, 0x6f, 0x7c, 0xdd, 0xa6,
+  0xff, 0xb5, 0xb2, 0xb3, 0x28, 0x0b, 0x3c, 0x05, 0xf1, 0x0b, 0x18, 0x20,
+  0x2a, 0x62, 0xf4, 0x09, 0xeb, 0xdd, 0x46, 0x04, 0x04, 0x18, 0x04, 0xcb,
+  0x3a, 0xcb, 0x1b, 0x10, 0xfa, 0xed, 0x53, 0x93, 0xf4, 0xed, 0x4b, 0x60,
+  0xc8, 0x02, 0x23, 0x21, 0x00, 0x5d, 0x07, 0x04, 0x1c, 0x01, 0x02, 0xc5,
+  0x06, 0x00, 0x04, 0x00, 0x15, 0x16, 0x12, 0x00, 0x01, 0xeb, 0x00, 0x00,
+  0x0a, 0x00, 0x02, 0xe6, 0x03, 0x73, 0xf5, 0xcd, 0xbd, 0xf9, 0x33, 0x33,
+  0xe5, 0xd2, 0x05, 0x10, 0x08, 0xa2, 0x08, 0x94, 0xfa, 0xdd, 0x74, 0xfb,
+  0x5e, 0x23, 0x56, 0x21, 0x06, 0xc3, 0x08, 0x05, 0x9b, 0x04, 0x10, 0x7b,
+  0x41, 0x04, 0x20, 0x0a, 0x7a, 0x3f, 0x04, 0x56, 0x04, 0x2e, 0x00, 0x18,
+  0x58, 0xd2, 0x08, 0x72, 0x5e, 0x23, 0x56, 0xdd, 0x7e, 0x06, 0x12, 0x47,
+  0x08, 0x42, 0x5e, 0x23, 0x56, 0x13, 0x0a, 0x00, 0x32, 0x73, 0x23, 0x72,
+  0xf4, 0x03, 0x02, 0x13, 0x00, 0x03, 0xf2, 0x08, 0x20, 0x69, 0x60, 0xa0,
+  0x01, 0x02, 0xbf, 0x08, 0xa2, 0x23, 0x66, 0x6f, 0x09, 0x7b, 0x95, 0x7a,
+  0x9c, 0x38, 0x09, 0x1f, 0x00, 0xd0, 0x71, 0x23, 0x70, 0x2e, 0x01, 0xe5,
+  0xdd, 0x4e, 0xf8, 0xdd, 0x46, 0xf9, 0xc5, 0x81, 0x09, 0x11, 0xe1, 0xd3,
+  0x00, 0x02, 0xad, 0x00, 0x08, 0xac, 0x00, 0xf6, 0x09, 0xfd, 0x21, 0x08,
+  0x00, 0xfd, 0x09, 0xfd, 0x5e, 0x00, 0xfd, 0x7e, 0x01, 0xb3, 0x20, 0x03,
+  0x4f, 0x18, 0x65, 0xdd, 0x5e, 0x06, 0xdd, 0x56, 0x07, 0x7a, 0x09, 0x00,
+  0x5c, 0x00, 0x20, 0x7e, 0x12, 0x22, 0x00, 0x92, 0x56, 0x01, 0x1b, 0xfd,
+  0x73, 0x00, 0xfd, 0x72, 0x01, 0x75, 0x00, 0x02, 0x8d, 0x00, 0x00, 0x0a,
+  0x00, 0x70, 0x73, 0x23, 0x72, 0x0a, 0xdd, 0x77, 0xfe, 0x51, 0x09, 0x43,
+  0xff, 0x0b, 0x69, 0x60, 0x86, 0x03, 0x02, 0x8a, 0x00, 0x02, 0x97, 0x00,
+  0x10, 0x0d, 0xb6, 0x07, 0x30, 0xdd, 0x7e, 0xfe, 0x4c, 0x04, 0x50, 0xff,
+  0x77, 0x0e, 0x01, 0xc5, 0x89, 0x0a, 0x10, 0xe5, 0x99, 0x00, 0x26, 0xc1,
+  0x69, 0x9a, 0x00, 0x09, 0x45, 0x01, 0x01, 0x81, 0x00, 0x00, 0x15, 0x01,
+  0xb4, 0xfd, 0x21, 0x04, 0x00, 0xfd, 0x09, 0x69, 0x60, 0x5e, 0x23, 0x56,
+  0x7f, 0x00, 0x03, 0x02, 0x01, 0x00, 0x69, 0x01, 0x60, 0xaf, 0x77, 0x23,
+  0x77, 0xe1, 0xe5, 0x4b, 0x00, 0x0f, 0xe2, 0x00, 0x04, 0x00, 0x25, 0x00,
+  0x00, 0xc0, 0x05, 0x10, 0xfc, 0xc0, 0x05, 0x81, 0xfd, 0x1b, 0xdd, 0x7e,
+  0xfd, 0xdd, 0xb6, 0xfc, 0x79, 0x01, 0xe1, 0x67, 0xdd, 0x7e, 0xfc, 0xc6,
+  0xff, 0xdd, 0x77, 0xfe, 0xdd, 0x7e, 0xfd, 0xce, 0xff, 0x34, 0x06, 0x72,
+  0xfe, 0x12, 0x13, 0xdd, 0x7e, 0xff, 0x12, 0x73, 0x00, 0x09, 0xf4, 0x00,
+  0x06, 0xe1, 0x00, 0x00, 0xbf, 0x01, 0x84, 0x7a, 0xdd, 0x9e, 0xff, 0x30,
+  0x17, 0x69, 0x60, 0xf6, 0x03, 0x02, 0xeb, 0x00, 0xd2, 0x2b, 0xfd, 0x75,
+  0x00, 0xfd, 0x74, 0x01, 0xdd, 0x4e, 0x06, 0xdd, 0x46, 0x07, 0x3e, 0x00,
+  0x21, 0x1a, 0x02, 0x88, 0x01, 0x4a, 0xfa, 0xdd, 0x46, 0xfb, 0x88, 0x01,
+  0x05, 0xdc, 0x04, 0x20, 0x08, 0x00, 0xdc, 0x04, 0x41, 0x69, 0x60, 0x01,
+  0x0a, 0x36, 0x01, 0xf3, 0x03, 0x79, 0x93, 0x78, 0x9a, 0xe2, 0x10, 0x0d,
+  0xee, 0x80, 0xf2, 0x17, 0x0d, 0x2e, 0x01, 0x18, 0x02, 0x2e, 0x00, 0x30,
+  0x00, 0x70, 0xcb, 0x06, 0x66, 0x28, 0x18, 0x2a, 0x97, 0x6a, 0x03, 0x94,
+  0x0c, 0x21, 0xff, 0xff, 0x22, 0x97, 0xf4, 0x21, 0x0b, 0xd1, 0x02, 0x14,
+  0x2d, 0x65, 0x03, 0x8c, 0xec, 0x49, 0xf1, 0xcd, 0xce, 0x53, 0x7d, 0xb7,
+  0x2a, 0x00, 0x14, 0x04, 0x2a, 0x00, 0x10, 0x03, 0xde, 0x02, 0x20, 0xe1,
+  0xc9, 0x39, 0x09, 0x55, 0x7e, 0xcb, 0x67, 0x28, 0x0a, 0x44, 0x00, 0x03,
+  0x58, 0x09, 0x05, 0x41, 0x00, 0x15, 0x0a, 0x34, 0x00, 0x01, 0xfb, 0x02,
+  0x00, 0x36, 0x06, 0x40, 0x0a, 0xb7, 0xc8, 0x03, 0xec, 0x0b, 0x60, 0x16,
+  0x45, 0x33, 0xc1, 0x18, 0xf2, 0x94, 0x00, 0xc2, 0x7e, 0x04, 0xe6, 0x0f,
+  0x4f, 0x06, 0x00, 0x21, 0xc5, 0x98, 0x09, 0x7e, 0x19, 0x00, 0x00, 0x5c,
+  0x00, 0x00, 0xcc, 0x09, 0x43, 0x23, 0x66, 0x6f, 0x4e, 0xc1, 0x09, 0x83,
+  0x7e, 0x00, 0xb7, 0x20, 0x02, 0xb1, 0xc8, 0x79, 0x0f, 0x00, 0xb3, 0xb6,
+  0x00, 0x77, 0xfd, 0x7e, 0x00, 0xf5, 0x33, 0xcd, 0xb0, 0x0d, 0x95, 0x0a,
+  0xa1, 0x07, 0x07, 0x07, 0x07, 0xe6, 0x0f, 0x47, 0x0e, 0x00, 0xc5, 0x15,
+  0x00, 0x00, 0x14, 0x00, 0x14, 0x46, 0x0d, 0x00, 0x53, 0xc1, 0xd1, 0xd5,
+  0xc5, 0x06, 0xa5, 0x03, 0x12, 0x7b, 0x35, 0x00, 0x01, 0x34, 0x0a, 0x03,
+  0x40, 0x00, 0x0f, 0x1f, 0x00, 0x0c, 0x00, 0x0e, 0x02, 0x40, 0x3b, 0xdd,
+  0x36, 0xfd, 0x83, 0x07, 0x12, 0x39, 0x4e, 0x02, 0x45, 0xe5, 0x21, 0x10,
+  0x27, 0x94, 0x04, 0xff, 0x11, 0x8a, 0x45, 0xf1, 0xf1, 0x11, 0x0a, 0x00,
+  0xd5, 0xe5, 0xcd, 0x85, 0x46, 0xf1, 0xf1, 0x55, 0xd5, 0x33, 0xcd, 0xc9,
+  0x0d, 0xf1, 0x33, 0xdd, 0x4e, 0xfe, 0xdd, 0x46, 0xff, 0xc5, 0x21, 0xe8,
+  0x03, 0x29, 0x00, 0x14, 0x2f, 0x64, 0x00, 0x29, 0x00, 0x14, 0x1f, 0x0a,
+  0x29, 0x00, 0x0b, 0x54, 0x33, 0x21, 0x0a, 0x00, 0xe3, 0x21, 0x00, 0x00,
+  0x17, 0x00, 0x11, 0x45, 0x05, 0x01, 0x02, 0x8e, 0x04, 0x92, 0x03, 0x00,
+  0x39, 0xcb, 0x7e, 0x28, 0x14, 0x3e, 0x2d, 0x69, 0x01, 0x00, 0xe7, 0x00,
+  0x82, 0xaf, 0x96, 0x77, 0x3e, 0x00, 0x23, 0x9e, 0x77, 0xbb, 0x01, 0x21,
+  0x54, 0x0e, 0xf5, 0x0a, 0x70, 0x21, 0xf7, 0xff, 0x39, 0xf9, 0x21, 0x0f,
+  0xf0, 0x00, 0x42, 0xfb, 0xdd, 0x74, 0xfc, 0x68, 0x02, 0xf4, 0x35, 0x0a,
+  0x5f, 0xb7, 0xca, 0xeb, 0x10, 0xd6, 0x25, 0xc2, 0xd8, 0x10, 0x03, 0xdd,
+  0x71, 0x04, 0xdd, 0x70, 0x05, 0x69, 0x60, 0x5e, 0xdd, 0x6e, 0xfb, 0xdd,
+  0x66, 0xfc, 0x23, 0x23, 0x7d, 0xc6, 0xfe, 0x47, 0x7c, 0xce, 0xff, 0x57,
+  0xe5, 0x68, 0x62, 0xe5, 0xfd, 0xe1, 0xe1, 0x7b, 0xfe, 0x32, 0xca, 0x76,
+  0x10, 0xfe, 0x63, 0x28, 0x6f, 0xd6, 0x64, 0x20, 0x03, 0x3e, 0x01, 0x20,
+  0xaf, 0xdd, 0x77, 0xfd, 0x7b, 0xd6, 0x70, 0x0c, 0x00, 0x44, 0xfe, 0x7b,
+  0xd6, 0x75, 0x0c, 0x00, 0x42, 0xff, 0x7b, 0xd6, 0x78, 0x0c, 0x00, 0xf2,
+  0x01, 0x4f, 0xdd, 0x7e, 0xfd, 0xb7, 0xc2, 0x97, 0x10, 0x7b, 0xd6, 0x6c,
+  0x28, 0x51, 0xdd, 0x7e, 0xfe, 0x0c, 0x00, 0x60, 0x73, 0x28, 0x0e, 0xdd,
+  0x7e, 0xff, 0x0c, 0x00, 0x72, 0xb1, 0xc2, 0x97, 0x10, 0xc3, 0xd8, 0x10,
+  0x95, 0x00, 0x23, 0x68, 0x62, 0xb6, 0x0b, 0xd2, 0xf1, 0xdd, 0x34, 0x04,
+  0xc2, 0x57, 0x0f, 0xdd, 0x34, 0x05, 0xc3, 0x57, 0x0f, 0x1c, 0x00, 0x02,
+  0x1d, 0x02, 0x00, 0x4b, 0x02, 0x08, 0x1b, 0x00, 0xf0, 0x0a, 0x7e, 0xfb,
+  0xc6, 0x04, 0x4f, 0xdd, 0x7e, 0xfc, 0xce, 0x00, 0x47, 0xdd, 0x71, 0xfb,
+  0xdd, 0x70, 0xfc, 0x79, 0xc6, 0xfc, 0x5f, 0x78, 0xce, 0xff, 0x57, 0xda,
+  0x01, 0xf0, 0x09, 0xeb, 0x01, 0x04, 0x00, 0xed, 0xb0, 0xdd, 0x5e, 0xf7,
+  0xdd, 0x56, 0xf8, 0xdd, 0x4e, 0xf9, 0xdd, 0x6e, 0xfa, 0x06, 0x10, 0xcb,
+  0x2d, 0xcb, 0x19, 0x2a, 0x06, 0xa0, 0x10, 0xf6, 0xd5, 0xcd, 0xf5, 0x0d,
+  0xf1, 0xc1, 0xc5, 0xc5, 0x07, 0x00, 0x00, 0x5b, 0x06, 0x5b, 0x02, 0xdd,
+  0x77, 0x04, 0xd2, 0x74, 0x00, 0x8f, 0x4e, 0x00, 0x06, 0x00, 0xc5, 0xcd,
+  0x35, 0x0e, 0x21, 0x00, 0x06, 0x01, 0xcd, 0x03, 0x40, 0x79, 0xb7, 0x20,
+  0x06, 0xdb, 0x00, 0x21, 0x28, 0x07, 0x54, 0x00, 0x20, 0x18, 0x18, 0xf4,
+  0x00, 0x00, 0x0d, 0x00, 0x50, 0x1f, 0x0f, 0xf1, 0x18, 0x0b, 0xe9, 0x00,
+  0x30, 0x28, 0x05, 0xd5, 0x88, 0x01, 0x08, 0xbb, 0x00, 0x00, 0x97, 0x02,
+  0x0c, 0xce, 0x00, 0x00, 0xd1, 0x01, 0xe3, 0x3a, 0x8a, 0xb4, 0xfd, 0x21,
+  0x8c, 0xb4, 0xfd, 0x96, 0x00, 0x20, 0x1e, 0x3a, 0x8b, 0x0c, 0x00, 0xf1,
+  0x0d, 0x01, 0x20, 0x12, 0x21, 0x89, 0xb4, 0x4e, 0x06, 0x00, 0xed, 0x43,
+  0x0c, 0xf4, 0x21, 0x88, 0xb4, 0x36, 0x01, 0x2e, 0x00, 0xc9, 0x2a, 0x8a,
+  0xb4, 0xe5, 0xcd, 0x0c, 0xfa, 0xde, 0x01, 0x55, 0xf5, 0xf5, 0x21, 0x00,
+  0x02, 0x45, 0x02, 0xf0, 0x15, 0xcb, 0x47, 0xf1, 0xf1, 0x4d, 0x44, 0x78,
+  0xb1, 0x20, 0x06, 0x21, 0x00, 0x00, 0xc3, 0xb7, 0x13, 0xdd, 0x5e, 0x04,
+  0xdd, 0x56, 0x05, 0xed, 0x53, 0x8a, 0xb4, 0x7b, 0x21, 0x8c, 0xb4, 0x81,
+  0x77, 0x7a, 0x88, 0x23, 0x77, 0x46, 0x00, 0xf0, 0x02, 0x00, 0x79, 0xb7,
+  0x20, 0x0c, 0x78, 0xd6, 0x02, 0x20, 0x07, 0x21, 0x89, 0xb4, 0x36, 0x25,
+  0x18, 0x05, 0x07, 0x00, 0x70, 0x0d, 0xcd, 0xf0, 0x10, 0x7d, 0xd6, 0x2f,
+  0x72, 0x00, 0xfa, 0x03, 0xf4, 0x7e, 0xfd, 0x21, 0x8e, 0xb4, 0xfd, 0x77,
+  0x00, 0x23, 0x7e, 0xfd, 0x77, 0x01, 0x18, 0x10, 0x21, 0x87, 0x12, 0x00,
+  0xd2, 0x2a, 0x8e, 0xb4, 0x01, 0x46, 0x00, 0x09, 0x34, 0x2a, 0x8e, 0xb4,
+  0x22, 0x90, 0x0b, 0x00, 0xf2, 0x09, 0xfd, 0x21, 0x90, 0xb4, 0xfd, 0x7e,
+  0x01, 0xfd, 0xb6, 0x00, 0x28, 0x08, 0x2a, 0x90, 0xb4, 0xe5, 0xcd, 0xc2,
+  0x2a, 0xf1, 0xed, 0x4b, 0x8b, 0xf4, 0x18, 0x00, 0x81, 0x00, 0x91, 0x20,
+  0x0c, 0xfd, 0x7e, 0x01, 0x90, 0x99, 0x00, 0x14, 0x22, 0x16, 0x00, 0x01,
+  0x2e, 0x00, 0x11, 0x0b, 0x2e, 0x00, 0x60, 0xc8, 0x14, 0xf1, 0x22, 0x90,
+  0xb4, 0x82, 0x00, 0xe2, 0x5f, 0xd6, 0x2f, 0x20, 0x09, 0x2a, 0x8a, 0xb4,
+  0x23, 0x22, 0x8a, 0xb4, 0x18, 0xee, 0x3c, 0x05, 0xc6, 0x7b, 0xb7, 0xca,
+  0x5c, 0x13, 0x3a, 0x88, 0xb4, 0xb7, 0xc2, 0x5c, 0x13, 0x3b, 0x00, 0x40,
+  0x20, 0x09, 0x21, 0x02, 0x94, 0x04, 0xf2, 0x04, 0xc3, 0xa0, 0x13, 0xc5,
+  0x2a, 0x8e, 0xb4, 0xe5, 0xcd, 0x1d, 0x22, 0xf1, 0xc1, 0x2a, 0x90, 0xb4,
+  0x22, 0x8e, 0xb4, 0x10, 0x00, 0xb9, 0x11, 0x29, 0xf1, 0x7d, 0xc1, 0xd6,
+  0x40, 0x28, 0x09, 0x21, 0x14, 0x28, 0x00, 0xa3, 0x25, 0x28, 0xf1, 0x7d,
+  0xc1, 0x0f, 0x38, 0x09, 0x21, 0x0d, 0x17, 0x00, 0x40, 0x01, 0x69, 0xb4,
+  0xc5, 0x7c, 0x00, 0xf4, 0x07, 0xc1, 0x5f, 0xb7, 0x28, 0x1a, 0xd6, 0x2f,
+  0x28, 0x16, 0x79, 0xd6, 0x87, 0x20, 0x05, 0x78, 0xd6, 0xb4, 0x28, 0x03,
+  0x7b, 0x02, 0x03, 0x8d, 0x00, 0xe1, 0xdc, 0x33, 0x33, 0xc5, 0xaf, 0x02,
+  0xed, 0x5b, 0x89, 0xf4, 0xed, 0x4b, 0x8e, 0xb4, 0x10, 0x01, 0x92, 0x7e,
+  0x00, 0x93, 0x20, 0x09, 0xfd, 0x7e, 0x01, 0x92, 0xf5, 0x02, 0xf0, 0x04,
+  0x5f, 0xb7, 0x20, 0x30, 0x69, 0x60, 0x23, 0x23, 0x23, 0x23, 0x56, 0x23,
+  0x6e, 0x7a, 0x3d, 0xb5, 0xc2, 0x49, 0x13, 0x0f, 0x00, 0x05, 0xea, 0x07,
+  0x41, 0xfd, 0x21, 0x02, 0x9c, 0xda, 0x0b, 0x30, 0xfe, 0x20, 0x08, 0xd9,
+  0x0b, 0xe0, 0x96, 0xff, 0x28, 0x61, 0xe1, 0xe5, 0x7e, 0xd6, 0x2e, 0x20,
+  0x5a, 0xe1, 0xe5, 0x23, 0x08, 0x00, 0xf0, 0x06, 0x52, 0xe1, 0xe5, 0x23,
+  0x23, 0x7e, 0xfe, 0x2f, 0x28, 0x03, 0xb7, 0x20, 0x46, 0x7b, 0xb7, 0x28,
+  0x0f, 0xed, 0x43, 0x90, 0xb4, 0x81, 0x00, 0x00, 0x82, 0x00, 0x82, 0xc3,
+  0xaf, 0x11, 0xc5, 0xfd, 0xe1, 0xfd, 0x4e, 0xe4, 0x0a, 0x50, 0x09, 0x29,
+  0x09, 0x29, 0x29, 0x24, 0x0a, 0x53, 0x09, 0x11, 0xdb, 0xb0, 0x19, 0xb1,
+  0x0a, 0x10, 0x21, 0x8c, 0x01, 0x06, 0x0e, 0x01, 0x81, 0xed, 0x43, 0x8e,
+  0xb4, 0x21, 0x69, 0xb4, 0xe5, 0x11, 0x00, 0x30, 0xbc, 0x13, 0xf1, 0x65,
+  0x01, 0x30, 0xc3, 0xaf, 0x11, 0x4b, 0x01, 0x20, 0x20, 0x3e, 0x0b, 0x0d,
+  0x43, 0xb6, 0x06, 0x28, 0x0f, 0xca, 0x00, 0x84, 0x02, 0x03, 0xfd, 0x7e,
+  0x01, 0x02, 0x18, 0x08, 0x3d, 0x00, 0x02, 0x1f, 0x00, 0x27, 0x20, 0x12,
+  0x71, 0x01, 0x12, 0x06, 0x71, 0x01, 0x53, 0x2a, 0x90, 0xb4, 0x18, 0x17,
+  0x3e, 0x00, 0x54, 0x04, 0xaf, 0x02, 0x03, 0x02, 0x33, 0x00, 0x04, 0x2b,
+  0x09, 0x00, 0x77, 0x04, 0x40, 0xf6, 0xff, 0x39, 0xf9, 0x1d, 0x0d, 0x20,
+  0x77, 0xf6, 0x1b, 0x0d, 0xf1, 0x03, 0x77, 0xf7, 0xdd, 0x7e, 0xf6, 0xdd,
+  0x77, 0xf8, 0xdd, 0x7e, 0xf7, 0xdd, 0x77, 0xf9, 0xe1, 0xe5, 0x11, 0x0e,
+  0xaf, 0x00, 0x00, 0x6c, 0x12, 0xf4, 0x08, 0x79, 0xc6, 0xff, 0x78, 0xce,
+  0x01, 0x47, 0x30, 0x01, 0x13, 0x6a, 0xcb, 0x3d, 0xcb, 0x1b, 0xcb, 0x18,
+  0xdd, 0x70, 0xfa, 0xdd, 0x73, 0xfb, 0xbf, 0x09, 0x02, 0x2d, 0x07, 0xd0,
+  0xdd, 0x7e, 0xfe, 0x91, 0xdd, 0x7e, 0xff, 0x98, 0xd2, 0xc0, 0x14, 0x21,
+  0x01, 0x36, 0x05, 0x01, 0x18, 0x11, 0x03, 0x67, 0x11, 0xa0, 0xcd, 0x42,
+  0x25, 0xf1, 0xf1, 0xf1, 0xeb, 0xdd, 0x7e, 0xf6, 0xac, 0x03, 0x60, 0xfc,
+  0xdd, 0x7e, 0xf7, 0xce, 0x00, 0xa8, 0x11, 0x01, 0x8d, 0x08, 0xb1, 0x4e,
+  0x23, 0x46, 0xaf, 0xf5, 0x33, 0xd5, 0xc5, 0xcd, 0x50, 0x04, 0xa5, 0x0a,
+  0x61, 0x78, 0xb1, 0x28, 0x64, 0x11, 0x00, 0xd7, 0x0a, 0x00, 0x3e, 0x01,
+  0xa0, 0xe5, 0xfd, 0xe1, 0xfd, 0x23, 0xfd, 0x23, 0xe5, 0xc5, 0xd5, 0xa0,
+  0x11, 0x01, 0xd3, 0x0a, 0xf2, 0x01, 0xcd, 0x5f, 0x1a, 0xf1, 0xf1, 0x7d,
+  0xd1, 0xc1, 0xe1, 0xcb, 0x47, 0x28, 0x1c, 0x5e, 0x23, 0x56, 0xd1, 0x0e,
+  0x15, 0xd1, 0x4f, 0x00, 0xf1, 0x06, 0xd5, 0xc5, 0xcd, 0x39, 0x15, 0xf1,
+  0xf1, 0x18, 0x20, 0x13, 0x7b, 0xd6, 0x10, 0x7a, 0x17, 0x3f, 0x1f, 0xde,
+  0x80, 0x38, 0xb0, 0x24, 0x00, 0xc7, 0xdd, 0x34, 0xfe, 0xc2, 0x08, 0x14,
+  0xdd, 0x34, 0xff, 0xc3, 0x08, 0x14, 0x0c, 0x01, 0x70, 0xf5, 0x3b, 0x01,
+  0xdb, 0xb0, 0x59, 0x50, 0xce, 0x00, 0x20, 0x6b, 0x62, 0x0b, 0x07, 0xa0,
+  0x2c, 0x20, 0x03, 0x24, 0x28, 0x3b, 0xd5, 0xfd, 0xe1, 0xfd, 0x21, 0x01,
+  0x20, 0xfd, 0xfd, 0x21, 0x01, 0x11, 0xfe, 0x4a, 0x0e, 0x31, 0xfd, 0x20,
+  0x24, 0x4a, 0x0e, 0x44, 0xfe, 0x20, 0x1c, 0xc5, 0xd6, 0x03, 0x40, 0x1d,
+  0x22, 0xf1, 0xe1, 0xdb, 0x01, 0x33, 0x01, 0x00, 0xe5, 0x7a, 0x00, 0x40,
+  0x17, 0x21, 0xe3, 0x00, 0xa4, 0x0e, 0xa2, 0xdd, 0x34, 0xff, 0xdd, 0x7e,
+  0xff, 0xd6, 0x04, 0x38, 0xa8, 0x2c, 0x00, 0x07, 0xf3, 0x08, 0x7b, 0x3b,
+  0xdd, 0x36, 0xf9, 0x00, 0x21, 0xd6, 0x1f, 0x0c, 0x02, 0xd3, 0x01, 0x54,
+  0x24, 0xdd, 0x36, 0xf9, 0x01, 0x18, 0x00, 0xf0, 0x00, 0x99, 0x1c, 0xf1,
+  0xdd, 0x75, 0x06, 0xdd, 0x74, 0x07, 0x7c, 0xb5, 0x20, 0x0b, 0x21, 0x1c,
+  0xe0, 0x01, 0x54, 0x2e, 0x00, 0xc3, 0x92, 0x17, 0x20, 0x00, 0x32, 0x48,
+  0x29, 0xf1, 0xf9, 0x09, 0xc2, 0xdd, 0x7e, 0x06, 0xd6, 0x01, 0xdd, 0x7e,
+  0x07, 0xde, 0x00, 0x38, 0x1d, 0x0c, 0x01, 0x00, 0xac, 0x08, 0x00, 0xcf,
+  0x00, 0xf0, 0x04, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0xdd, 0x7e, 0x06, 0x95,
+  0xdd, 0x7e, 0x07, 0x9c, 0x38, 0x0e, 0x21, 0xdd, 0x98, 0xe5, 0xcc, 0x05,
+  0x00, 0x84, 0x04, 0x60, 0x92, 0x17, 0xdd, 0x36, 0xfa, 0x00, 0x4b, 0x13,
+  0x30, 0x01, 0xff, 0xaa, 0xc0, 0x0f, 0x61, 0xdb, 0x7a, 0xde, 0xb0, 0x30,
+  0x5d, 0xfb, 0x00, 0x10, 0x46, 0x3f, 0x05, 0x77, 0x73, 0xfa, 0xdd, 0x72,
+  0xfb, 0x6b, 0x62, 0x25, 0x03, 0x03, 0x52, 0x0f, 0x13, 0x30, 0x52, 0x0f,
+  0x14, 0x28, 0x27, 0x01, 0x11, 0xfe, 0x27, 0x01, 0x04, 0xc9, 0x0f, 0x13,
+  0x11, 0xc9, 0x0f, 0xc1, 0x09, 0xdd, 0x71, 0xfa, 0xdd, 0x70, 0xfb, 0xc3,
+  0x18, 0x17, 0x21, 0x4b, 0x14, 0x01, 0xc6, 0x18, 0x9b, 0xdd, 0x7e, 0xfb,
+  0xdd, 0xb6, 0xfa, 0x20, 0x0b, 0x21, 0x17, 0xcd, 0x00, 0x01, 0xc5, 0x0a,
+  0x22, 0x06, 0x03, 0x1a, 0x08, 0x20, 0x13, 0x13, 0x12, 0x02, 0x04, 0xe1,
+  0x00, 0x05, 0x18, 0x02, 0x02, 0x36, 0x05, 0xf1, 0x07, 0x92, 0x17, 0xdd,
+  0x7e, 0xfa, 0xc6, 0x06, 0x5f, 0xdd, 0x7e, 0xfb, 0xce, 0x00, 0x57, 0xdd,
+  0x7e, 0x06, 0xe6, 0x07, 0x6f, 0x26, 0x00, 0x2d, 0x02, 0x50, 0x29, 0x09,
+  0xc5, 0x01, 0x40, 0x74, 0x15, 0x00, 0xeb, 0x01, 0x01, 0x97, 0x02, 0xb0,
+  0x03, 0x03, 0xdd, 0x7e, 0x04, 0x02, 0x03, 0xdd, 0x7e, 0x05, 0x02, 0x36,
+  0x00, 0x00, 0x93, 0x06, 0x10, 0xfb, 0x93, 0x06, 0x20, 0x7e, 0x06, 0x15,
+  0x00, 0x11, 0x07, 0x15, 0x00, 0x15, 0x4a, 0x15, 0x00, 0xf2, 0x09, 0xfc,
+  0xd6, 0xdb, 0x5f, 0xdd, 0x7e, 0xfd, 0xde, 0xb0, 0x57, 0xc5, 0x21, 0xe3,
+  0x00, 0xe5, 0xd5, 0xcd, 0x90, 0x46, 0xf1, 0xf1, 0xc1, 0x7d, 0x02, 0xd6,
+  0x0b, 0x50, 0x36, 0x91, 0x23, 0x36, 0x60, 0x31, 0x00, 0x14, 0x49, 0x31,
+  0x00, 0x01, 0x65, 0x01, 0xf1, 0x00, 0x23, 0x23, 0xcb, 0x46, 0x28, 0x05,
+  0x11, 0x40, 0x00, 0x18, 0x03, 0x11, 0x00, 0x00, 0x7b, 0x53, 0x00, 0x11,
+  0x06, 0xe6, 0x02, 0x17, 0xfb, 0xe6, 0x02, 0x08, 0x40, 0x01, 0xd3, 0xcb,
+  0xf9, 0x46, 0x28, 0x16, 0xdd, 0x7e, 0xff, 0xdd, 0xb6, 0xfe, 0x20, 0x40,
+  0x1f, 0x00, 0x72, 0x7e, 0xe6, 0xf0, 0x28, 0x1d, 0x18, 0x32, 0x16, 0x00,
+  0x25, 0x28, 0x2a, 0xe6, 0x14, 0x02, 0x33, 0x00, 0x31, 0xe6, 0xf0, 0x28,
+  0xf6, 0x00, 0x13, 0x46, 0x7a, 0x00, 0x23, 0x0a, 0x3c, 0x94, 0x00, 0x45,
+  0x18, 0x0b, 0x21, 0xf7, 0xcd, 0x01, 0x05, 0xdb, 0x03, 0xc1, 0xde, 0xff,
+  0x39, 0xf9, 0x01, 0x00, 0xf4, 0x21, 0x40, 0x00, 0x22, 0x64, 0xf6, 0x0f,
+  0x10, 0x66, 0x06, 0x00, 0xf2, 0x07, 0x39, 0xeb, 0xdd, 0x73, 0xfe, 0xdd,
+  0x72, 0xff, 0x21, 0x20, 0x00, 0x22, 0x62, 0xf4, 0xfd, 0x21, 0x60, 0x00,
+  0xfd, 0x09, 0x6b, 0x62, 0x03, 0x0b, 0xa4, 0x21, 0x6a, 0xf4, 0x36, 0x01,
+  0xc5, 0xd5, 0xaf, 0xf5, 0x33, 0x76, 0x01, 0x62, 0x02, 0x2d, 0xf1, 0x33,
+  0xd1, 0xc1, 0xc8, 0x03, 0x50, 0x23, 0x23, 0x7e, 0xb7, 0x28, 0x82, 0x0b,
+  0xc5, 0x0b, 0x2a, 0x97, 0xf4, 0x7d, 0xd6, 0x20, 0xb4, 0x28, 0xbb, 0x2e,
+  0x01, 0x6e, 0x00, 0x14, 0xd4, 0x49, 0x04, 0x11, 0xf4, 0x49, 0x04, 0x12,
+  0xf5, 0x6a, 0x15, 0xb3, 0x11, 0x49, 0x00, 0x19, 0x7e, 0xcb, 0x77, 0x28,
+  0x0b, 0x21, 0x1e, 0xe6, 0x01, 0x23, 0x5a, 0x1a, 0x84, 0x15, 0x00, 0xe0,
+  0x05, 0x42, 0xcb, 0x4d, 0x20, 0x0b, 0xdf, 0x05, 0x02, 0x1a, 0x00, 0xf5,
+  0x04, 0x4e, 0x08, 0xdd, 0x46, 0x09, 0x0a, 0xb7, 0x20, 0x13, 0xdd, 0x7e,
+  0x0b, 0xdd, 0xb6, 0x0a, 0x28, 0x0b, 0x21, 0x11, 0x1d, 0x00, 0x00, 0xc2,
+  0x00, 0x23, 0x64, 0xf4, 0xc5, 0x00, 0x02, 0x10, 0x16, 0x02, 0xc4, 0x00,
+  0xa1, 0xdd, 0x4e, 0xf6, 0xdd, 0x46, 0xf7, 0xed, 0x43, 0x60, 0xf4, 0xc0,
+  0x00, 0x0b, 0xbe, 0x00, 0x3c, 0x2a, 0x97, 0xf4, 0x72, 0x04, 0x60, 0x7c,
+  0xb5, 0x28, 0x23, 0xdd, 0x7e, 0xb7, 0x11, 0x00, 0x57, 0x0c, 0x25, 0x77,
+  0xff, 0xa7, 0x04, 0x06, 0x58, 0x04, 0x42, 0xcb, 0x45, 0x28, 0xa2, 0x8c,
+  0x0b, 0x12, 0x15, 0xdc, 0x06, 0x42, 0x0a, 0xb7, 0x28, 0x0b, 0x57, 0x05,
+  0x02, 0xaa, 0x00, 0x08, 0x3f, 0x00, 0x52, 0x5e, 0xfc, 0xdd, 0x56, 0xfd,
+  0x70, 0x0f, 0x73, 0x01, 0x1e, 0x00, 0xed, 0xb0, 0x01, 0x00, 0x12, 0x16,
+  0x00, 0xcc, 0x11, 0x62, 0x0c, 0x03, 0x79, 0xd6, 0x1e, 0x78, 0x7f, 0x04,
+  0x15, 0xe9, 0x0b, 0x00, 0x23, 0x30, 0x0c, 0x22, 0x00, 0x53, 0x36, 0x00,
+  0x03, 0x18, 0xe9, 0xee, 0x00, 0x30, 0x30, 0xdd, 0x7e, 0xb0, 0x0c, 0x00,
+  0x0e, 0x00, 0x04, 0x95, 0x00, 0x00, 0x30, 0x06, 0x06, 0x33, 0x02, 0x01,
+  0xb6, 0x16, 0x05, 0x90, 0x0d, 0x22, 0x18, 0x0a, 0x11, 0x00, 0x00, 0x4c,
+  0x0d, 0x01, 0xac, 0x00, 0x75, 0x28, 0x39, 0x11, 0x64, 0xf4, 0x21, 0x24,
+  0x5a, 0x09, 0x41, 0x7e, 0xf8, 0xc6, 0xe0, 0xf7, 0x00, 0x10, 0xf9, 0x28,
+  0x0d, 0x40, 0xfd, 0xdd, 0x7e, 0xfa, 0x08, 0x00, 0x10, 0xfe, 0x3d, 0x02,
+  0x00, 0x38, 0x0d, 0x00, 0x2d, 0x00, 0x31, 0x28, 0x00, 0x39, 0x2c, 0x00,
+  0x0f, 0x4a, 0x01, 0x0d, 0x41, 0x43, 0x30, 0xf1, 0x33, 0x30, 0x10, 0x01,
+  0x01, 0x02, 0x36, 0x64, 0x3e, 0x07, 0x1b, 0x00, 0xf4, 0x04, 0xc7, 0x28,
+  0xf1, 0x33, 0xdd, 0x7e, 0xf4, 0xc6, 0x0e, 0x5f, 0xdd, 0x7e, 0xf5, 0xce,
+  0x00, 0x57, 0xd5, 0x21, 0x26, 0x82, 0x00, 0x10, 0xd1, 0xcb, 0x0e, 0xe0,
+  0x7e, 0xf9, 0xe6, 0x01, 0x47, 0xb1, 0x28, 0x2e, 0x21, 0x00, 0x02, 0xbf,
+  0xed, 0x42, 0x1c, 0x01, 0x32, 0x7e, 0xf8, 0x85, 0x97, 0x00, 0x12, 0x8c,
+  0x96, 0x00, 0x12, 0x89, 0x95, 0x00, 0x45, 0x88, 0xdd, 0x77, 0xff, 0x91,
+  0x00, 0x06, 0x5a, 0x02, 0x41, 0xf5, 0x3b, 0x0e, 0x1e, 0x59, 0x02, 0x11,
+  0xfe, 0x59, 0x02, 0x12, 0xff, 0x25, 0x04, 0x03, 0xed, 0x17, 0x70, 0xb7,
+  0x28, 0x2c, 0xfe, 0x2f, 0x28, 0x28, 0x48, 0x00, 0xf1, 0x05, 0x34, 0xfe,
+  0x20, 0x03, 0xdd, 0x34, 0xff, 0x1a, 0x47, 0x13, 0xdd, 0x73, 0x06, 0xdd,
+  0x72, 0x07, 0xdd, 0x7e, 0xfd, 0x90, 0xae, 0x00, 0xb5, 0x1e, 0x79, 0x3d,
+  0x4f, 0xb7, 0x20, 0xce, 0x2e, 0x01, 0x18, 0x14, 0xcc, 0x01, 0xa7, 0x07,
+  0xd6, 0x2f, 0x28, 0x03, 0x0e, 0x00, 0xca, 0x0e, 0x01, 0xc9, 0x0e, 0x10,
+  0xf5, 0x61, 0x00, 0x42, 0xb6, 0x04, 0x20, 0x09, 0x44, 0x10, 0x32, 0xc3,
+  0xd9, 0x1b, 0x87, 0x0b, 0x00, 0xce, 0x07, 0x62, 0x7e, 0x49, 0xcb, 0x77,
+  0x28, 0x09, 0xc6, 0x02, 0x50, 0xc3, 0xd9, 0x1b, 0xc5, 0xc5, 0xbf, 0x02,
+  0x73, 0xc1, 0xcb, 0x4d, 0x20, 0x09, 0x21, 0x01, 0x14, 0x00, 0x30, 0x33,
+  0x33, 0xc5, 0x47, 0x08, 0x00, 0x04, 0x06, 0x14, 0x00, 0x04, 0x06, 0x01,
+  0xb9, 0x16, 0x12, 0x09, 0xe3, 0x04, 0x36, 0xc3, 0xd9, 0x1b, 0x57, 0x10,
+  0x26, 0x21, 0x0a, 0x10, 0x19, 0x16, 0x6f, 0x10, 0x19, 0x92, 0xfd, 0x21,
+  0x0c, 0x00, 0xfd, 0x09, 0x2a, 0x71, 0xf4, 0x91, 0x03, 0x00, 0x70, 0x0f,
+  0x50, 0x36, 0x00, 0x23, 0x36, 0x80, 0x0f, 0x0f, 0x72, 0x36, 0x01, 0x23,
+  0x36, 0x00, 0x21, 0x0e, 0x3d, 0x0f, 0x20, 0x23, 0x77, 0x0d, 0x00, 0xc0,
+  0x1e, 0x00, 0x09, 0xeb, 0x2e, 0x00, 0x7d, 0x87, 0xe5, 0x6f, 0x26, 0x00,
+  0x05, 0x0c, 0xf0, 0x06, 0xfd, 0x19, 0xfd, 0x36, 0x00, 0x00, 0xfd, 0x36,
+  0x01, 0x00, 0x2c, 0x7d, 0xd6, 0x14, 0x38, 0xe6, 0xc5, 0xc5, 0xcd, 0x18,
+  0x23, 0x46, 0x0b, 0x03, 0xdc, 0x02, 0x34, 0x21, 0x0f, 0x99, 0xee, 0x18,
+  0x30, 0xcd, 0x05, 0x18, 0xa7, 0x18, 0x60, 0xc1, 0xcb, 0x45, 0x20, 0x07,
+  0xc5, 0xbd, 0x06, 0x23, 0x18, 0x0d, 0xdf, 0x0f, 0x00, 0xc9, 0x06, 0x27,
+  0x18, 0x0e, 0xd7, 0x06, 0x08, 0x55, 0x04, 0x10, 0xf4, 0xe7, 0x03, 0x06,
+  0x74, 0x06, 0x01, 0xa9, 0x07, 0x10, 0x0e, 0xd7, 0x00, 0xd1, 0xeb, 0x6b,
+  0x62, 0x23, 0x7e, 0x2b, 0x6e, 0xb5, 0x20, 0x0d, 0x21, 0x10, 0x99, 0xd4,
+  0x14, 0x00, 0x5e, 0x17, 0x11, 0x5b, 0x68, 0x09, 0x50, 0x2b, 0xcb, 0x46,
+  0x20, 0x50, 0xb7, 0x03, 0x31, 0xe5, 0xfd, 0xe1, 0xc3, 0x07, 0xf4, 0x04,
+  0xcd, 0x16, 0x47, 0xf1, 0xd1, 0xc1, 0xe1, 0xfd, 0x21, 0xda, 0x00, 0xfd,
+  0x09, 0xe5, 0xd5, 0xc5, 0xeb, 0x21, 0x0e, 0x34, 0x02, 0x90, 0xc1, 0xd1,
+  0xe1, 0xd5, 0xc5, 0xe5, 0xfd, 0xe5, 0xd1, 0x13, 0x00, 0x01, 0x12, 0x00,
+  0x90, 0xe1, 0xc1, 0xd1, 0xfd, 0x21, 0xd9, 0x00, 0xfd, 0x09, 0xb2, 0x09,
+  0x60, 0x7e, 0xfd, 0x77, 0x00, 0x21, 0xd8, 0x0d, 0x01, 0x11, 0xeb, 0x94,
+  0x00, 0x00, 0x45, 0x0d, 0x00, 0x80, 0x0f, 0x72, 0xd6, 0xc6, 0x20, 0x08,
+  0x78, 0xd6, 0x31, 0xe1, 0x09, 0x34, 0xee, 0x01, 0x6f, 0xd2, 0x01, 0x04,
+  0x62, 0x0f, 0x71, 0x1b, 0xf1, 0x4d, 0x44, 0x22, 0x92, 0xb4, 0x7e, 0x11,
+  0xf0, 0x11, 0x79, 0xd6, 0xc6, 0xc2, 0x49, 0x1e, 0x78, 0xd6, 0x31, 0xc2,
+  0x49, 0x1e, 0xed, 0x5b, 0x92, 0xb4, 0xfd, 0x21, 0x6c, 0x00, 0xfd, 0x19,
+  0xfd, 0x4e, 0x00, 0xfd, 0x46, 0x01, 0x78, 0xb1, 0x28, 0x55, 0xb8, 0x15,
+  0x40, 0xdb, 0x00, 0x09, 0xc1, 0xcf, 0x00, 0xf0, 0x03, 0xca, 0x49, 0x1e,
+  0x21, 0x6e, 0x00, 0x19, 0xeb, 0x0b, 0xfd, 0x71, 0x00, 0xfd, 0x70, 0x01,
+  0x69, 0x60, 0x29, 0x11, 0x09, 0x72, 0x79, 0xd6, 0x02, 0x78, 0xde, 0x00,
+  0xda, 0x3f, 0x00, 0x01, 0x17, 0x07, 0x04, 0x60, 0x07, 0xf1, 0x02, 0x79,
+  0x95, 0x78, 0x9c, 0xd2, 0x49, 0x1e, 0x21, 0xda, 0x00, 0x19, 0xe5, 0x5e,
+  0x23, 0x56, 0xe1, 0x1b, 0xf3, 0x11, 0x60, 0xc3, 0x61, 0x1e, 0xcd, 0xdf,
+  0x35, 0x55, 0x16, 0x90, 0x02, 0x00, 0x22, 0x94, 0xb4, 0x2a, 0x92, 0xb4,
+  0x23, 0x54, 0x09, 0x31, 0xfd, 0x21, 0x94, 0x9d, 0x0a, 0xe5, 0xfd, 0x7e,
+  0x01, 0x9a, 0xd2, 0x24, 0x1e, 0xc5, 0xaf, 0xf5, 0x33, 0x2a, 0x94, 0xb4,
+  0x0c, 0x08, 0x01, 0xf3, 0x06, 0x10, 0xc1, 0x13, 0x11, 0x01, 0x2b, 0x07,
+  0x00, 0x8b, 0x00, 0x50, 0x00, 0x00, 0x22, 0x96, 0xb4, 0x7b, 0x1a, 0x52,
+  0x70, 0xff, 0x2a, 0x96, 0xb4, 0xef, 0x06, 0x20, 0xd1, 0xd5, 0x6b, 0x00,
+  0x50, 0x7e, 0xe1, 0xb3, 0x20, 0x52, 0x56, 0x00, 0xd2, 0x7e, 0xb3, 0x20,
+  0x4a, 0xed, 0x4b, 0x92, 0xb4, 0x21, 0x6e, 0x00, 0x09, 0xeb, 0x59, 0x02,
+  0x04, 0x1c, 0x03, 0x02, 0xd1, 0x0e, 0x22, 0x29, 0x19, 0x83, 0x02, 0xa4,
+  0xed, 0x5b, 0x94, 0xb4, 0x1b, 0x1b, 0xcb, 0x23, 0xcb, 0x12, 0x04, 0x00,
+  0xa5, 0x7b, 0x21, 0x96, 0xb4, 0x86, 0x5f, 0x7a, 0x23, 0x8e, 0x57, 0x22,
+  0x12, 0x94, 0xdd, 0x7e, 0xfe, 0xd6, 0x32, 0xdd, 0xb6, 0xff, 0x20, 0x1e,
+  0x02, 0xf0, 0x01, 0xc7, 0x04, 0xf1, 0xc1, 0x18, 0x2d, 0x2a, 0x96, 0xb4,
+  0x23, 0x22, 0x96, 0xb4, 0xfd, 0x21, 0x96, 0xc1, 0x00, 0x10, 0xd6, 0x27,
+  0x0b, 0x57, 0xde, 0x00, 0xda, 0x7a, 0x1d, 0x25, 0x00, 0xf0, 0x04, 0x2a,
+  0x94, 0xb4, 0x23, 0x22, 0x94, 0xb4, 0xc3, 0x35, 0x1d, 0x2a, 0x92, 0xb4,
+  0x78, 0xb1, 0x20, 0x14, 0x11, 0xda, 0x4d, 0x0a, 0x44, 0x7e, 0xb1, 0x20,
+  0x14, 0xc0, 0x08, 0xf1, 0x00, 0x18, 0x22, 0x11, 0x6c, 0x00, 0x19, 0x71,
+  0x23, 0x70, 0xc3, 0xc0, 0x1c, 0x21, 0x1f, 0x99, 0xc2, 0x06, 0x32, 0x2a,
+  0x92, 0xb4, 0xe9, 0x02, 0x03, 0x24, 0x00, 0x05, 0x9f, 0x03, 0x09, 0xcb,
+  0x01, 0xd0, 0x5e, 0x23, 0x56, 0x7b, 0xd6, 0xc6, 0x20, 0x78, 0x7a, 0xd6,
+  0x31, 0x20, 0x73, 0xf3, 0x08, 0x12, 0x02, 0xf3, 0x08, 0x11, 0x17, 0xc9,
+  0x0b, 0x0d, 0xed, 0x08, 0x42, 0x0a, 0xc5, 0x21, 0x3c, 0x95, 0x02, 0x51,
+  0xc1, 0x21, 0xda, 0x00, 0x09, 0x9a, 0x01, 0x10, 0x13, 0x8b, 0x12, 0x45,
+  0x6c, 0x00, 0x09, 0xe5, 0x60, 0x05, 0x12, 0xe1, 0xed, 0x00, 0x22, 0x7e,
+  0xff, 0xa3, 0x05, 0xf5, 0x04, 0x1b, 0x79, 0xc6, 0x6e, 0x5f, 0x78, 0xce,
+  0x00, 0x57, 0xc1, 0xc5, 0x03, 0x71, 0x23, 0x70, 0xe1, 0xe5, 0x29, 0x19,
+  0x69, 0x1a, 0x05, 0x2a, 0x18, 0x07, 0x96, 0x00, 0x33, 0x33, 0x33, 0xe5,
+  0x5d, 0x02, 0x20, 0x33, 0x20, 0x5d, 0x02, 0x20, 0x33, 0x20, 0xaa, 0x12,
+  0x00, 0xa3, 0x08, 0x50, 0xfd, 0xce, 0x00, 0x57, 0x6b, 0x3d, 0x0f, 0x70,
+  0x78, 0xb1, 0xca, 0x24, 0x20, 0x3e, 0x32, 0x70, 0x1d, 0x30, 0xda, 0x24,
+  0x20, 0xc6, 0x13, 0xf2, 0x07, 0xc5, 0xdd, 0x4e, 0xfc, 0xdd, 0x46, 0xfd,
+  0xfd, 0x09, 0xc1, 0x0b, 0x6b, 0x62, 0x71, 0x23, 0x70, 0xcb, 0x21, 0xcb,
+  0x10, 0xfd, 0x09, 0x8c, 0x02, 0x00, 0x3f, 0x00, 0x13, 0xd8, 0xe9, 0x12,
+  0x82, 0x00, 0xdd, 0x77, 0xff, 0x78, 0xb1, 0x20, 0x24, 0xd1, 0x01, 0x00,
+  0x47, 0x01, 0x32, 0xc2, 0x24, 0x20, 0x24, 0x01, 0x01, 0x5a, 0x00, 0x11,
+  0x03, 0xff, 0x17, 0x00, 0x1a, 0x09, 0x24, 0x3b, 0x20, 0x8a, 0x03, 0x11,
+  0x2f, 0xcb, 0x07, 0x05, 0xa1, 0x0a, 0x01, 0x4f, 0x02, 0x61, 0xd1, 0xc1,
+  0x7c, 0xb5, 0x28, 0x6e, 0x88, 0x03, 0x50, 0xfd, 0xe5, 0xe1, 0x01, 0x66,
+  0x72, 0x03, 0x22, 0xe1, 0xc5, 0xb2, 0x01, 0x00, 0x27, 0x04, 0x02, 0x2b,
+  0x00, 0x43, 0x40, 0x27, 0xf1, 0xf1, 0xf6, 0x07, 0x85, 0x5e, 0x23, 0x56,
+  0x7a, 0xb3, 0x28, 0x3c, 0x1b, 0xa3, 0x04, 0x10, 0xc5, 0x25, 0x17, 0x0a,
+  0x55, 0x00, 0x97, 0xeb, 0xc1, 0x7a, 0xb3, 0x28, 0x19, 0x6b, 0x62, 0xd5,
+  0x8f, 0x1a, 0xd2, 0xc1, 0xd1, 0xc5, 0xd5, 0xcd, 0xd8, 0x04, 0xf1, 0xe1,
+  0x18, 0x17, 0x21, 0x4c, 0xdb, 0x01, 0x2f, 0xe1, 0xe5, 0xda, 0x01, 0x04,
+  0x01, 0xf0, 0x0a, 0x3f, 0xca, 0x1d, 0x21, 0x4d, 0x01, 0x02, 0x20, 0x1d,
+  0x21, 0x4d, 0x01, 0x00, 0x1d, 0x00, 0x09, 0x17, 0x1c, 0x00, 0xa3, 0x00,
+  0x31, 0xdd, 0x7e, 0xfe, 0x60, 0x01, 0x14, 0xff, 0x60, 0x01, 0x70, 0x79,
+  0xd6, 0x32, 0xb0, 0x20, 0x47, 0xd5, 0xa2, 0x00, 0x0b, 0x2f, 0x00, 0x02,
+  0xfd, 0x00, 0xd4, 0x7c, 0xb5, 0x28, 0x22, 0x4d, 0x44, 0xd5, 0xfd, 0xe1,
+  0xe5, 0xd5, 0x59, 0x50, 0x00, 0x01, 0x40, 0xd1, 0xe1, 0xd5, 0xe5, 0xaa,
+  0x00, 0x30, 0xd1, 0x6b, 0x62, 0x5a, 0x05, 0x23, 0x18, 0x07, 0xa8, 0x00,
+  0x00, 0x5e, 0x00, 0x21, 0xd8, 0x6f, 0x5e, 0x00, 0x10, 0x67, 0x8d, 0x00,
+  0x10, 0xe1, 0x06, 0x02, 0x00, 0xb4, 0x01, 0x20, 0xc1, 0xc5, 0x33, 0x09,
+  0x02, 0xec, 0x0b, 0x25, 0x09, 0xe3, 0x7f, 0x14, 0x02, 0xbb, 0x01, 0xc5,
+  0xdd, 0x7e, 0x06, 0xfd, 0x77, 0x00, 0xdd, 0x7e, 0x07, 0xfd, 0x77, 0x01,
+  0x98, 0x1a, 0x31, 0x00, 0x00, 0x68, 0x9d, 0x0a, 0x50, 0xeb, 0x21, 0x87,
+  0xaa, 0x19, 0x32, 0x00, 0x23, 0xc6, 0x07, 0x59, 0x00, 0x60, 0x7e, 0xb7,
+  0x20, 0x15, 0x36, 0x01, 0x12, 0x00, 0x13, 0x04, 0x12, 0x00, 0x00, 0x84,
+  0x00, 0xa3, 0x69, 0x18, 0x0f, 0x04, 0x78, 0x4f, 0xd6, 0x0f, 0x38, 0xc8,
+  0x1e, 0x0b, 0x13, 0xff, 0x4b, 0x00, 0x05, 0x80, 0x14, 0x11, 0x04, 0x80,
+  0x14, 0x30, 0xfd, 0x21, 0x49, 0xba, 0x04, 0x62, 0x5e, 0x00, 0x7b, 0xe6,
+  0x0f, 0x57, 0xc3, 0x15, 0xf3, 0x0a, 0x7e, 0x07, 0x30, 0x16, 0x7a, 0xd6,
+  0x0f, 0x20, 0x03, 0x57, 0x18, 0x01, 0x15, 0x7b, 0xe6, 0xf0, 0xb2, 0xfd,
+  0x77, 0x00, 0xfd, 0xe5, 0xcd, 0x10, 0x4a, 0x42, 0x00, 0x61, 0x01, 0x87,
+  0xaa, 0xdd, 0x6e, 0x04, 0x8e, 0x00, 0xf0, 0x10, 0x09, 0xeb, 0x21, 0x07,
+  0x00, 0x19, 0x7e, 0x3d, 0x77, 0xb7, 0x20, 0x21, 0x21, 0x04, 0x00, 0x19,
+  0xe5, 0x4e, 0x23, 0x7e, 0xe1, 0xb1, 0x28, 0x15, 0xe5, 0xd5, 0xcd, 0x6c,
+  0x21, 0xf1, 0xe1, 0xf4, 0x00, 0x01, 0x1a, 0x06, 0x10, 0xe1, 0x93, 0x00,
+  0x05, 0x80, 0x00, 0xf2, 0x0b, 0x11, 0x7b, 0xf4, 0x41, 0x78, 0xd6, 0x0a,
+  0x30, 0x0f, 0x68, 0x26, 0x00, 0x19, 0x7e, 0x3c, 0x20, 0x03, 0x69, 0x18,
+  0x0c, 0x04, 0x48, 0x18, 0xec, 0x21, 0x18, 0xaa, 0x00, 0x02, 0x4e, 0x1d,
+  0x32, 0xcd, 0xec, 0x21, 0xc9, 0x13, 0x24, 0xf5, 0x3b, 0x83, 0x01, 0x10,
+  0x11, 0xa3, 0x0c, 0x14, 0xfb, 0x0e, 0x00, 0x33, 0xc2, 0x2a, 0xf1, 0xea,
+  0x15, 0x10, 0x46, 0xea, 0x15, 0x72, 0xb7, 0x20, 0x0c, 0xc5, 0xd5, 0x21,
+  0x60, 0xa5, 0x03, 0x74, 0xd1, 0xc1, 0xdd, 0x7e, 0xfb, 0xd6, 0x10, 0xaf,
+  0x12, 0x42, 0xfc, 0xb7, 0x28, 0x0f, 0x37, 0x00, 0x21, 0xc5, 0xd5, 0xca,
+  0x00, 0x30, 0xd1, 0xc1, 0x1a, 0x02, 0x16, 0x22, 0xfd, 0x12, 0xb4, 0x17,
+  0x00, 0x46, 0x07, 0x00, 0xd4, 0x11, 0x23, 0x20, 0x27, 0xa9, 0x0a, 0x01,
+  0xfe, 0x02, 0xf0, 0x03, 0x1a, 0xdd, 0x7e, 0xfb, 0xfe, 0x80, 0x28, 0x0a,
+  0xfe, 0x40, 0x28, 0x06, 0xdd, 0x7e, 0xfc, 0xb7, 0x28, 0x09, 0xf5, 0x1b,
+  0x20, 0xe9, 0x23, 0x3e, 0x00, 0x32, 0xb7, 0x20, 0x3f, 0xd5, 0x07, 0x31,
+  0x07, 0x30, 0x36, 0xbd, 0x06, 0x08, 0x39, 0x00, 0x65, 0x1f, 0x12, 0x13,
+  0x3e, 0x00, 0x12, 0x64, 0x01, 0x04, 0x52, 0x04, 0x00, 0x7c, 0x00, 0x51,
+  0x66, 0x1e, 0xf1, 0xf1, 0xc1, 0x54, 0x07, 0x05, 0x7d, 0x06, 0x01, 0x07,
+  0x07, 0x00, 0x79, 0x01, 0x02, 0xdc, 0x02, 0x12, 0x6d, 0xeb, 0x02, 0x0a,
+  0x1d, 0x04, 0x00, 0xec, 0x00, 0x00, 0xc2, 0x08, 0x11, 0xfc, 0xc2, 0x08,
+  0x10, 0xfd, 0xd8, 0x03, 0x02, 0xd0, 0x08, 0x02, 0xd8, 0x03, 0x05, 0x69,
+  0x03, 0x06, 0xfa, 0x0c, 0x00, 0x60, 0x10, 0x00, 0x80, 0x01, 0x07, 0x14,
+  0x0f, 0x53, 0xeb, 0xe1, 0x7a, 0xb3, 0x28, 0xb4, 0x16, 0x17, 0x7e, 0xee,
+  0x0c, 0x31, 0x19, 0x4d, 0x44, 0x68, 0x04, 0x11, 0x6f, 0x4f, 0x00, 0x41,
+  0x67, 0xd5, 0x59, 0x50, 0xfe, 0x0c, 0x61, 0xd1, 0x3e, 0x02, 0xf5, 0x33,
+  0xd5, 0xbb, 0x1e, 0x00, 0x1f, 0x00, 0x00, 0xae, 0x0c, 0x10, 0xfd, 0x34,
+  0x0c, 0x51, 0xcb, 0xbf, 0x02, 0x18, 0x08, 0xda, 0x01, 0x26, 0xfd, 0x22,
+  0xc6, 0x00, 0x00, 0x12, 0x17, 0xd0, 0x23, 0x46, 0x0e, 0x00, 0x78, 0xe6,
+  0x20, 0xb1, 0xd6, 0x01, 0x3e, 0x00, 0x17, 0x43, 0x07, 0x01, 0x19, 0x00,
+  0x10, 0x1e, 0xb5, 0x05, 0x24, 0x66, 0x69, 0xcc, 0x01, 0x02, 0xb3, 0x01,
+  0x60, 0x49, 0x00, 0x09, 0xe3, 0xe1, 0xe5, 0xd9, 0x0b, 0x12, 0x0c, 0x13,
+  0x09, 0x00, 0x03, 0x22, 0x20, 0xa3, 0x24, 0x2b, 0x01, 0x00, 0x3d, 0x19,
+  0x10, 0x1e, 0x96, 0x01, 0x40, 0xfd, 0xdd, 0x74, 0xfe, 0x65, 0x01, 0x70,
+  0x6e, 0x44, 0xfd, 0x66, 0x45, 0xc5, 0xd5, 0x8f, 0x00, 0x51, 0xe5, 0xd5,
+  0xcd, 0xa8, 0x24, 0x85, 0x04, 0x01, 0x19, 0x00, 0x51, 0x42, 0xfd, 0x66,
+  0x43, 0xc5, 0xad, 0x03, 0x06, 0x19, 0x00, 0xf2, 0x03, 0xdd, 0x36, 0xff,
+  0x11, 0xdd, 0x7e, 0xff, 0x87, 0xdd, 0x86, 0xfd, 0x6f, 0x3e, 0x00, 0xdd,
+  0x8e, 0xfe, 0x67, 0x7c, 0x01, 0x19, 0xaf, 0x25, 0x00, 0x80, 0x35, 0xff,
+  0xdd, 0xcb, 0xff, 0x7e, 0x28, 0xd6, 0x6a, 0x00, 0x90, 0xc5, 0x06, 0x28,
+  0x36, 0x00, 0x23, 0x10, 0xfb, 0xc1, 0x91, 0x00, 0x4a, 0xff, 0xe1, 0xe5,
+  0x77, 0x23, 0x09, 0x07, 0xe0, 0x0f, 0x04, 0x69, 0x04, 0x81, 0x3d, 0x25,
+  0xdd, 0x7e, 0x08, 0xb7, 0x28, 0x6e, 0xe0, 0x0a, 0x0e, 0x26, 0x04, 0x01,
+  0x71, 0x07, 0x01, 0x6f, 0x18, 0x14, 0x0d, 0x18, 0x00, 0x72, 0xfd, 0x22,
+  0xf1, 0x18, 0x52, 0xc1, 0xc5, 0x79, 0x07, 0xd0, 0x01, 0xff, 0x00, 0xdd,
+  0x5e, 0x08, 0x1d, 0x69, 0x60, 0x29, 0x7d, 0xdd, 0x86, 0xaa, 0x1a, 0xb5,
+  0x8e, 0xff, 0x67, 0x56, 0x23, 0x66, 0xc5, 0x7b, 0xf5, 0x33, 0x6a, 0x4a,
+  0x00, 0x01, 0xaa, 0x00, 0x60, 0xc1, 0x0b, 0xcb, 0x78, 0x28, 0xd3, 0xe8,
+  0x18, 0x00, 0x8b, 0x0e, 0x0b, 0xc0, 0x04, 0x22, 0x20, 0xf1, 0x7f, 0x01,
+  0x05, 0x86, 0x11, 0x06, 0x27, 0x03, 0x52, 0x7d, 0xd6, 0x60, 0x20, 0x09,
+  0x30, 0x00, 0x38, 0xc3, 0x3b, 0x27, 0x5a, 0x19, 0x40, 0xf8, 0xdd, 0x74,
+  0xf9, 0xf6, 0x22, 0x00, 0xb0, 0x06, 0x11, 0xfb, 0xff, 0x09, 0x00, 0x8c,
+  0x01, 0x06, 0xfa, 0x0f, 0x11, 0x12, 0x07, 0x07, 0x22, 0x30, 0x50, 0x3d,
+  0x00, 0x10, 0x29, 0xd3, 0x03, 0xf5, 0x02, 0x46, 0xe1, 0x33, 0x33, 0xc5,
+  0x78, 0xb1, 0x20, 0x37, 0xdd, 0x7e, 0x09, 0xdd, 0xb6, 0x08, 0x20, 0x16,
+  0xd9, 0x18, 0x53, 0xfb, 0x1e, 0xf1, 0x4d, 0x44, 0x1e, 0x00, 0x01, 0xc5,
+  0x23, 0x53, 0x3b, 0x27, 0x71, 0x23, 0x70, 0x75, 0x0e, 0x22, 0xcb, 0xff,
+  0x09, 0x00, 0x30, 0x77, 0xe1, 0xe5, 0x84, 0x00, 0xa0, 0x7e, 0x06, 0xc6,
+  0xee, 0xdd, 0x77, 0x06, 0xdd, 0x7e, 0x07, 0x3c, 0x0c, 0x10, 0x07, 0xc7,
+  0x0b, 0x31, 0x36, 0xfe, 0x02, 0xfa, 0x11, 0x70, 0x7e, 0x07, 0xb7, 0x28,
+  0x1b, 0x01, 0x08, 0x19, 0x24, 0x27, 0xc6, 0x00, 0x24, 0x00, 0x41, 0xdd,
+  0x36, 0xfe, 0x01, 0x21, 0x00, 0x83, 0x6e, 0xfe, 0x3e, 0x14, 0x95, 0x87,
+  0x6f, 0x26, 0x13, 0x09, 0x73, 0x33, 0x33, 0xd5, 0x7a, 0xb3, 0x20, 0x38,
+  0x8f, 0x00, 0xa0, 0x17, 0xe5, 0xc5, 0xdd, 0x5e, 0xfa, 0xdd, 0x56, 0xfb,
+  0xd5, 0x90, 0x00, 0x23, 0xeb, 0xc1, 0x1f, 0x00, 0x03, 0x90, 0x00, 0x01,
+  0x44, 0x1b, 0x0a, 0x90, 0x00, 0x02, 0x37, 0x1c, 0xf1, 0x03, 0x3e, 0x02,
+  0xdd, 0xbe, 0xfe, 0x3e, 0x00, 0xdd, 0x9e, 0xff, 0xe2, 0x87, 0x26, 0xee,
+  0x80, 0xfa, 0x39, 0x27, 0xce, 0x01, 0x03, 0xd7, 0x23, 0x02, 0xe2, 0x0a,
+  0x06, 0x33, 0x10, 0x12, 0x14, 0x83, 0x12, 0x04, 0xf7, 0x02, 0x01, 0x27,
+  0x07, 0x10, 0x27, 0xc4, 0x0d, 0xf0, 0x03, 0x6e, 0x06, 0xdd, 0x5e, 0x07,
+  0x3c, 0x18, 0x04, 0xcb, 0x3b, 0xcb, 0x1d, 0x3d, 0x20, 0xf9, 0x26, 0x00,
+  0x29, 0xc9, 0x0a, 0x00, 0x73, 0x02, 0x71, 0x33, 0x33, 0xe5, 0x7c, 0xb5,
+  0x28, 0x07, 0x31, 0x12, 0x24, 0x18, 0x36, 0x3c, 0x01, 0x00, 0xe2, 0x21,
+  0x02, 0x5d, 0x00, 0x40, 0xfb, 0x1e, 0xf1, 0xd1, 0x9c, 0x09, 0x41, 0x7c,
+  0xb5, 0x20, 0x0a, 0x25, 0x00, 0x00, 0xa8, 0x19, 0x10, 0x2c, 0xe5, 0x0a,
+  0x60, 0xed, 0xa0, 0x7e, 0x12, 0x03, 0xc5, 0x52, 0x06, 0x00, 0x79, 0x03,
+  0x11, 0xf8, 0xf7, 0x03, 0x01, 0xaa, 0x1a, 0x00, 0xa4, 0x0c, 0x30, 0xc2,
+  0x78, 0x26, 0x79, 0x12, 0x45, 0x78, 0x26, 0xe1, 0xe5, 0x54, 0x1a, 0x0b,
+  0x4f, 0x0b, 0x12, 0x0b, 0xa1, 0x1a, 0x72, 0x7e, 0x23, 0xb6, 0x20, 0x0a,
+  0x21, 0x82, 0x12, 0x05, 0x25, 0x18, 0x2e, 0x74, 0x1a, 0xe2, 0xdd, 0x7e,
+  0x06, 0x93, 0xdd, 0x7e, 0x07, 0x9a, 0x38, 0x13, 0x69, 0x60, 0x11, 0x0a,
+  0xc9, 0x1a, 0xb2, 0x7e, 0x06, 0x91, 0xdd, 0x7e, 0x07, 0x98, 0x38, 0x08,
+  0x21, 0x98, 0x30, 0x00, 0x03, 0x5a, 0x00, 0x91, 0x7e, 0x04, 0xd6, 0x0a,
+  0x30, 0x0e, 0x01, 0x7b, 0xf4, 0xf3, 0x05, 0x83, 0x09, 0x5e, 0x7b, 0x3c,
+  0x20, 0x0a, 0x21, 0x09, 0x7d, 0x09, 0xc3, 0x46, 0x7b, 0xfe, 0x0f, 0x30,
+  0x03, 0x3c, 0x20, 0x0a, 0xd5, 0x21, 0xae, 0x78, 0x05, 0x60, 0x01, 0x87,
+  0xaa, 0x26, 0x00, 0x6b, 0x1b, 0x06, 0x03, 0xfd, 0x04, 0xf0, 0x01, 0x4b,
+  0x42, 0x7b, 0xd6, 0xff, 0x7a, 0xde, 0xaa, 0x38, 0x08, 0x79, 0xd6, 0xdb,
+  0x78, 0xde, 0xb0, 0x4a, 0x09, 0x13, 0xc7, 0x4a, 0x09, 0x20, 0xc5, 0xc5,
+  0xd9, 0x04, 0x92, 0xe1, 0xdd, 0xe1, 0xc9, 0xed, 0x4b, 0x6f, 0xf4, 0x78,
+  0x38, 0x04, 0x40, 0x6f, 0xc9, 0x2a, 0x6f, 0x27, 0x0e, 0x03, 0x17, 0x0d,
+  0x23, 0x2e, 0x01, 0x3d, 0x26, 0xe8, 0xf5, 0xf5, 0xcd, 0x05, 0x28, 0xcb,
+  0x45, 0x28, 0x05, 0x2e, 0x07, 0xc3, 0xc2, 0x28, 0x0e, 0x05, 0x23, 0xe1,
+  0xe5, 0x8f, 0x1b, 0x20, 0xe1, 0xe5, 0xcf, 0x00, 0x05, 0x8e, 0x09, 0x01,
+  0x18, 0x0d, 0x30, 0x7e, 0xfe, 0x93, 0x44, 0x12, 0xf1, 0x04, 0xff, 0x92,
+  0x20, 0x0b, 0x3e, 0x06, 0xcb, 0x28, 0xcb, 0x19, 0x3d, 0x20, 0xf9, 0x18,
+  0x49, 0xe1, 0xe5, 0x11, 0x0c, 0x9f, 0x00, 0x36, 0x21, 0x71, 0xf4, 0xf0,
+  0x25, 0x01, 0x9d, 0x03, 0xf0, 0x05, 0x3e, 0x03, 0xdd, 0xcb, 0xff, 0x2e,
+  0xdd, 0xcb, 0xfe, 0x1e, 0x3d, 0x20, 0xf5, 0x7b, 0xdd, 0x96, 0xfc, 0x20,
+  0x0c, 0x7a, 0xb0, 0x13, 0x10, 0x06, 0x0b, 0x1b, 0x80, 0x18, 0x0f, 0xc5,
+  0xd5, 0xcd, 0x36, 0x89, 0xf1, 0x04, 0x09, 0x10, 0x04, 0x11, 0x00, 0x4a,
+  0x79, 0xe6, 0x07, 0x6f, 0xdb, 0x1b, 0x00, 0x4f, 0x03, 0xf0, 0x04, 0x7e,
+  0xcb, 0x77, 0x20, 0x35, 0xcb, 0xff, 0x77, 0xdd, 0x5e, 0x06, 0xcb, 0x43,
+  0x28, 0x0d, 0x21, 0x12, 0x00, 0x09, 0xfd, 0x05, 0x10, 0x34, 0xb4, 0x0c,
+  0x68, 0xcb, 0x4b, 0x28, 0x0d, 0x21, 0x16, 0x11, 0x00, 0x71, 0x53, 0x28,
+  0x09, 0x21, 0x1a, 0x00, 0x09, 0x0f, 0x00, 0x08, 0x4e, 0x05, 0xf0, 0x0f,
+  0x7e, 0xe6, 0xf0, 0x6f, 0xc9, 0x01, 0xdb, 0xb0, 0xc5, 0xfd, 0xe1, 0x1e,
+  0x00, 0xfd, 0x56, 0x00, 0xfd, 0x6e, 0x01, 0x14, 0x20, 0x06, 0x2c, 0x20,
+  0x03, 0x69, 0x60, 0xc9, 0x01, 0xe3, 0xa9, 0x1c, 0x80, 0xe5, 0xc1, 0x1c,
+  0x7b, 0xd6, 0x04, 0x38, 0xe3, 0xaa, 0x1b, 0x02, 0xa0, 0x04, 0xcd, 0x36,
+  0xfc, 0xdb, 0xdd, 0x36, 0xfd, 0xb0, 0xd1, 0xd5, 0x01, 0x00, 0x00, 0xbd,
+  0x22, 0x13, 0x0c, 0x6b, 0x13, 0x33, 0x04, 0xe1, 0xe5, 0x5b, 0x14, 0x73,
+  0x33, 0x33, 0xd5, 0x03, 0x79, 0xd6, 0x04, 0x5e, 0x10, 0x18, 0xce, 0xec,
+  0x04, 0x07, 0xbc, 0x0f, 0x81, 0xde, 0x08, 0xf1, 0x33, 0x4d, 0x7c, 0xb1,
+  0x28, 0x38, 0x13, 0x51, 0xbe, 0x2a, 0xcd, 0x1f, 0x29, 0x14, 0x03, 0x13,
+  0x0b, 0xb1, 0x07, 0x00, 0x14, 0x00, 0x00, 0x04, 0x07, 0x20, 0xc5, 0xe5,
+  0x05, 0x25, 0x01, 0xb6, 0x15, 0x0b, 0x30, 0x0a, 0x02, 0x72, 0x13, 0x50,
+  0xbe, 0x2a, 0x33, 0x33, 0xd5, 0x39, 0x0a, 0x80, 0xd5, 0xc5, 0xdd, 0x5e,
+  0xfe, 0xdd, 0x56, 0xff, 0x40, 0x09, 0x12, 0xdd, 0xb2, 0x0d, 0x00, 0x0e,
+  0x01, 0x00, 0x7d, 0x15, 0x11, 0xc1, 0x3c, 0x03, 0x99, 0xd6, 0xc6, 0x20,
+  0x31, 0x7c, 0xd6, 0x31, 0x20, 0x2c, 0x31, 0x14, 0x00, 0x21, 0x14, 0x54,
+  0x6e, 0x04, 0xfd, 0x66, 0x05, 0x21, 0x23, 0x20, 0x30, 0x0c, 0x69, 0x0d,
+  0x10, 0xdc, 0x69, 0x0d, 0x00, 0xb9, 0x1c, 0x01, 0xa6, 0x1f, 0x60, 0x2e,
+  0x00, 0x18, 0x6b, 0x21, 0xd2, 0x95, 0x08, 0x50, 0x20, 0x1a, 0x11, 0xd9,
+  0x99, 0xf4, 0x23, 0xd0, 0x9e, 0x0d, 0xf1, 0xc1, 0xe1, 0xdd, 0x7e, 0x08,
+  0xf6, 0x01, 0xdd, 0x77, 0x08, 0x88, 0x03, 0x21, 0x77, 0x09, 0xe7, 0x25,
+  0x71, 0x04, 0x36, 0x01, 0x18, 0x02, 0x36, 0x02, 0x87, 0x1f, 0x05, 0x00,
+  0x26, 0x02, 0xee, 0x16, 0x13, 0x0b, 0x0e, 0x1f, 0x40, 0x46, 0x00, 0x19,
+  0x34, 0x62, 0x28, 0x30, 0xdd, 0x7e, 0x08, 0xa3, 0x09, 0x45, 0x09, 0x12,
+  0x69, 0x60, 0x1a, 0x23, 0x54, 0xc5, 0xcd, 0xdf, 0x35, 0xe1, 0xb1, 0x01,
+  0x01, 0x3b, 0x0a, 0xa7, 0x91, 0x20, 0x04, 0x78, 0xd6, 0x60, 0xc8, 0x21,
+  0x0c, 0x9a, 0x8b, 0x26, 0x07, 0x94, 0x05, 0x54, 0x40, 0x20, 0x0b, 0x21,
+  0x15, 0x92, 0x1d, 0x11, 0x6b, 0x29, 0x21, 0x3a, 0x1a, 0x9a, 0xe5, 0x68,
+  0x21, 0x03, 0x56, 0x0f, 0x40, 0xcb, 0x45, 0x20, 0x05, 0x26, 0x00, 0x1c,
+  0x45, 0xaf, 0x1f, 0x43, 0x56, 0x01, 0x6b, 0x62, 0x70, 0x1e, 0x30, 0x7a,
+  0xb3, 0x20, 0xba, 0x09, 0x60, 0xfd, 0x56, 0x01, 0x13, 0x13, 0x6a, 0xae,
+  0x1e, 0x61, 0x75, 0x01, 0xc5, 0x21, 0x1b, 0x9a, 0x40, 0x28, 0x61, 0xc1,
+  0x3e, 0x04, 0xf5, 0x33, 0xc5, 0x5b, 0x11, 0x02, 0xfa, 0x1d, 0x01, 0x27,
+  0x0b, 0x01, 0x27, 0x1a, 0x71, 0x33, 0x33, 0xd5, 0xe1, 0xe5, 0x01, 0x0e,
+  0x76, 0x1e, 0x41, 0x78, 0xb1, 0x20, 0x2a, 0x78, 0x15, 0x42, 0x48, 0xb7,
+  0x28, 0x17, 0x6b, 0x00, 0x11, 0xd5, 0xc8, 0x22, 0x42, 0xc5, 0xcd, 0x6d,
+  0x0d, 0xef, 0x0a, 0x10, 0xd3, 0x33, 0x0e, 0x10, 0x62, 0x58, 0x01, 0xf5,
+  0x02, 0x11, 0x2a, 0x62, 0xf4, 0x7d, 0x91, 0x7c, 0x98, 0x30, 0x02, 0x4d,
+  0x44, 0xed, 0x43, 0x62, 0xf4, 0x2e, 0x9f, 0x0a, 0x02, 0x3a, 0x00, 0x32,
+  0x33, 0x33, 0xc5, 0xf1, 0x17, 0xa1, 0x5e, 0x23, 0x56, 0xaf, 0xbb, 0x3e,
+  0x10, 0x9a, 0x30, 0x41, 0x24, 0x09, 0x43, 0x47, 0xb7, 0x20, 0x1d, 0x90,
+  0x1e, 0x11, 0x20, 0x57, 0x18, 0xf2, 0x01, 0x00, 0xf4, 0x3e, 0x0d, 0xf5,
+  0x33, 0xe5, 0xcd, 0x43, 0x54, 0xf1, 0x33, 0x2e, 0x01, 0x18, 0x1d, 0x98,
+  0x00, 0x11, 0xc5, 0x79, 0x00, 0x11, 0xd5, 0x79, 0x00, 0x00, 0x60, 0x03,
+  0x12, 0xb3, 0x07, 0x1f, 0x00, 0x64, 0x00, 0x72, 0x2a, 0x64, 0xf4, 0x7c,
+  0xe6, 0x01, 0x67, 0xe4, 0x02, 0x00, 0x76, 0x12, 0x06, 0xfd, 0x1b, 0x01,
+  0x7a, 0x00, 0x10, 0x11, 0x14, 0x12, 0x20, 0xfc, 0x81, 0xa2, 0x08, 0x60,
+  0x88, 0x47, 0xdd, 0x7e, 0xfe, 0x8b, 0xd3, 0x0b, 0xa0, 0x8a, 0x57, 0xed,
+  0x43, 0x64, 0xf4, 0xed, 0x53, 0x66, 0xf4, 0xb8, 0x00, 0x90, 0xdd, 0x96,
+  0x04, 0x4f, 0x7c, 0xdd, 0x9e, 0x05, 0x47, 0xba, 0x00, 0x20, 0xed, 0x4b,
+  0xd4, 0x13, 0x10, 0x04, 0x31, 0x00, 0xa0, 0x05, 0x88, 0x47, 0xed, 0x43,
+  0x97, 0xf4, 0xed, 0x5b, 0x60, 0x12, 0x00, 0xa0, 0x83, 0x5f, 0xdd, 0x7e,
+  0x05, 0x8a, 0x57, 0xed, 0x53, 0x60, 0xd0, 0x22, 0x05, 0xd8, 0x03, 0x00,
+  0xf4, 0x11, 0xf0, 0x03, 0xed, 0x5b, 0x62, 0xf4, 0xc5, 0xd5, 0xcd, 0x24,
+  0x2c, 0xd1, 0xc1, 0xaf, 0x95, 0x6f, 0x3e, 0x02, 0x9c, 0x67, 0xe2, 0x20,
+  0x20, 0x30, 0x06, 0x18, 0x00, 0xf3, 0x09, 0x18, 0x0c, 0xc5, 0xcd, 0x24,
+  0x2c, 0xc1, 0xaf, 0x95, 0x5f, 0x3e, 0x02, 0x9c, 0x57, 0x7b, 0x02, 0x03,
+  0x7a, 0x02, 0xdd, 0x4e, 0x08, 0x06, 0x00, 0xa8, 0x22, 0x27, 0x3e, 0x09,
+  0xc0, 0x22, 0x06, 0xe3, 0x27, 0x01, 0xce, 0x18, 0x03, 0xc0, 0x07, 0x14,
+  0xed, 0xfd, 0x14, 0x04, 0xa4, 0x12, 0x04, 0x31, 0x15, 0x30, 0xdd, 0x77,
+  0xef, 0x05, 0x00, 0x40, 0xf0, 0xdd, 0x36, 0xf1, 0x8b, 0x08, 0x23, 0x22,
+  0x97, 0xeb, 0x11, 0x04, 0x0e, 0x0b, 0x60, 0x7d, 0xd6, 0x10, 0xca, 0x03,
+  0x2e, 0xff, 0x0b, 0x11, 0x1e, 0x11, 0x05, 0x12, 0xff, 0x2d, 0x16, 0x70,
+  0x7e, 0xfb, 0xd6, 0x20, 0xca, 0x1c, 0x30, 0x08, 0x00, 0x20, 0x40, 0x28,
+  0xc9, 0x0a, 0x50, 0xd6, 0x60, 0xca, 0x1f, 0x2e, 0x08, 0x00, 0x30, 0x80,
+  0x28, 0x0b, 0x07, 0x00, 0x73, 0xc0, 0xca, 0x03, 0x2e, 0xc3, 0x38, 0x30,
+  0x25, 0x14, 0x11, 0x0e, 0x37, 0x05, 0x02, 0x15, 0x08, 0x00, 0x05, 0x00,
+  0x02, 0x11, 0x05, 0xf2, 0x0b, 0xed, 0x4b, 0x64, 0xf4, 0xed, 0x5b, 0x66,
+  0xf4, 0x79, 0xdd, 0x96, 0xfa, 0x78, 0xdd, 0x9e, 0xfb, 0x7b, 0xdd, 0x9e,
+  0xfc, 0x7a, 0xdd, 0x9e, 0xfd, 0x38, 0x08, 0x14, 0x02, 0x90, 0x18, 0x71,
+  0x2a, 0x62, 0xf4, 0xdd, 0x7e, 0xfa, 0x91, 0x4f, 0x16, 0x10, 0x98, 0xf9,
+  0x16, 0x10, 0x9b, 0xac, 0x0e, 0x22, 0x9a, 0x57, 0x06, 0x23, 0x40, 0xdd,
+  0x36, 0xfc, 0x00, 0x85, 0x1f, 0x00, 0x22, 0x00, 0x00, 0x21, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x1f, 0x00, 0x23, 0x30, 0x09, 0xec, 0x19, 0x20, 0x56,
+  0xfd, 0x8d, 0x01, 0x61, 0x18, 0x2b, 0xdd, 0x36, 0xf1, 0x01, 0xfd, 0x01,
+  0x04, 0x1a, 0x01, 0xb5, 0x67, 0x2b, 0xf1, 0x33, 0x7d, 0xb7, 0x20, 0x12,
+  0xc3, 0x3e, 0x30, 0xc2, 0x16, 0x02, 0x07, 0x01, 0x01, 0xae, 0x24, 0x15,
+  0xf0, 0xae, 0x24, 0x91, 0xdd, 0x75, 0xf2, 0xdd, 0x74, 0xf3, 0xdd, 0x7e,
+  0xfe, 0x36, 0x16, 0xd0, 0xff, 0xdd, 0x77, 0xf5, 0xed, 0x4b, 0x62, 0xf4,
+  0x78, 0xb1, 0xca, 0x06, 0x30, 0x24, 0x02, 0x01, 0x1a, 0x0a, 0x04, 0x2e,
+  0x16, 0x52, 0x9f, 0x2c, 0xf1, 0xf1, 0x33, 0x01, 0x09, 0xa3, 0xdd, 0x7e,
+  0xf8, 0x3c, 0x20, 0x09, 0xdd, 0x7e, 0xf9, 0x3c, 0xc5, 0x1e, 0x65, 0xcb,
+  0x41, 0xc2, 0x3a, 0x2f, 0xc5, 0xce, 0x2b, 0x42, 0xef, 0xdd, 0x66, 0xf0,
+  0x38, 0x2a, 0x12, 0xc1, 0x28, 0x16, 0x90, 0x7c, 0xb5, 0xc2, 0x3a, 0x2f,
+  0xdd, 0xcb, 0xf1, 0x46, 0x07, 0x00, 0x31, 0x7e, 0xed, 0xb7, 0x07, 0x00,
+  0xc0, 0xee, 0xd6, 0x02, 0x20, 0x7b, 0x3a, 0x6a, 0xf4, 0xcb, 0x47, 0x20,
+  0x74, 0x95, 0x02, 0x14, 0x0d, 0x95, 0x02, 0x20, 0x21, 0x62, 0x55, 0x06,
+  0x02, 0xb5, 0x04, 0x10, 0x21, 0x22, 0x01, 0x10, 0xed, 0x32, 0x04, 0xf4,
+  0x03, 0xee, 0x77, 0xdd, 0x46, 0xf8, 0xdd, 0x5e, 0xf9, 0x16, 0x00, 0x0e,
+  0x00, 0xcb, 0x20, 0xcb, 0x13, 0xcb, 0x12, 0xa0, 0x02, 0x65, 0xdd, 0x6e,
+  0xf2, 0xdd, 0x66, 0xf3, 0x8b, 0x26, 0x10, 0xef, 0x44, 0x05, 0x05, 0x45,
+  0x26, 0x03, 0x5a, 0x00, 0x04, 0x59, 0x00, 0x06, 0xbd, 0x15, 0x82, 0x5c,
+  0x79, 0xb7, 0x28, 0x0b, 0xcd, 0x56, 0x05, 0xa2, 0x00, 0x20, 0x18, 0x25,
+  0x73, 0x1b, 0x41, 0xb6, 0xf6, 0x20, 0x1d, 0xb9, 0x05, 0x09, 0xc9, 0x00,
+  0x01, 0x88, 0x05, 0x02, 0x27, 0x00, 0x02, 0x25, 0x00, 0x30, 0xca, 0x06,
+  0x30, 0xb0, 0x02, 0x24, 0xc5, 0xc5, 0xc8, 0x2c, 0x30, 0xcd, 0x0b, 0x86,
+  0x8c, 0x02, 0x03, 0x0d, 0x00, 0x30, 0xc7, 0x04, 0xf1, 0x73, 0x0a, 0x30,
+  0x2c, 0x2c, 0xf1, 0xf3, 0x00, 0x20, 0x28, 0x11, 0x7f, 0x03, 0x31, 0xd6,
+  0x24, 0x38, 0xb7, 0x25, 0x01, 0x41, 0x17, 0x00, 0x17, 0x00, 0x31, 0xca,
+  0x4f, 0x2e, 0xb5, 0x15, 0x11, 0x6f, 0xb5, 0x15, 0x54, 0x67, 0xe5, 0xeb,
+  0x21, 0x11, 0x00, 0x01, 0x72, 0xe1, 0xdd, 0x4e, 0xed, 0xdd, 0x46, 0xee,
+  0x96, 0x03, 0x00, 0x1d, 0x02, 0x10, 0xfd, 0x1d, 0x02, 0x10, 0xfe, 0x1d,
+  0x02, 0x70, 0xff, 0x9a, 0x57, 0x71, 0x23, 0x70, 0x23, 0x96, 0x09, 0x02,
+  0x1a, 0x15, 0x00, 0x8e, 0x0d, 0x32, 0xc3, 0x4f, 0x2e, 0x2b, 0x17, 0x12,
+  0x31, 0x22, 0x16, 0x12, 0x2a, 0x2e, 0x04, 0x25, 0x18, 0x22, 0x8b, 0x1b,
+  0x03, 0x94, 0x04, 0x10, 0x5c, 0x89, 0x06, 0x10, 0x44, 0xb0, 0x03, 0x22,
+  0x18, 0x06, 0x6c, 0x2c, 0x05, 0x01, 0x0b, 0x00, 0x5b, 0x2e, 0x30, 0xdd,
+  0x36, 0xf0, 0x3d, 0x27, 0x0f, 0x45, 0x03, 0x01, 0x10, 0xf1, 0x05, 0x00,
+  0x1f, 0xf2, 0x41, 0x03, 0x04, 0x2f, 0x28, 0x3e, 0x40, 0x03, 0x03, 0x20,
+  0xd4, 0x32, 0x02, 0x0e, 0x72, 0x40, 0x28, 0x23, 0xfe, 0x60, 0x28, 0x0a,
+  0x3c, 0x03, 0x45, 0x18, 0xc3, 0xf0, 0x32, 0x93, 0x02, 0x02, 0x55, 0x00,
+  0xf0, 0x01, 0x18, 0x04, 0xdd, 0x36, 0xf0, 0x01, 0xdd, 0xcb, 0x06, 0x5e,
+  0x28, 0x0a, 0xdd, 0x36, 0xfc, 0x02, 0xf3, 0x02, 0x62, 0x18, 0x08, 0xdd,
+  0x36, 0xfc, 0x01, 0xfd, 0x02, 0x39, 0xfc, 0xdd, 0x77, 0xa2, 0x02, 0x08,
+  0x1e, 0x02, 0x01, 0x42, 0x01, 0x01, 0x3b, 0x1d, 0x10, 0xf5, 0x78, 0x00,
+  0x12, 0xf7, 0xb8, 0x19, 0x61, 0xca, 0x54, 0x32, 0xdd, 0xcb, 0xf0, 0xdd,
+  0x19, 0x10, 0xf3, 0xcd, 0x01, 0x02, 0xc0, 0x02, 0x11, 0xc0, 0x15, 0x03,
+  0x36, 0xc2, 0xf6, 0x32, 0xd5, 0x22, 0x01, 0xeb, 0x01, 0x03, 0x7b, 0x18,
+  0x09, 0xe5, 0x02, 0x00, 0x1d, 0x00, 0x94, 0x3a, 0x67, 0xf4, 0xe6, 0xfe,
+  0x28, 0x16, 0x21, 0x1b, 0x74, 0x05, 0x14, 0x19, 0x74, 0x05, 0xd0, 0xc3,
+  0x54, 0x32, 0xdd, 0x7e, 0xfe, 0x3c, 0x20, 0x07, 0xdd, 0x7e, 0xff, 0x3c,
+  0x6d, 0x00, 0xa2, 0x7e, 0xee, 0xb7, 0x20, 0x0a, 0xdd, 0x7e, 0xef, 0xd6,
+  0x02, 0x10, 0x03, 0x07, 0x57, 0x00, 0x47, 0xf1, 0xdd, 0x66, 0xf2, 0x09,
+  0x0b, 0x31, 0xca, 0x54, 0x32, 0xeb, 0x04, 0xc0, 0xc5, 0xdd, 0x5e, 0xee,
+  0xdd, 0x56, 0xef, 0xd5, 0xe5, 0xc5, 0xcd, 0x56, 0x3b, 0x02, 0x11, 0xc1,
+  0xab, 0x00, 0x02, 0xe9, 0x2c, 0x55, 0x7c, 0xb5, 0xc2, 0x54, 0x32, 0x41,
+  0x02, 0x5e, 0xf0, 0x46, 0xca, 0xf1, 0x30, 0x42, 0x02, 0x76, 0x5e, 0xf6,
+  0xdd, 0x56, 0xf7, 0x21, 0x0a, 0xc8, 0x05, 0xa0, 0xee, 0xdd, 0x46, 0xef,
+  0x11, 0x00, 0x00, 0x79, 0xdd, 0x86, 0xf1, 0x0a, 0x40, 0x78, 0xdd, 0x8e,
+  0xf9, 0x7f, 0x22, 0xa1, 0xdd, 0x8e, 0xfa, 0xdd, 0x77, 0xfe, 0x7a, 0xdd,
+  0x8e, 0xfb, 0xb9, 0x17, 0x01, 0x35, 0x00, 0x04, 0xd7, 0x15, 0x0e, 0xeb,
+  0x01, 0x01, 0xdc, 0x0f, 0x30, 0xc3, 0xf1, 0x30, 0x76, 0x00, 0x20, 0x20,
+  0x64, 0x3a, 0x03, 0x16, 0x02, 0x26, 0x22, 0x0a, 0x71, 0x00, 0x01, 0x30,
+  0x16, 0x00, 0x1f, 0x00, 0x04, 0xea, 0x18, 0x00, 0x87, 0x2b, 0x20, 0x7e,
+  0xf9, 0x84, 0x2b, 0x40, 0x7e, 0xfa, 0xdd, 0x9e, 0x4f, 0x18, 0x00, 0xec,
+  0x25, 0x13, 0x1f, 0x38, 0x00, 0x06, 0x29, 0x00, 0x11, 0xf4, 0x0a, 0x0f,
+  0x11, 0xf5, 0x0a, 0x0f, 0x2f, 0xff, 0x02, 0xb8, 0x02, 0x13, 0x1f, 0x9d,
+  0xb8, 0x02, 0x06, 0x30, 0xf5, 0xf5, 0xf5, 0xd6, 0x2d, 0x01, 0xb1, 0x29,
+  0xb4, 0xcd, 0x9a, 0x27, 0x33, 0xeb, 0xdd, 0x73, 0xfc, 0xdd, 0x72, 0xfd,
+  0xc0, 0x0c, 0x22, 0x16, 0x34, 0xe5, 0x00, 0xf1, 0x07, 0xc6, 0x7b, 0x5f,
+  0x3e, 0x00, 0xce, 0xf4, 0x57, 0x1a, 0x4f, 0xdd, 0x71, 0xff, 0x26, 0x00,
+  0x69, 0x29, 0x29, 0x29, 0x01, 0x87, 0xaa, 0xd5, 0x1e, 0x21, 0xe5, 0xe1,
+  0xb5, 0x11, 0xa0, 0xe6, 0x03, 0x4f, 0xfd, 0x7e, 0x07, 0x3d, 0xc2, 0xce,
+  0x33, 0x61, 0x06, 0x01, 0x87, 0x30, 0x20, 0xcd, 0xc3, 0xab, 0x10, 0x77,
+  0xcb, 0x45, 0x28, 0x1d, 0xfd, 0x21, 0x06, 0x28, 0x14, 0x60, 0xfd, 0x6e,
+  0x18, 0xfd, 0x66, 0x19, 0x72, 0x09, 0x30, 0x22, 0x09, 0xf1, 0xc5, 0x0a,
+  0x04, 0x30, 0x00, 0x00, 0xa5, 0x08, 0x97, 0xd1, 0xc1, 0xd6, 0x80, 0x20,
+  0x14, 0xb1, 0x28, 0x11, 0x70, 0x1c, 0x02, 0x18, 0x06, 0x10, 0x79, 0x45,
+  0x11, 0x43, 0x7e, 0xfc, 0xc6, 0x48, 0x28, 0x10, 0x42, 0x7e, 0x3d, 0x77,
+  0x0d, 0x12, 0x00, 0x14, 0x47, 0x1b, 0x10, 0x80, 0x3d, 0x02, 0x3e, 0xff,
+  0x12, 0xed, 0x4b, 0x85, 0xa6, 0x04, 0x50, 0xf5, 0x11, 0x01, 0x00, 0xf1,
+  0x19, 0x0d, 0xf0, 0x05, 0x23, 0xcb, 0x12, 0x3d, 0x20, 0xf9, 0x7b, 0x2f,
+  0x5f, 0x7a, 0x2f, 0x57, 0x79, 0xa3, 0x4f, 0x78, 0xa2, 0x47, 0xed, 0x43,
+  0x22, 0x00, 0xb0, 0xff, 0xf5, 0x33, 0xcd, 0xae, 0x21, 0x33, 0xdd, 0x7e,
+  0xfa, 0x3c, 0x5f, 0x23, 0x40, 0xfb, 0x3c, 0x28, 0x07, 0x35, 0x02, 0x28,
+  0xcd, 0x09, 0x2f, 0x18, 0x00, 0x64, 0x29, 0x00, 0x83, 0x1c, 0x80, 0x6a,
+  0xf4, 0x36, 0x00, 0xed, 0x5b, 0x14, 0xf4, 0x9a, 0x07, 0xb0, 0xed, 0x5b,
+  0x16, 0xf4, 0xed, 0x53, 0x62, 0xf4, 0x3a, 0x12, 0xf4, 0x97, 0x26, 0x00,
+  0x36, 0x01, 0x14, 0xc1, 0xf4, 0x0d, 0xd1, 0x00, 0x00, 0xc3, 0x43, 0x35,
+  0x2a, 0x12, 0xf4, 0x11, 0x7b, 0xf4, 0x19, 0x6e, 0xe1, 0x10, 0x43, 0x11,
+  0x87, 0xaa, 0x19, 0x90, 0x06, 0x5f, 0x5e, 0x05, 0xdd, 0x56, 0x06, 0x58,
+  0x1d, 0x03, 0x23, 0x7e, 0x12, 0x08, 0x00, 0x20, 0xe6, 0x03, 0x54, 0x02,
+  0x00, 0x75, 0x0e, 0x01, 0xfe, 0x31, 0x22, 0x11, 0x01, 0x90, 0x1d, 0x08,
+  0x48, 0x0c, 0x04, 0x00, 0x0d, 0x38, 0xc3, 0x43, 0x35, 0x25, 0x00, 0x45,
+  0x07, 0x00, 0x7b, 0xc5, 0x7b, 0x05, 0x01, 0x7a, 0x09, 0x02, 0xcb, 0x16,
+  0x02, 0x9e, 0x22, 0x31, 0x80, 0x20, 0x42, 0xa2, 0x32, 0x14, 0x3c, 0x8e,
+  0x0e, 0x30, 0x57, 0x28, 0x31, 0x97, 0x01, 0xb0, 0xd1, 0xd5, 0xfd, 0x19,
+  0xfd, 0x7e, 0x08, 0xdd, 0x77, 0xfc, 0xfd, 0x9a, 0x0a, 0x21, 0xfd, 0xfd,
+  0xc2, 0x1b, 0x11, 0xfd, 0xc2, 0x1b, 0x03, 0xd8, 0x0e, 0x23, 0x21, 0x06,
+  0x7d, 0x02, 0x12, 0xc1, 0x3b, 0x0e, 0x03, 0x50, 0x21, 0x04, 0x3e, 0x06,
+  0x06, 0x08, 0x0e, 0x18, 0xf5, 0x12, 0x03, 0x01, 0x7e, 0x13, 0x20, 0x69,
+  0x60, 0x7f, 0x11, 0xe0, 0x56, 0x23, 0x5e, 0x7a, 0xb7, 0x20, 0x35, 0x7b,
+  0xd6, 0x02, 0x20, 0x30, 0x2a, 0x8d, 0xb1, 0x02, 0x15, 0x0b, 0xaa, 0x31,
+  0x21, 0x18, 0x5a, 0xa2, 0x13, 0x90, 0xed, 0x4b, 0x8d, 0xf4, 0xe1, 0xe5,
+  0x71, 0x23, 0x70, 0xc9, 0x0b, 0x21, 0x11, 0x18, 0x34, 0x00, 0x01, 0x64,
+  0x22, 0x60, 0xdd, 0x7e, 0x06, 0x4a, 0x43, 0xd5, 0xc5, 0x02, 0x00, 0x06,
+  0x0c, 0x11, 0xd1, 0x8f, 0x1a, 0x34, 0x0b, 0x6f, 0x63, 0x9a, 0x30, 0x51,
+  0x04, 0x69, 0x60, 0x18, 0x18, 0x6b, 0x00, 0x05, 0x28, 0x2c, 0x51, 0xc5,
+  0xcd, 0xa0, 0x3a, 0xf1, 0x77, 0x0a, 0x04, 0x1f, 0x0a, 0x33, 0x11, 0xff,
+  0xaa, 0x11, 0x20, 0x13, 0x23, 0x11, 0x20, 0x30, 0x28, 0x13, 0x21, 0xd8,
+  0x1d, 0x60, 0x07, 0x30, 0x0b, 0xe5, 0xd5, 0xd5, 0x0e, 0x13, 0x41, 0xd1,
+  0xe1, 0xcb, 0xbe, 0xd9, 0x1f, 0xd1, 0x18, 0xd5, 0x01, 0xdb, 0xb0, 0x79,
+  0xd6, 0x67, 0x78, 0xde, 0xb4, 0x30, 0x66, 0xfd, 0x29, 0x60, 0x1c, 0x20,
+  0x03, 0x14, 0x28, 0x53, 0x98, 0x00, 0x01, 0xf8, 0x14, 0x14, 0xd2, 0xf8,
+  0x14, 0x91, 0xfe, 0x02, 0x28, 0x3d, 0xb7, 0x20, 0x02, 0x36, 0x02, 0x26,
+  0x00, 0x01, 0x55, 0x16, 0x01, 0x39, 0x07, 0x03, 0xf6, 0x18, 0x60, 0x7c,
+  0xb5, 0x28, 0x1e, 0x5d, 0x54, 0x21, 0x03, 0x02, 0xa9, 0x16, 0x01, 0x69,
+  0x0c, 0x21, 0xe1, 0xc5, 0x46, 0x12, 0x01, 0xa7, 0x04, 0x40, 0xc1, 0x21,
+  0xe3, 0x00, 0xb5, 0x2f, 0x40, 0x92, 0xcd, 0xe5, 0x05, 0xaa, 0x00, 0x33,
+  0xfd, 0x21, 0xf7, 0x00, 0x23, 0x14, 0xc8, 0xb8, 0x31, 0x00, 0x2f, 0x29,
+  0x82, 0x56, 0x1e, 0x02, 0xd5, 0xcd, 0x91, 0x92, 0xf1, 0x65, 0x27, 0x10,
+  0xf0, 0x13, 0x1f, 0x51, 0xc4, 0x9b, 0xdd, 0x5e, 0x04, 0x84, 0x08, 0x10,
+  0x19, 0x04, 0x15, 0x34, 0x01, 0xb7, 0xb4, 0x11, 0x15, 0x10, 0x29, 0x93,
+  0x08, 0x40, 0xf1, 0xdd, 0x74, 0xf2, 0x62, 0x0a, 0xa0, 0x2a, 0x62, 0xf4,
+  0x7b, 0xc6, 0x08, 0xdd, 0x77, 0xf3, 0x7a, 0x69, 0x02, 0x11, 0xf4, 0xd9,
+  0x19, 0x50, 0x6a, 0x38, 0xdd, 0x7e, 0xf3, 0xdd, 0x1e, 0x21, 0x7e, 0xf4,
+  0xf7, 0x05, 0x10, 0xf1, 0xc8, 0x13, 0x40, 0xf7, 0xdd, 0x7e, 0xf2, 0x23,
+  0x00, 0x03, 0x36, 0x23, 0x00, 0x8d, 0x04, 0x50, 0x77, 0xfa, 0xdd, 0x7e,
+  0xf7, 0xa8, 0x02, 0x40, 0xfb, 0xdd, 0x7e, 0xf8, 0x1c, 0x00, 0x00, 0xb0,
+  0x02, 0x02, 0xfa, 0x13, 0x43, 0xdd, 0x77, 0xfe, 0xd5, 0x98, 0x05, 0x02,
+  0x37, 0x04, 0xf2, 0x00, 0x38, 0x8b, 0xf1, 0x33, 0x7d, 0xd1, 0xb7, 0x28,
+  0x06, 0x2a, 0x97, 0xf4, 0xc3, 0x8c, 0x38, 0x1c, 0x00, 0xa0, 0xcb, 0x56,
+  0x28, 0x0d, 0xdd, 0x6e, 0xf5, 0xdd, 0x66, 0xf6, 0xeb, 0x17, 0x30, 0xca,
+  0x83, 0x38, 0x36, 0x06, 0xf0, 0x15, 0xd5, 0xe5, 0xd5, 0xcd, 0x64, 0x0b,
+  0xf1, 0xf1, 0xd1, 0xcb, 0x45, 0x28, 0x22, 0x21, 0x6a, 0xf4, 0x4e, 0x2a,
+  0x60, 0xf4, 0xcb, 0x41, 0x28, 0x07, 0xdd, 0x7e, 0xf0, 0x77, 0xc3, 0x11,
+  0x38, 0xdd, 0x4e, 0xf0, 0x06, 0x00, 0xd3, 0x05, 0xf0, 0x02, 0x05, 0x49,
+  0xf1, 0xf1, 0xd1, 0x18, 0x76, 0xdd, 0x6e, 0xfd, 0xdd, 0x66, 0xfe, 0xcb,
+  0x66, 0x20, 0x47, 0x5e, 0x27, 0xf1, 0x00, 0x46, 0xfa, 0xc5, 0xfd, 0xe1,
+  0xdd, 0x6e, 0xf9, 0xdd, 0x66, 0xfa, 0x01, 0x09, 0x00, 0x09, 0x62, 0x0f,
+  0x30, 0x4b, 0x97, 0xf4, 0xfb, 0x11, 0x00, 0x03, 0x27, 0x75, 0x20, 0x0c,
+  0xfd, 0x6e, 0x08, 0x26, 0x00, 0xe6, 0x00, 0xf0, 0x01, 0xff, 0xb7, 0x28,
+  0x10, 0x2a, 0x00, 0xf4, 0x01, 0x22, 0x00, 0x09, 0xdd, 0x4e, 0xff, 0x06,
+  0x00, 0xfc, 0x16, 0x24, 0x4b, 0x42, 0x5e, 0x0c, 0x12, 0x1c, 0x5e, 0x0c,
+  0x23, 0x20, 0x6b, 0x23, 0x00, 0x00, 0x40, 0x0d, 0x70, 0x3d, 0xb0, 0x28,
+  0x5c, 0xc3, 0x34, 0x37, 0x55, 0x00, 0x10, 0x03, 0x2c, 0x05, 0x02, 0xa8,
+  0x28, 0x70, 0x4e, 0x23, 0x7e, 0xcb, 0x61, 0x28, 0x37, 0x32, 0x20, 0xb0,
+  0x3d, 0xb4, 0x20, 0x18, 0xdd, 0x6e, 0xf7, 0xdd, 0x66, 0xf8, 0x01, 0xb7,
+  0x15, 0x41, 0x7e, 0xf0, 0x96, 0x20, 0x8a, 0x0a, 0xb3, 0x97, 0xf4, 0x18,
+  0x23, 0xdd, 0x7e, 0xf0, 0xd6, 0x0a, 0x28, 0x1c, 0x1f, 0x00, 0x12, 0x09,
+  0x1f, 0x00, 0x20, 0x28, 0x0c, 0xdd, 0x2d, 0x10, 0x03, 0x90, 0x1e, 0x32,
+  0xc3, 0xd6, 0x36, 0x2e, 0x01, 0x91, 0x89, 0x45, 0x33, 0xdd, 0x4e, 0xf3,
+  0xdd, 0x46, 0xf4, 0x7b, 0x08, 0x43, 0x2a, 0x97, 0xf4, 0x18, 0xae, 0x1d,
+  0x37, 0x21, 0xff, 0xff, 0x76, 0x04, 0x00, 0x48, 0x0a, 0x43, 0x2a, 0x60,
+  0xf4, 0xc5, 0x6d, 0x27, 0x13, 0x7c, 0xe1, 0x12, 0x2a, 0xc0, 0x39, 0xee,
+  0x01, 0x01, 0xeb, 0x13, 0x15, 0xfa, 0x9f, 0x01, 0x00, 0xbc, 0x00, 0x00,
+  0x11, 0x0c, 0xb2, 0x79, 0x93, 0x20, 0x05, 0x78, 0x92, 0xca, 0xbd, 0x39,
+  0xc1, 0xc5, 0xd1, 0x1a, 0x02, 0x7c, 0x00, 0x10, 0x73, 0xaa, 0x01, 0x13,
+  0xc1, 0xaa, 0x01, 0x20, 0xc0, 0x39, 0x70, 0x14, 0x35, 0x57, 0x28, 0x0c,
+  0x7f, 0x00, 0x94, 0xc3, 0xc0, 0x39, 0xcb, 0x47, 0x28, 0x19, 0x59, 0x50,
+  0x0b, 0x0d, 0x00, 0x26, 0x01, 0x00, 0xc9, 0x02, 0x12, 0xbb, 0x30, 0x00,
+  0x40, 0xcb, 0x4f, 0x20, 0x79, 0xb6, 0x01, 0x26, 0x21, 0x60, 0x42, 0x08,
+  0x33, 0xcb, 0x41, 0x28, 0xfc, 0x2d, 0x23, 0x46, 0x18, 0x13, 0x20, 0x01,
+  0x35, 0x28, 0x13, 0x45, 0xbb, 0x23, 0x00, 0x1a, 0x11, 0xf2, 0x05, 0xcb,
+  0x41, 0x28, 0x2c, 0x78, 0xd6, 0x0a, 0x20, 0x1c, 0xcb, 0x51, 0x28, 0x18,
+  0xc5, 0xdd, 0x56, 0x06, 0x1e, 0x0d, 0xd5, 0x91, 0x00, 0x22, 0x9d, 0x43,
+  0x91, 0x00, 0xe2, 0x0d, 0x18, 0x35, 0x78, 0xd6, 0x0d, 0x20, 0x06, 0xcb,
+  0x59, 0x28, 0x02, 0x06, 0x0a, 0xa4, 0x01, 0x17, 0x33, 0x23, 0x00, 0x35,
+  0xb7, 0x20, 0x15, 0x4a, 0x01, 0x05, 0xa0, 0x01, 0x30, 0xc3, 0xcd, 0x38,
+  0x1c, 0x21, 0x05, 0x34, 0x01, 0x00, 0xc4, 0x34, 0x35, 0x04, 0x30, 0x0c,
+  0x5b, 0x04, 0x3a, 0xc3, 0x9b, 0x3a, 0x2d, 0x01, 0x2a, 0xeb, 0x1a, 0xef,
+  0x00, 0xb0, 0x9b, 0x3a, 0x4b, 0x42, 0x03, 0x0a, 0xb7, 0x28, 0x08, 0x3c,
+  0x02, 0xb9, 0x05, 0x22, 0x9b, 0x3a, 0x3a, 0x22, 0x01, 0x77, 0x00, 0xf3,
+  0x0f, 0x84, 0x45, 0xf1, 0xd1, 0xc1, 0x21, 0x08, 0x00, 0x19, 0xe3, 0xe1,
+  0xe5, 0x23, 0xcb, 0x5e, 0x20, 0x6d, 0xdd, 0xcb, 0x05, 0x66, 0x20, 0x67,
+  0xc5, 0xd5, 0xcd, 0xbd, 0xf9, 0xd1, 0xc1, 0x8d, 0x37, 0x03, 0xc6, 0x00,
+  0x22, 0x85, 0x45, 0x66, 0x10, 0x40, 0x26, 0xdd, 0x66, 0x05, 0xf1, 0x03,
+  0x62, 0xc5, 0xd5, 0xe5, 0x33, 0xfd, 0xe5, 0xc2, 0x0e, 0x00, 0x3f, 0x01,
+  0x12, 0x0e, 0x67, 0x17, 0x21, 0xc6, 0xf9, 0x63, 0x13, 0x10, 0x29, 0xf1,
+  0x06, 0x02, 0x28, 0x01, 0x20, 0xc6, 0xf9, 0xcc, 0x17, 0x42, 0xcb, 0x57,
+  0x28, 0x0f, 0x95, 0x00, 0x40, 0x1a, 0xcb, 0x97, 0x12, 0x23, 0x00, 0x21,
+  0x06, 0x0a, 0x92, 0x00, 0x05, 0xdb, 0x00, 0x01, 0xc7, 0x00, 0x14, 0x06,
+  0xc7, 0x00, 0x10, 0xe5, 0x83, 0x00, 0xf4, 0x04, 0x33, 0x33, 0xe5, 0x1a,
+  0xcb, 0x57, 0x20, 0x39, 0xed, 0x4b, 0x00, 0xf4, 0x03, 0x0a, 0xb7, 0x20,
+  0x30, 0x13, 0x13, 0x36, 0x1b, 0x70, 0x25, 0xdd, 0xcb, 0x08, 0x5e, 0x20,
+  0x1f, 0x1d, 0x24, 0x26, 0x21, 0x8d, 0x4a, 0x33, 0x00, 0xea, 0x02, 0x12,
+  0x40, 0xea, 0x02, 0x00, 0x6a, 0x1b, 0x02, 0xbd, 0x2e, 0x04, 0x01, 0x0e,
+  0x1b, 0x3b, 0x2a, 0x01, 0xa0, 0x6b, 0x62, 0x23, 0x4e, 0x0d, 0x79, 0x77,
+  0xb7, 0x28, 0x05, 0x05, 0x1f, 0x12, 0x28, 0x66, 0x00, 0x04, 0x35, 0x25,
+  0x40, 0xff, 0x20, 0x08, 0xaf, 0xa0, 0x00, 0x30, 0x22, 0x8d, 0xf4, 0x21,
+  0x11, 0x00, 0xab, 0x16, 0x01, 0xba, 0x00, 0x23, 0x00, 0x00, 0xef, 0x31,
+  0x10, 0xf5, 0x30, 0x00, 0x53, 0x69, 0x60, 0x23, 0x5e, 0x6b, 0x51, 0x00,
+  0xf2, 0x02, 0x3e, 0xb7, 0x85, 0x6f, 0x3e, 0xb4, 0x8c, 0x67, 0x23, 0x23,
+  0xe5, 0xfd, 0xe1, 0x7b, 0xb7, 0x28, 0x3a, 0x38, 0x10, 0x20, 0x69, 0x60,
+  0xe9, 0x24, 0x07, 0x3e, 0x35, 0x01, 0xa3, 0x30, 0x11, 0x1d, 0xa3, 0x30,
+  0x01, 0x09, 0x1d, 0xb4, 0x4e, 0x23, 0x46, 0x7b, 0x91, 0x20, 0x0c, 0x7a,
+  0x90, 0x20, 0x08, 0x18, 0x20, 0x05, 0xb9, 0x1c, 0x11, 0x3b, 0xee, 0x25,
+  0x23, 0xb7, 0xb4, 0x75, 0x06, 0x34, 0x36, 0xff, 0x00, 0x52, 0x18, 0x10,
+  0x09, 0x51, 0x18, 0x50, 0x05, 0xd6, 0x02, 0x20, 0x14, 0x52, 0x16, 0xa0,
+  0x80, 0x20, 0x0d, 0x2a, 0xf7, 0xb4, 0x2b, 0x22, 0xf7, 0xb4, 0xe5, 0x01,
+  0x90, 0x35, 0x40, 0xc5, 0xdd, 0x6e, 0x05, 0xdd, 0x66, 0x06, 0x18, 0x30,
+  0x00, 0xbd, 0x01, 0x33, 0xbe, 0x8b, 0xf1, 0x15, 0x03, 0x00, 0x13, 0x02,
+  0x68, 0x35, 0x40, 0x0a, 0x5f, 0xcb, 0x53, 0x25, 0x02, 0x60, 0x35, 0x40,
+  0xdd, 0x7e, 0x05, 0x3d, 0x76, 0x17, 0x21, 0xd0, 0x3c, 0x56, 0x00, 0x00,
+  0x0b, 0x00, 0x20, 0x03, 0x3d, 0x0b, 0x00, 0x10, 0x03, 0x0b, 0x00, 0x11,
+  0xff, 0x16, 0x00, 0x10, 0x04, 0x0b, 0x00, 0x11, 0xe9, 0x0b, 0x00, 0x10,
+  0x05, 0x0b, 0x00, 0x20, 0xd8, 0x3e, 0x0b, 0x00, 0x10, 0x06, 0x0b, 0x00,
+  0x20, 0x00, 0x3f, 0x0b, 0x00, 0x01, 0xb8, 0x17, 0x11, 0x24, 0x0b, 0x00,
+  0x10, 0x08, 0x0b, 0x00, 0x11, 0x33, 0x0b, 0x00, 0x10, 0x09, 0x0b, 0x00,
+  0x11, 0x3a, 0x0b, 0x00, 0x10, 0x0a, 0x0b, 0x00, 0x11, 0x4f, 0x0b, 0x00,
+  0x10, 0x0b, 0x0b, 0x00, 0x11, 0x68, 0x0b, 0x00, 0x10, 0x0c, 0x0b, 0x00,
+  0x11, 0xa5, 0x0b, 0x00, 0x10, 0x0d, 0x0b, 0x00, 0x10, 0xbc, 0x0b, 0x00,
+  0x31, 0xb7, 0x20, 0x08, 0xd9, 0x00, 0x20, 0xca, 0xe0, 0x0e, 0x00, 0x42,
+  0x3d, 0xc2, 0x27, 0x40, 0x0f, 0x00, 0xf0, 0x0c, 0xe7, 0x3f, 0xc3, 0x27,
+  0x40, 0xdd, 0x5e, 0x07, 0xdd, 0x56, 0x08, 0x03, 0x03, 0x03, 0x03, 0x21,
+  0x14, 0x00, 0xe5, 0xd5, 0xc5, 0xcd, 0xcb, 0x48, 0xf1, 0xf1, 0xf1, 0xc7,
+  0x00, 0x06, 0x34, 0x06, 0xf2, 0x03, 0x11, 0xc4, 0x9b, 0x19, 0xc5, 0xe5,
+  0xcd, 0xfe, 0x0b, 0xf1, 0xc1, 0xdd, 0x36, 0xfb, 0x01, 0x11, 0xe4, 0x9b,
+  0x92, 0x02, 0x17, 0x29, 0xab, 0x23, 0x01, 0x47, 0x00, 0x10, 0xc5, 0x44,
+  0x00, 0x70, 0x21, 0xf9, 0xb4, 0xe5, 0xd5, 0xcd, 0x57, 0x47, 0x00, 0x52,
+  0xc1, 0x2c, 0x20, 0x09, 0x24, 0x8a, 0x04, 0x22, 0x35, 0x40, 0x40, 0x32,
+  0x02, 0xb9, 0x17, 0x33, 0xfc, 0xc6, 0x08, 0x27, 0x1e, 0x50, 0x21, 0x01,
+  0xb5, 0x01, 0x0c, 0xaa, 0x0a, 0x05, 0x84, 0x0a, 0x04, 0x1d, 0x1a, 0x08,
+  0x83, 0x09, 0x02, 0x1e, 0x00, 0x73, 0x71, 0x23, 0x70, 0xed, 0x5b, 0xf9,
+  0xb4, 0x13, 0x1a, 0x33, 0x23, 0x66, 0x6f, 0x71, 0x29, 0x01, 0x27, 0x02,
+  0xf6, 0x01, 0xe1, 0x7d, 0xa3, 0x5f, 0x7c, 0xa2, 0x57, 0xed, 0x53, 0xf9,
+  0xb4, 0x79, 0xb3, 0x4f, 0x78, 0xb2, 0x34, 0x00, 0x00, 0x6f, 0x00, 0x1d,
+  0x02, 0x7f, 0x1a, 0x50, 0x4e, 0x23, 0x46, 0xfd, 0x7e, 0x56, 0x02, 0x09,
+  0x67, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x67, 0x00, 0x80, 0xfb, 0xb4, 0xfd,
+  0x6e, 0x00, 0xfd, 0x66, 0x01, 0x86, 0x29, 0x04, 0x5a, 0x00, 0x15, 0xfb,
+  0x5a, 0x00, 0x03, 0x27, 0x00, 0x0f, 0xd9, 0x1a, 0x03, 0x0f, 0x5a, 0x00,
+  0x0c, 0x1f, 0xfd, 0x5a, 0x00, 0x00, 0x1f, 0xfd, 0x5a, 0x00, 0x01, 0x1f,
+  0x06, 0x5a, 0x00, 0x1d, 0x13, 0xff, 0x5a, 0x00, 0x04, 0x56, 0x00, 0x1d,
+  0xff, 0x56, 0x00, 0x10, 0x66, 0x8f, 0x1c, 0x73, 0xe5, 0xcd, 0x84, 0x45,
+  0x21, 0x03, 0x00, 0xc6, 0x0b, 0xdb, 0x89, 0x36, 0xf1, 0x33, 0xc3, 0x32,
+  0x40, 0xdd, 0x4e, 0x07, 0xdd, 0x46, 0x08, 0xf5, 0x01, 0x00, 0x82, 0x17,
+  0x40, 0x11, 0x02, 0x00, 0xd5, 0x57, 0x06, 0x03, 0x17, 0x02, 0x0b, 0x4e,
+  0x08, 0x00, 0x16, 0x02, 0x2c, 0x21, 0x02, 0x4c, 0x00, 0x01, 0x0d, 0x00,
+  0x20, 0x5d, 0x44, 0x55, 0x09, 0xf3, 0x02, 0xc3, 0x35, 0x40, 0x7b, 0xcb,
+  0xc7, 0x02, 0xc3, 0x32, 0x40, 0x7b, 0xcb, 0x87, 0x02, 0x21, 0x02, 0x00,
+  0x5c, 0x06, 0x04, 0x2b, 0x00, 0x01, 0x38, 0x02, 0x70, 0x21, 0x18, 0x00,
+  0x09, 0x01, 0x08, 0x00, 0xe4, 0x0b, 0x04, 0x68, 0x00, 0x00, 0x13, 0x00,
+  0x02, 0x1d, 0x00, 0xb3, 0xd5, 0xfd, 0xe1, 0xc5, 0x11, 0x08, 0x00, 0xd5,
+  0xe5, 0xfd, 0xe5, 0x56, 0x02, 0x04, 0x84, 0x3d, 0x23, 0x35, 0x40, 0xf5,
+  0x03, 0x20, 0x3e, 0x1c, 0xa5, 0x07, 0x21, 0xff, 0x50, 0xc7, 0x09, 0x01,
+  0xbc, 0x02, 0x00, 0x39, 0x00, 0x03, 0x1d, 0x00, 0x51, 0xd5, 0xc5, 0xcd,
+  0x2f, 0x49, 0x54, 0x00, 0xa5, 0x2a, 0x00, 0xf4, 0x23, 0xdd, 0x7e, 0x04,
+  0x96, 0x28, 0x0b, 0x19, 0x35, 0xf2, 0x09, 0x18, 0x64, 0xdd, 0x6e, 0x07,
+  0xdd, 0x66, 0x08, 0xe5, 0xc5, 0xcd, 0x27, 0x8c, 0xf1, 0xf1, 0x18, 0x55,
+  0x2a, 0xf7, 0xb4, 0x23, 0x22, 0xf7, 0xb4, 0x42, 0x00, 0xf0, 0x04, 0x1a,
+  0xf5, 0xaf, 0x12, 0xf1, 0xcb, 0x57, 0x28, 0x10, 0xf5, 0x0a, 0x6f, 0xf1,
+  0xcb, 0x55, 0x28, 0x08, 0x3e, 0x05, 0xb7, 0x04, 0xa3, 0x18, 0x2f, 0xcb,
+  0x4f, 0x28, 0x18, 0x0a, 0x0f, 0x38, 0x14, 0xd2, 0x05, 0x50, 0x34, 0x45,
+  0x33, 0x7d, 0xd1, 0x5f, 0x0a, 0x31, 0x1a, 0xcb, 0xcf, 0x21, 0x00, 0x16,
+  0x0e, 0x61, 0x00, 0x01, 0xcb, 0x32, 0x04, 0xf7, 0x0f, 0x10, 0xf5, 0x90,
+  0x09, 0x0a, 0x3b, 0x05, 0x33, 0xdd, 0x4e, 0x04, 0x38, 0x2d, 0x43, 0x29,
+  0x01, 0xc4, 0x9b, 0xf3, 0x1a, 0x00, 0x9e, 0x1e, 0x02, 0x06, 0x0c, 0x01,
+  0x82, 0x0a, 0x30, 0x0a, 0xe6, 0x10, 0xb4, 0x07, 0x04, 0x4f, 0x0b, 0xc1,
+  0xcb, 0x79, 0x28, 0x08, 0xdd, 0x7e, 0x05, 0xe6, 0x7f, 0xdd, 0x77, 0x05,
+  0xea, 0x1d, 0x11, 0x0b, 0xe6, 0x03, 0x50, 0x05, 0x2e, 0x01, 0xc3, 0x1f,
+  0x6b, 0x3a, 0x72, 0xd6, 0x0d, 0x20, 0x11, 0xcb, 0x59, 0x28, 0x10, 0x00,
+  0x81, 0xcb, 0x49, 0x28, 0x04, 0xdd, 0x36, 0x05, 0x0a, 0x35, 0x04, 0x41,
+  0x20, 0x08, 0xcb, 0x69, 0x0f, 0x00, 0x13, 0x0d, 0x58, 0x0c, 0x13, 0xf5,
+  0x58, 0x0c, 0x92, 0xf6, 0xe1, 0xe5, 0x23, 0x2b, 0xcb, 0x76, 0x28, 0x5c,
+  0x65, 0x00, 0x32, 0xc5, 0x01, 0x0b, 0x68, 0x05, 0x14, 0xff, 0x84, 0x17,
+  0x44, 0x3e, 0x02, 0x18, 0x1a, 0x1c, 0x00, 0x1a, 0x0d, 0x1c, 0x00, 0x62,
+  0x28, 0x3e, 0x03, 0x4b, 0x62, 0x69, 0x6c, 0x01, 0x04, 0x88, 0x01, 0x04,
+  0x58, 0x0c, 0x82, 0xfe, 0x0b, 0xf1, 0xd1, 0x1a, 0xe6, 0xfc, 0x12, 0x8b,
+  0x00, 0x32, 0x60, 0x28, 0x44, 0x44, 0x00, 0x20, 0x01, 0x0f, 0xf2, 0x08,
+  0x72, 0x05, 0x96, 0x20, 0x09, 0x1a, 0xcb, 0xc7, 0x1d, 0x00, 0x03, 0x19,
+  0x00, 0x13, 0x0e, 0x19, 0x00, 0x9a, 0x1b, 0x1a, 0xcb, 0x87, 0x12, 0xd5,
+  0xcd, 0x10, 0x4a, 0x5e, 0x02, 0x03, 0xe3, 0x00, 0x20, 0xfa, 0xc6, 0x7d,
+  0x0c, 0x03, 0xbc, 0x00, 0x11, 0xfe, 0x04, 0x01, 0x13, 0x45, 0x41, 0x00,
+  0x15, 0x13, 0x5a, 0x00, 0x28, 0xee, 0x02, 0x5a, 0x00, 0x01, 0x3b, 0x1a,
+  0xb3, 0xdd, 0x7e, 0x05, 0x91, 0x20, 0x05, 0x06, 0x02, 0xc3, 0xa5, 0x42,
+  0x16, 0x00, 0x16, 0x0c, 0x16, 0x00, 0x10, 0x04, 0x16, 0x00, 0x01, 0x26,
+  0x01, 0x02, 0x66, 0x13, 0x32, 0xb7, 0x28, 0x23, 0x25, 0x00, 0xf0, 0x00,
+  0x23, 0x23, 0x7e, 0xe6, 0x05, 0x47, 0x1e, 0x00, 0x78, 0xd6, 0x05, 0xb3,
+  0x20, 0x0f, 0xc5, 0x0e, 0x16, 0x02, 0x92, 0x00, 0x86, 0x4a, 0x43, 0xf1,
+  0xc1, 0xc5, 0xdd, 0x7e, 0x05, 0x48, 0x0d, 0x80, 0xb7, 0x0a, 0xf1, 0x33,
+  0xc1, 0xdd, 0x75, 0xff, 0xa3, 0x00, 0x00, 0xe3, 0x04, 0x02, 0xad, 0x2b,
+  0x41, 0xff, 0xb7, 0x28, 0x1f, 0xa5, 0x00, 0xb0, 0x08, 0x1a, 0x47, 0xdd,
+  0x7e, 0x05, 0x90, 0x28, 0x11, 0xc5, 0xd5, 0x18, 0x2d, 0x00, 0x8c, 0x03,
+  0x91, 0x4a, 0x43, 0xf1, 0xd1, 0xc1, 0x18, 0x11, 0xc5, 0xd5, 0x64, 0x28,
+  0x01, 0x57, 0x00, 0x10, 0x37, 0x4d, 0x08, 0x01, 0x30, 0x00, 0x12, 0x18,
+  0xd4, 0x0a, 0x00, 0xd1, 0x00, 0x70, 0x28, 0x0c, 0x79, 0xb7, 0x20, 0x08,
+  0x1a, 0x04, 0x16, 0x34, 0x91, 0x20, 0x18, 0x34, 0x37, 0x48, 0x10, 0x4a,
+  0x21, 0x01, 0x20, 0x01, 0x31, 0xdd, 0x6e, 0xff, 0x21, 0x01, 0x11, 0xfd,
+  0x93, 0x0b, 0x40, 0xfe, 0xdd, 0x77, 0xfb, 0x50, 0x31, 0x04, 0x07, 0x33,
+  0x00, 0x18, 0x10, 0x00, 0x45, 0x13, 0x02, 0xac, 0x00, 0xf2, 0x03, 0x46,
+  0x0c, 0xf1, 0xf1, 0x4d, 0xf1, 0x47, 0xcb, 0x41, 0x28, 0x47, 0xdd, 0x7e,
+  0xf7, 0xd6, 0x0a, 0x28, 0x0c, 0xef, 0x00, 0x40, 0xdd, 0x7e, 0xf7, 0x96,
+  0x92, 0x2a, 0x1a, 0xf7, 0xd7, 0x00, 0x20, 0x18, 0x21, 0x39, 0x0d, 0xc3,
+  0x5e, 0x68, 0x26, 0x00, 0x7d, 0xa1, 0x4f, 0x7c, 0xa3, 0xb1, 0x28, 0x0b,
+  0x13, 0x07, 0x41, 0x71, 0x43, 0x33, 0xc1, 0xe4, 0x00, 0x16, 0xa0, 0xc5,
+  0x28, 0x0a, 0xe5, 0x02, 0x00, 0xe9, 0x10, 0x0a, 0xc8, 0x01, 0x0f, 0x26,
+  0x00, 0x01, 0x00, 0xa2, 0x01, 0x44, 0xcb, 0x46, 0x28, 0x0b, 0x1a, 0x01,
+  0x20, 0x46, 0x44, 0xbd, 0x07, 0x25, 0x3e, 0x08, 0x0e, 0x40, 0x68, 0xcd,
+  0x46, 0x44, 0x26, 0x20, 0xe3, 0x0e, 0x00, 0x18, 0x08, 0x0e, 0x00, 0x02,
+  0xc2, 0x18, 0x20, 0x7e, 0x06, 0x2d, 0x03, 0x95, 0x06, 0x3a, 0x10, 0xf4,
+  0xcb, 0x47, 0xc2, 0x36, 0x44, 0xa1, 0x03, 0xa6, 0x4d, 0x2d, 0xca, 0x36,
+  0x44, 0xc5, 0xcd, 0xce, 0x53, 0xc1, 0x37, 0x36, 0xf1, 0x17, 0x2e, 0x01,
+  0x18, 0x72, 0x79, 0xb7, 0x20, 0x1e, 0x3a, 0xfd, 0x9b, 0x3d, 0x28, 0xd5,
+  0x2a, 0x00, 0xf4, 0x11, 0x12, 0x00, 0x19, 0x46, 0x23, 0x5e, 0xfd, 0x21,
+  0xff, 0x9b, 0xfd, 0x7e, 0x00, 0x90, 0xfd, 0x7e, 0x01, 0x9b, 0x38, 0xbd,
+  0xf6, 0x3e, 0x03, 0x83, 0x36, 0x80, 0x2e, 0x01, 0x18, 0x40, 0x79, 0xb7,
+  0x28, 0x29, 0x35, 0x42, 0x02, 0x5b, 0x00, 0x46, 0x47, 0x45, 0x33, 0xc1,
+  0xc5, 0x00, 0x30, 0x11, 0xb7, 0xb4, 0x2b, 0x07, 0x00, 0xa0, 0x36, 0xc4,
+  0xc6, 0xf9, 0xf1, 0xc3, 0xb0, 0x43, 0xcd, 0x87, 0x4a, 0xc3, 0xb0, 0x43,
+  0xd3, 0x00, 0x31, 0x37, 0x45, 0xf1, 0x2a, 0x37, 0x00, 0x7a, 0x1a, 0x00,
+  0xdc, 0x36, 0x05, 0x07, 0x00, 0x01, 0xb8, 0x0a, 0x0e, 0x13, 0x01, 0x00,
+  0x59, 0x09, 0x01, 0x18, 0x21, 0x01, 0x36, 0x20, 0x02, 0x5b, 0x03, 0x11,
+  0xd1, 0xc0, 0x0e, 0x36, 0xd5, 0x3e, 0x12, 0x11, 0x00, 0x02, 0x53, 0x09,
+  0x2b, 0xd7, 0x12, 0x4c, 0x04, 0x02, 0x3d, 0x22, 0x00, 0x7c, 0x01, 0x1f,
+  0x07, 0x7c, 0x01, 0x0e, 0x85, 0x08, 0x00, 0x19, 0x23, 0xcb, 0x56, 0x28,
+  0x09, 0xbc, 0x05, 0x0f, 0x26, 0x00, 0x01, 0x00, 0xc8, 0x0c, 0x01, 0xcc,
+  0x01, 0x09, 0x3e, 0x06, 0x05, 0xe2, 0x41, 0x70, 0x0a, 0x20, 0x08, 0x11,
+  0x01, 0x0d, 0xd5, 0xe6, 0x00, 0x00, 0x11, 0x00, 0x01, 0xd5, 0x41, 0x30,
+  0x37, 0x45, 0xf1, 0x10, 0x41, 0xf1, 0x00, 0xe1, 0xd1, 0xd5, 0xe5, 0xed,
+  0x38, 0xc5, 0xe6, 0x20, 0x28, 0xf9, 0x7a, 0xed, 0x39, 0xc0, 0x31, 0x00,
+  0xf0, 0x10, 0x46, 0x0e, 0x01, 0x04, 0x18, 0x02, 0xcb, 0x21, 0x10, 0xfc,
+  0xfd, 0x21, 0x15, 0xb6, 0xfd, 0x7e, 0x00, 0xb1, 0xfd, 0x77, 0x00, 0xc9,
+  0xed, 0x38, 0xc5, 0x32, 0x16, 0xb6, 0xfd, 0x21, 0x16, 0x12, 0x00, 0xe0,
+  0x0f, 0xd0, 0x18, 0x00, 0xed, 0x38, 0xc0, 0x32, 0x16, 0xb6, 0x3a, 0x16,
+  0xb6, 0x57, 0x50, 0x00, 0xb0, 0x3a, 0x40, 0xf1, 0xc9, 0xc9, 0x21, 0x01,
+  0x00, 0xc9, 0xc9, 0xf1, 0x54, 0x00, 0x30, 0xf5, 0x18, 0x0a, 0x01, 0x02,
+  0xf0, 0x27, 0x5e, 0x2b, 0x6e, 0x26, 0x00, 0x54, 0x7b, 0xe6, 0x80, 0xb2,
+  0x20, 0x10, 0x06, 0x10, 0xed, 0x6a, 0x17, 0x93, 0x30, 0x01, 0x83, 0x3f,
+  0xed, 0x6a, 0x10, 0xf6, 0x5f, 0xc9, 0x06, 0x09, 0x7d, 0x6c, 0x26, 0x00,
+  0xcb, 0x1d, 0xed, 0x6a, 0xed, 0x52, 0x30, 0x01, 0x19, 0x3f, 0x17, 0x10,
+  0xf5, 0xcb, 0x10, 0x50, 0x5f, 0xeb, 0xc9, 0xf1, 0x97, 0x37, 0xf0, 0x09,
+  0xf5, 0xaf, 0x6f, 0xb0, 0x06, 0x10, 0x20, 0x04, 0x06, 0x08, 0x79, 0x29,
+  0xcb, 0x11, 0x17, 0x30, 0x01, 0x19, 0x10, 0xf7, 0xc9, 0xdd, 0xe5, 0xdd,
+  0xb6, 0x05, 0x10, 0x39, 0x42, 0x21, 0x07, 0xc7, 0x22, 0x01, 0xf8, 0x19,
+  0x01, 0xa6, 0x43, 0x10, 0xfe, 0x79, 0x1b, 0x22, 0x77, 0xff, 0xc0, 0x2d,
+  0x63, 0x69, 0x60, 0x0b, 0x7c, 0xb5, 0x28, 0xf2, 0x3a, 0x14, 0x7e, 0x7c,
+  0x28, 0x43, 0x12, 0x13, 0x18, 0xe6, 0xec, 0x10, 0x14, 0xe9, 0x50, 0x00,
+  0x03, 0x42, 0x00, 0x07, 0x36, 0x00, 0x10, 0x07, 0x49, 0x3b, 0x32, 0x13,
+  0x18, 0xf2, 0x4b, 0x18, 0x03, 0x9e, 0x1b, 0xc4, 0xaf, 0x47, 0x4f, 0xed,
+  0xb1, 0x21, 0xff, 0xff, 0xed, 0x42, 0xc9, 0xe1, 0x3b, 0x00, 0x13, 0xe9,
+  0xe7, 0x00, 0x43, 0xcd, 0x99, 0x45, 0xeb, 0xfb, 0x00, 0x25, 0xcd, 0x9c,
+  0x0b, 0x00, 0x33, 0xc3, 0xa8, 0x46, 0x20, 0x00, 0xf2, 0x17, 0x7d, 0x07,
+  0x9f, 0x67, 0x7b, 0x07, 0x9f, 0x57, 0x7c, 0xaa, 0x17, 0x7c, 0xf5, 0x17,
+  0x30, 0x06, 0x97, 0x95, 0x6f, 0x9f, 0x94, 0x67, 0xcb, 0x7a, 0x28, 0x06,
+  0x97, 0x93, 0x5f, 0x9f, 0x92, 0x57, 0xcd, 0x9c, 0x45, 0xf1, 0xd0, 0x47,
+  0x16, 0x00, 0x52, 0x78, 0xc9, 0x17, 0xeb, 0xd0, 0x0b, 0x00, 0x01, 0x3b,
+  0x03, 0x53, 0xcb, 0x05, 0x7e, 0x28, 0x10, 0xd5, 0x18, 0x32, 0x21, 0x6b,
+  0x97, 0xda, 0x43, 0x02, 0xf9, 0x16, 0x41, 0x2a, 0x12, 0x9c, 0x09, 0xf9,
+  0x1e, 0x25, 0x12, 0x9c, 0x30, 0x39, 0x82, 0x91, 0xfd, 0x7e, 0x01, 0x98,
+  0xcb, 0x07, 0xe6, 0x7d, 0x2a, 0x53, 0xcd, 0xbd, 0xf9, 0x4d, 0x44, 0x1b,
+  0x1b, 0x50, 0x21, 0x0a, 0x9c, 0x01, 0x08, 0x92, 0x30, 0x25, 0xc6, 0xf9,
+  0x80, 0x0b, 0x07, 0x20, 0x00, 0x50, 0xd5, 0xc5, 0x11, 0x0a, 0x9c, 0xf9,
+  0x02, 0x04, 0x02, 0x2b, 0x15, 0xc5, 0xb1, 0x14, 0x07, 0x21, 0x3b, 0x01,
+  0x31, 0x00, 0x33, 0x11, 0x0a, 0x9c, 0x0a, 0x25, 0x08, 0x51, 0x00, 0x70,
+  0xfd, 0x21, 0xf2, 0x9b, 0xfd, 0x34, 0x00, 0x8a, 0x29, 0xf6, 0x1b, 0x0a,
+  0xc0, 0x21, 0xf2, 0x9b, 0x36, 0x00, 0xed, 0x4b, 0x0a, 0x9c, 0xed, 0x5b,
+  0x0c, 0x9c, 0x0c, 0x20, 0x04, 0x04, 0x20, 0x01, 0x13, 0xed, 0x43, 0x0a,
+  0x9c, 0xed, 0x53, 0x0c, 0x9c, 0x7a, 0xb3, 0xb0, 0xb1, 0xc0, 0xed, 0x4b,
+  0x0e, 0x9c, 0xed, 0x5b, 0x10, 0x1c, 0x00, 0x62, 0x0e, 0x9c, 0xed, 0x53,
+  0x10, 0x9c, 0x2e, 0x04, 0x40, 0x04, 0xdd, 0x86, 0x06, 0x54, 0x05, 0xd0,
+  0xdd, 0x8e, 0x07, 0x47, 0x79, 0xdd, 0x96, 0x04, 0x78, 0xdd, 0x9e, 0x05,
+  0x30, 0x49, 0x03, 0x00, 0x1c, 0x1f, 0x52, 0x00, 0x00, 0xbf, 0xed, 0x42,
+  0x87, 0x32, 0x02, 0x2b, 0x2d, 0x80, 0x28, 0x11, 0xbf, 0x38, 0x0e, 0xed,
+  0x4b, 0x1c, 0x64, 0x1a, 0x02, 0x2b, 0x00, 0x90, 0x0a, 0xdd, 0x36, 0x06,
+  0x00, 0xdd, 0x36, 0x07, 0x00, 0xd2, 0x18, 0x00, 0x4d, 0x00, 0x00, 0x93,
+  0x1b, 0xb0, 0xdd, 0x8e, 0x07, 0x57, 0x69, 0x60, 0xbf, 0xed, 0x52, 0x30,
+  0x10, 0x29, 0x00, 0x10, 0x4f, 0x2a, 0x00, 0x73, 0x47, 0xdd, 0x71, 0x06,
+  0xdd, 0x70, 0x07, 0xec, 0x32, 0x31, 0x06, 0x21, 0x0e, 0x58, 0x15, 0x01,
+  0x86, 0x12, 0x03, 0xef, 0x40, 0x32, 0xc5, 0x21, 0x08, 0x93, 0x3a, 0x21,
+  0xe5, 0xc5, 0xc6, 0x0f, 0x00, 0x24, 0x0e, 0x11, 0x04, 0xda, 0x3a, 0x32,
+  0x04, 0x00, 0x39, 0xa4, 0x3d, 0x02, 0x1f, 0x00, 0x72, 0xd5, 0xc5, 0xcd,
+  0x49, 0xfa, 0xf1, 0xf1, 0xcd, 0x42, 0x12, 0xc5, 0x81, 0x33, 0x09, 0x31,
+  0x00, 0x11, 0xc5, 0x88, 0x37, 0x01, 0xeb, 0x42, 0x14, 0x02, 0x1d, 0x00,
+  0x04, 0x1c, 0x00, 0x02, 0x0b, 0x43, 0x31, 0x19, 0xfa, 0xf1, 0x57, 0x00,
+  0x01, 0x37, 0x12, 0x0f, 0x77, 0x00, 0x04, 0x00, 0x0a, 0x10, 0x00, 0xf4,
+  0x13, 0x22, 0xfd, 0x39, 0x7f, 0x0d, 0x00, 0x07, 0x0a, 0x11, 0x27, 0x78,
+  0x00, 0x05, 0x3a, 0x00, 0x0f, 0x7b, 0x00, 0x00, 0x05, 0xed, 0x44, 0x26,
+  0xf0, 0xf9, 0x2a, 0x00, 0x0e, 0x87, 0x00, 0x05, 0x43, 0x00, 0x04, 0x2f,
+  0x00, 0x10, 0xfd, 0x2f, 0x00, 0x02, 0xd1, 0x00, 0x04, 0xe8, 0x00, 0x0f,
+  0x07, 0x01, 0x00, 0x03, 0x18, 0x00, 0x22, 0x67, 0xfa, 0xe1, 0x12, 0xf2,
+  0x10, 0xcd, 0xbd, 0xf9, 0x2a, 0x00, 0xf4, 0x7e, 0xfe, 0x01, 0x28, 0x1a,
+  0xfe, 0x03, 0x28, 0x08, 0xfe, 0x04, 0x28, 0x04, 0xd6, 0x05, 0x20, 0x06,
+  0x21, 0xfd, 0x9b, 0x34, 0x18, 0x08, 0x21, 0x2f, 0xd9, 0x1e, 0x30, 0x2a,
+  0x00, 0xf4, 0x31, 0x1f, 0x00, 0xd1, 0x0e, 0x10, 0x0c, 0x1d, 0x08, 0x03,
+  0xe1, 0x0e, 0x00, 0x75, 0x0e, 0xf0, 0x00, 0x21, 0x20, 0x00, 0x09, 0xeb,
+  0x2a, 0x08, 0x9c, 0x23, 0x22, 0x08, 0x9c, 0xfd, 0x21, 0x08, 0x06, 0x37,
+  0x02, 0x34, 0x44, 0x77, 0xdd, 0xe1, 0xc3, 0x87, 0x4a, 0x3e, 0x03, 0x14,
+  0x45, 0x20, 0x8b, 0x49, 0x26, 0x45, 0x1c, 0x04, 0x12, 0x00, 0x00, 0xdc,
+  0x02, 0x02, 0xaa, 0x02, 0xf2, 0x03, 0x3e, 0xa6, 0x21, 0x85, 0xaa, 0x7b,
+  0x96, 0x7a, 0x23, 0x9e, 0x30, 0x36, 0x1a, 0x6f, 0x3e, 0x01, 0x95, 0x30,
+  0x24, 0x34, 0x11, 0x0c, 0x21, 0x15, 0x16, 0x0d, 0x43, 0x34, 0x13, 0x11,
+  0x38, 0x09, 0x60, 0x09, 0xc5, 0xd5, 0xd5, 0xcd, 0x65, 0xde, 0x27, 0x00,
+  0x5e, 0x14, 0x31, 0xeb, 0x18, 0xc0, 0x7b, 0x3d, 0x00, 0xe0, 0x02, 0x01,
+  0xc7, 0x3c, 0xd0, 0x5f, 0x3e, 0x01, 0x93, 0xd0, 0x7b, 0xfe, 0x05, 0xd0,
+  0xd6, 0x02, 0x28, 0x07, 0xd2, 0x00, 0x52, 0x3e, 0x02, 0x02, 0x21, 0x0c,
+  0xeb, 0x25, 0x00, 0xb5, 0x48, 0xd2, 0x2a, 0x00, 0xf4, 0x4e, 0x3e, 0x02,
+  0x91, 0x30, 0x04, 0x21, 0xfd, 0x9b, 0x35, 0x0e, 0x3d, 0x10, 0x15, 0xd4,
+  0x00, 0x51, 0x0a, 0x5f, 0x3e, 0x02, 0x93, 0x16, 0x00, 0xf1, 0x0b, 0x34,
+  0x3e, 0x01, 0x02, 0xcd, 0xb7, 0xf9, 0x3a, 0xfd, 0x9b, 0xb7, 0x20, 0x15,
+  0xcd, 0xb7, 0xf9, 0x21, 0x10, 0xf4, 0x36, 0x01, 0xcd, 0xd2, 0x01, 0xcd,
+  0xbd, 0x0b, 0x00, 0x31, 0x00, 0x18, 0xe5, 0x30, 0x00, 0x90, 0xfe, 0x01,
+  0x28, 0x05, 0xd6, 0x02, 0xc2, 0x83, 0xfa, 0x07, 0x07, 0xf0, 0x14, 0x20,
+  0x06, 0x3e, 0x01, 0x02, 0xc3, 0xb7, 0xf9, 0x3e, 0x02, 0x02, 0xc3, 0x83,
+  0xfa, 0xed, 0x4b, 0xaa, 0x9b, 0x21, 0xaa, 0x9b, 0x7e, 0xc6, 0x49, 0x77,
+  0x30, 0x02, 0x23, 0x34, 0x21, 0x85, 0xaa, 0xfd, 0x21, 0xaa, 0x1b, 0x07,
+  0x70, 0x96, 0xfd, 0x7e, 0x01, 0x23, 0x9e, 0x38, 0x67, 0x0f, 0x80, 0x3e,
+  0xfd, 0x36, 0x01, 0xa6, 0x2a, 0xaa, 0x9b, 0x86, 0x01, 0x10, 0x06, 0xfe,
+  0x45, 0x43, 0x18, 0x0c, 0x21, 0x3e, 0x7a, 0x01, 0x33, 0xaa, 0x9b, 0xc9,
+  0x31, 0x00, 0x31, 0x91, 0x20, 0xb7, 0x6a, 0x39, 0x11, 0xb1, 0x99, 0x07,
+  0x52, 0x28, 0x0a, 0xc5, 0x21, 0x55, 0x24, 0x00, 0xb2, 0xc1, 0xc5, 0xcd,
+  0xb7, 0xf9, 0xcd, 0xd2, 0x01, 0xc1, 0x18, 0x96, 0xcb, 0x12, 0x04, 0x16,
+  0x3f, 0x00, 0xc6, 0x1e, 0x06, 0xe0, 0x3f, 0x03, 0x3a, 0x04, 0x00, 0x51,
+  0x01, 0x11, 0x0e, 0x51, 0x01, 0x11, 0x0f, 0x16, 0x0d, 0x00, 0xe3, 0x0d,
+  0x05, 0x64, 0x1c, 0x02, 0x10, 0x3f, 0x00, 0x65, 0x21, 0x10, 0x10, 0xa2,
+  0x0a, 0x20, 0x23, 0x66, 0x0b, 0x2a, 0x26, 0x74, 0x01, 0x32, 0x18, 0x20,
+  0x04, 0xf7, 0x02, 0x45, 0x20, 0x01, 0x12, 0x1c, 0x01, 0x06, 0x2a, 0x3f,
+  0x47, 0x21, 0x06, 0x00, 0x19, 0x44, 0x00, 0x42, 0x16, 0x00, 0xfd, 0x19,
+  0xcc, 0x05, 0x38, 0xc5, 0x01, 0x16, 0x48, 0x00, 0x37, 0xfd, 0x21, 0x1c,
+  0x1b, 0x00, 0x1a, 0x1c, 0x1b, 0x00, 0x17, 0x18, 0x1b, 0x00, 0x1a, 0x18,
+  0x1b, 0x00, 0x17, 0x1e, 0x1b, 0x00, 0x18, 0x1e, 0x1b, 0x00, 0x00, 0xce,
+  0x00, 0x14, 0x23, 0x8a, 0x29, 0x00, 0x13, 0x00, 0x00, 0xc0, 0x00, 0x03,
+  0x2b, 0x00, 0x01, 0xfc, 0x2f, 0x04, 0x29, 0x00, 0x70, 0x21, 0x12, 0x00,
+  0x19, 0x36, 0x32, 0x23, 0x1d, 0x45, 0x00, 0xc5, 0x2d, 0x62, 0x30, 0x00,
+  0x19, 0xc5, 0x06, 0x10, 0x05, 0x28, 0x90, 0x21, 0x2c, 0x00, 0x19, 0xe5,
+  0xc5, 0x11, 0x12, 0x9c, 0x36, 0x03, 0x06, 0x50, 0x05, 0x14, 0x04, 0x84,
+  0x17, 0x41, 0x69, 0x60, 0x11, 0x87, 0xe3, 0x20, 0x30, 0x7a, 0xb3, 0x28,
+  0x7b, 0x2a, 0x6a, 0x19, 0x34, 0x69, 0x60, 0x11, 0x89, 0x12, 0x00, 0x30,
+  0x21, 0x11, 0x00, 0x1d, 0x48, 0x03, 0x5c, 0x02, 0x20, 0x21, 0x7b, 0x66,
+  0x27, 0x10, 0x85, 0x6d, 0x16, 0xb2, 0x7b, 0x91, 0x7a, 0x98, 0x30, 0x19,
+  0x1a, 0xfe, 0xff, 0x28, 0x11, 0x2d, 0x11, 0x10, 0xd5, 0x9f, 0x18, 0x9d,
+  0x11, 0x07, 0x00, 0x19, 0xd1, 0x34, 0x13, 0x18, 0xe1, 0xd1, 0x40, 0x01,
+  0x30, 0x48, 0x02, 0x29, 0x09, 0x35, 0xcd, 0xbd, 0xf9, 0x57, 0x1f, 0x58,
+  0x3e, 0xdd, 0x36, 0xfd, 0xa6, 0x42, 0x34, 0xf3, 0x00, 0x21, 0x85, 0xaa,
+  0xdd, 0x7e, 0xfe, 0x96, 0xdd, 0x7e, 0xff, 0x23, 0x9e, 0xd2, 0x72, 0x4e,
+  0x3a, 0x07, 0x41, 0xb7, 0xc2, 0x56, 0x4e, 0x26, 0x00, 0x11, 0xf8, 0x26,
+  0x00, 0x52, 0xf9, 0xe1, 0xe5, 0x06, 0x49, 0xe5, 0x00, 0x50, 0xc5, 0x03,
+  0x03, 0x69, 0x60, 0x20, 0x26, 0xf0, 0x04, 0x66, 0xed, 0x5b, 0xac, 0x9b,
+  0x2a, 0xac, 0x9b, 0x23, 0x22, 0xac, 0x9b, 0xaf, 0xbb, 0x3e, 0x7d, 0x9a,
+  0x30, 0x06, 0x45, 0x3b, 0x70, 0xac, 0x9b, 0x69, 0x60, 0xfd, 0x21, 0xac,
+  0x68, 0x02, 0x68, 0x77, 0x23, 0xfd, 0x7e, 0x01, 0x77, 0x8d, 0x03, 0x59,
+  0xc1, 0x1a, 0xb7, 0x28, 0x27, 0x9a, 0x23, 0x03, 0x2b, 0x00, 0x00, 0x8c,
+  0x03, 0x12, 0x0e, 0xf0, 0x3a, 0x20, 0x20, 0x06, 0x30, 0x3a, 0x22, 0x18,
+  0x96, 0x89, 0x03, 0x10, 0xc4, 0x4a, 0x34, 0x20, 0x44, 0x4f, 0x48, 0x34,
+  0x61, 0x00, 0x47, 0xed, 0x5b, 0x1c, 0xf4, 0x23, 0x21, 0x00, 0xee, 0x00,
+  0x20, 0xfb, 0x86, 0xc1, 0x04, 0xf2, 0x01, 0x0d, 0xe1, 0xe5, 0x36, 0x06,
+  0x2a, 0xfb, 0x9b, 0x23, 0x22, 0xfb, 0x9b, 0x18, 0x09, 0x21, 0x0c, 0x60,
+  0x19, 0x10, 0xe3, 0x36, 0x00, 0x13, 0x40, 0x36, 0x00, 0x00, 0x4c, 0x0a,
+  0x11, 0x40, 0x66, 0x01, 0x02, 0x5f, 0x21, 0x51, 0x7e, 0xf8, 0xc6, 0x24,
+  0x5f, 0x1b, 0x00, 0x10, 0x57, 0x88, 0x04, 0x11, 0x24, 0xf0, 0x0e, 0x22,
+  0xed, 0xb0, 0x5a, 0x44, 0x20, 0x18, 0x1c, 0x2a, 0x18, 0x51, 0x49, 0xdd,
+  0x77, 0xfe, 0x30, 0xb6, 0x30, 0x00, 0xb8, 0x0b, 0x00, 0xdc, 0x1d, 0x65,
+  0xdd, 0x77, 0xfd, 0xc3, 0x45, 0x4d, 0x0e, 0x14, 0x06, 0x3a, 0x19, 0x01,
+  0x48, 0x0e, 0x43, 0xfd, 0x21, 0x98, 0xb4, 0x05, 0x07, 0xf0, 0x00, 0x32,
+  0xda, 0x2c, 0x4f, 0x21, 0x98, 0xb4, 0x36, 0x00, 0x01, 0x69, 0x9b, 0x3a,
+  0xfd, 0x9b, 0xd7, 0x0d, 0x60, 0x36, 0xf6, 0x00, 0xdd, 0x7e, 0xf5, 0x4c,
+  0x01, 0x22, 0x36, 0xf7, 0xb1, 0x3a, 0x90, 0x7e, 0xff, 0xd6, 0x03, 0x30,
+  0x6c, 0xdd, 0x34, 0xff, 0xc6, 0x2d, 0x60, 0xdd, 0x75, 0xf9, 0xdd, 0x74,
+  0xfa, 0x9f, 0x00, 0xf2, 0x06, 0xdd, 0x96, 0xf7, 0x5f, 0x7a, 0xdd, 0x9e,
+  0xf8, 0x57, 0x0a, 0x6f, 0x26, 0x00, 0xc5, 0xe5, 0xd5, 0xcd, 0xcb, 0x45,
+  0xf1, 0xf1, 0xce, 0x2a, 0x12, 0xc1, 0x92, 0x17, 0x01, 0x50, 0x1a, 0x11,
+  0xfd, 0xdc, 0x17, 0x01, 0x99, 0x00, 0x00, 0x27, 0x1e, 0x00, 0x06, 0x3b,
+  0xf2, 0x04, 0x7e, 0xfb, 0x83, 0xdd, 0x7e, 0xfc, 0x8a, 0x57, 0xdd, 0x7e,
+  0xfd, 0x8d, 0x6f, 0xdd, 0x7e, 0xfe, 0x8c, 0x5a, 0x55, 0x70, 0x17, 0x81,
+  0x73, 0x23, 0x72, 0x03, 0x03, 0x03, 0x18, 0x8d, 0xaf, 0x00, 0x60, 0x3a,
+  0xfe, 0x9b, 0xb7, 0x20, 0x5e, 0xa6, 0x05, 0x60, 0x3d, 0x20, 0x57, 0x3a,
+  0x06, 0xf4, 0x73, 0x04, 0x70, 0xcb, 0x47, 0x28, 0x27, 0xfd, 0x21, 0x34,
+  0x24, 0x24, 0x01, 0xf9, 0x2f, 0x63, 0xfd, 0x5e, 0x02, 0xfd, 0x56, 0x03,
+  0xa0, 0x07, 0x02, 0x79, 0x32, 0xbf, 0xfd, 0x73, 0x02, 0xfd, 0x72, 0x03,
+  0x18, 0x25, 0xfd, 0x21, 0x30, 0x27, 0x00, 0x0f, 0x42, 0xfd, 0x21, 0x04,
+  0x9c, 0x0b, 0x01, 0xd0, 0xfd, 0x21, 0x05, 0x9c, 0xfd, 0x96, 0x00, 0xc2,
+  0x4d, 0x50, 0x21, 0x04, 0x9c, 0x17, 0x08, 0x56, 0x12, 0x9c, 0xed, 0x5b,
+  0x14, 0xfb, 0x07, 0xc1, 0x12, 0x9c, 0xed, 0x53, 0x14, 0x9c, 0x21, 0x3e,
+  0xa6, 0x22, 0x99, 0xb4, 0xce, 0x04, 0x10, 0x99, 0xd0, 0x31, 0x02, 0xce,
+  0x04, 0x51, 0x30, 0x6a, 0x2a, 0x99, 0xb4, 0xe3, 0x0a, 0x00, 0x9d, 0x27,
+  0xb2, 0x78, 0xb1, 0x28, 0x1d, 0x0b, 0x71, 0x23, 0x70, 0x2a, 0x99, 0xb4,
+  0x51, 0x3a, 0xa2, 0xb6, 0x20, 0x0d, 0x3e, 0x0e, 0xf5, 0x33, 0x2a, 0x99,
+  0xb4, 0x97, 0x1e, 0x00, 0x2d, 0x00, 0x13, 0x22, 0x2d, 0x00, 0x20, 0x3e,
+  0x01, 0xe3, 0x30, 0x24, 0x30, 0x1b, 0x31, 0x00, 0x11, 0x22, 0x1c, 0x21,
+  0x51, 0x79, 0x3d, 0xb0, 0x20, 0x08, 0x30, 0x00, 0x61, 0x65, 0x4a, 0xf1,
+  0x21, 0x99, 0xb4, 0x47, 0x05, 0xc0, 0x89, 0x23, 0x34, 0xc3, 0xcb, 0x4f,
+  0xcd, 0x85, 0x47, 0xcd, 0x82, 0x4e, 0x1c, 0x01, 0x83, 0xc0, 0x2a, 0xff,
+  0x9b, 0x23, 0x22, 0xff, 0x9b, 0x7e, 0x0c, 0x00, 0xe3, 0x11, 0x02, 0x7e,
+  0x0c, 0x01, 0x5f, 0x09, 0xf0, 0x0e, 0xd8, 0x3a, 0x06, 0xf4, 0xcb, 0x47,
+  0xc0, 0x21, 0x01, 0x9c, 0xcb, 0x46, 0xc8, 0x3e, 0x01, 0xfd, 0x21, 0xfd,
+  0x9b, 0xfd, 0x96, 0x00, 0x30, 0x06, 0x21, 0x89, 0xfc, 0x36, 0x01, 0xf3,
+  0x42, 0x31, 0x22, 0xff, 0x9b, 0x07, 0x00, 0xd1, 0x0c, 0xf4, 0x21, 0x07,
+  0xf4, 0x6e, 0x7d, 0xd6, 0x50, 0x38, 0x08, 0x21, 0x2a, 0x55, 0x02, 0x40,
+  0x14, 0x01, 0x84, 0x97, 0xe0, 0x29, 0x00, 0x33, 0x07, 0x30, 0xcd, 0x34,
+  0x46, 0xd1, 0x1d, 0x10, 0x0a, 0x59, 0x1f, 0x00, 0xb5, 0x00, 0x00, 0xe8,
+  0x03, 0x32, 0xcd, 0xbd, 0xf9, 0x78, 0x15, 0x00, 0x77, 0x00, 0x01, 0x5c,
+  0x2f, 0x01, 0x77, 0x00, 0x01, 0x9d, 0x33, 0x27, 0x38, 0x11, 0x6c, 0x00,
+  0xc1, 0x3e, 0x02, 0x02, 0xcd, 0x83, 0xfa, 0xcd, 0xb7, 0xf9, 0xc3, 0xce,
+  0x53, 0x34, 0x09, 0x01, 0x0a, 0x09, 0x18, 0x36, 0x64, 0x03, 0x33, 0x29,
+  0x6b, 0x62, 0x2d, 0x16, 0x40, 0xdd, 0x7e, 0x04, 0x91, 0x3d, 0x0e, 0x30,
+  0x05, 0x90, 0x20, 0xb6, 0x17, 0x01, 0x18, 0x18, 0x00, 0x2e, 0x01, 0x12,
+  0xd1, 0x5b, 0x03, 0x12, 0xcd, 0xc1, 0x02, 0xf0, 0x12, 0x3a, 0xba, 0xf4,
+  0x0f, 0x38, 0x38, 0xdd, 0x7e, 0x04, 0xfe, 0x03, 0x28, 0x27, 0xfe, 0x04,
+  0x28, 0x23, 0xfe, 0x05, 0x28, 0x1f, 0xfe, 0x06, 0x28, 0x1b, 0xfe, 0x07,
+  0x28, 0x17, 0xfe, 0x08, 0x28, 0x13, 0x1b, 0x00, 0xf0, 0x0a, 0x0b, 0x28,
+  0x0c, 0xfe, 0x18, 0x28, 0x08, 0xfe, 0x19, 0x28, 0x04, 0xfe, 0x1f, 0x20,
+  0x0a, 0xcd, 0x49, 0x5e, 0x7d, 0xdd, 0xb6, 0x04, 0x6f, 0x18, 0x03, 0x12,
+  0x0a, 0xf1, 0x07, 0xe1, 0xc9, 0x21, 0x11, 0xf4, 0x4e, 0x79, 0xb7, 0x28,
+  0x3c, 0xed, 0x5b, 0x00, 0xf4, 0x21, 0x14, 0x00, 0x19, 0xeb, 0xcb, 0x61,
+  0x28, 0xcc, 0x05, 0x71, 0xeb, 0xcb, 0xa1, 0x21, 0x11, 0xf4, 0x71, 0xb2,
+  0x30, 0x51, 0x3a, 0x11, 0xf4, 0xf5, 0x21, 0xda, 0x1d, 0xa2, 0x01, 0x29,
+  0x3d, 0x20, 0xfc, 0x79, 0xb5, 0x4f, 0x78, 0xb4, 0x3a, 0x4a, 0x50, 0x21,
+  0x11, 0xf4, 0x36, 0x00, 0x0f, 0x01, 0xa0, 0x46, 0x00, 0x09, 0xcb, 0xc6,
+  0xc9, 0x78, 0x00, 0xfe, 0x30, 0x5a, 0x03, 0x11, 0xf2, 0x99, 0x21, 0x53,
+  0xf2, 0x01, 0x21, 0x20, 0xf4, 0xc0, 0x04, 0x00, 0x02, 0x0c, 0x11, 0xf3,
+  0x02, 0x0c, 0x71, 0xf4, 0xdd, 0x6e, 0xf3, 0xdd, 0x66, 0xf4, 0xa5, 0x14,
+  0x00, 0x09, 0x00, 0x03, 0x34, 0x2a, 0x04, 0xa9, 0x14, 0x52, 0xdd, 0x77,
+  0xfe, 0x78, 0xa2, 0xa0, 0x45, 0x01, 0x59, 0x11, 0x11, 0xff, 0x33, 0x1b,
+  0x01, 0xf0, 0x3a, 0x61, 0x05, 0x2e, 0x00, 0xc3, 0xc9, 0x53, 0x4a, 0x50,
+  0x75, 0x0d, 0xdd, 0x36, 0xf2, 0x00, 0x21, 0x3e, 0x5e, 0x00, 0x12, 0xfa,
+  0xc9, 0x10, 0x01, 0x1c, 0x05, 0x11, 0xf2, 0x3e, 0x00, 0x90, 0xff, 0xd6,
+  0x0f, 0xd2, 0xc5, 0x53, 0xdd, 0x7e, 0xfd, 0xb6, 0x14, 0x10, 0xfd, 0x13,
+  0x04, 0x00, 0xc6, 0x34, 0xf0, 0x06, 0xdd, 0x36, 0xf7, 0x01, 0xdd, 0x36,
+  0xf8, 0x00, 0x04, 0x18, 0x08, 0xdd, 0xcb, 0xf7, 0x26, 0xdd, 0xcb, 0xf8,
+  0x16, 0x10, 0xf6, 0x82, 0x1b, 0x30, 0xa6, 0xf5, 0x4f, 0x83, 0x1b, 0x62,
+  0xa6, 0xf6, 0xb1, 0xca, 0xb9, 0x53, 0x30, 0x10, 0x41, 0x7e, 0xdd, 0x77,
+  0xf9, 0x0a, 0x1f, 0x42, 0xdd, 0x7e, 0xf7, 0x2f, 0x95, 0x1b, 0x11, 0x2f,
+  0x53, 0x04, 0x60, 0xfa, 0xdd, 0xb6, 0xf9, 0xc2, 0x83, 0x89, 0x00, 0xf2,
+  0x03, 0xb7, 0x28, 0x59, 0x2a, 0xd8, 0x51, 0x7d, 0xdd, 0xa6, 0xf7, 0x4f,
+  0x7c, 0xdd, 0xa6, 0xf8, 0xb1, 0x28, 0x4a, 0x53, 0x08, 0x20, 0x36, 0x05,
+  0x14, 0x01, 0x10, 0x43, 0x28, 0x09, 0x25, 0xf2, 0x77, 0xf0, 0x00, 0xa2,
+  0x79, 0xdd, 0xa6, 0xfb, 0x4f, 0x78, 0xdd, 0xa6, 0xfc, 0x47, 0x13, 0x00,
+  0x61, 0x71, 0x23, 0x70, 0x3a, 0x10, 0xf4, 0xd6, 0x3b, 0x41, 0xff, 0x46,
+  0x28, 0x07, 0x8e, 0x02, 0x70, 0x18, 0x03, 0xcd, 0x87, 0x4a, 0x2e, 0xff,
+  0xe8, 0x00, 0x0f, 0x37, 0x00, 0x08, 0x01, 0x7b, 0x00, 0x37, 0x0f, 0x2a,
+  0xda, 0x7b, 0x00, 0x23, 0x20, 0x64, 0x00, 0x18, 0x00, 0x27, 0x1e, 0xd0,
+  0x7b, 0x3d, 0xb2, 0x28, 0x54, 0x0a, 0xd6, 0x03, 0x20, 0x07, 0x3e, 0x01,
+  0x02, 0xa8, 0x07, 0x02, 0x7a, 0x1f, 0x91, 0x43, 0x51, 0x33, 0x26, 0x00,
+  0xe5, 0xcd, 0xbf, 0x55, 0x9c, 0x2c, 0x7f, 0xf9, 0x3d, 0xdd, 0xb6, 0xfa,
+  0x28, 0x2d, 0x68, 0x00, 0x0c, 0xe2, 0x87, 0x87, 0x87, 0x87, 0x4f, 0xdd,
+  0x7e, 0xf2, 0x81, 0x32, 0x11, 0xf4, 0x18, 0x0c, 0x95, 0x3e, 0x95, 0xdd,
+  0x77, 0xf2, 0xc3, 0x61, 0x52, 0x3a, 0x11, 0xf4, 0x07, 0x2b, 0x11, 0x3b,
+  0x08, 0x0a, 0xc0, 0x14, 0x00, 0x09, 0xeb, 0x0a, 0xd6, 0x04, 0x20, 0x07,
+  0xcd, 0x8a, 0x51, 0xed, 0x48, 0x20, 0x3a, 0x11, 0xde, 0x00, 0x30, 0xb7,
+  0x20, 0x12, 0x1e, 0x00, 0x01, 0x17, 0x28, 0xf0, 0x07, 0x46, 0x0f, 0x30,
+  0x05, 0x0a, 0xd6, 0x05, 0x20, 0x05, 0xdd, 0x6e, 0xff, 0x18, 0x38, 0x0e,
+  0x00, 0x6b, 0x62, 0xe5, 0xc5, 0xd5, 0x79, 0x9e, 0x1d, 0x20, 0xdc, 0x51,
+  0xd1, 0x1c, 0x90, 0xc1, 0xe1, 0xfe, 0xff, 0x28, 0xc8, 0xb7, 0x28, 0x06,
+  0x5d, 0x00, 0x30, 0x18, 0x17, 0x0c, 0xcb, 0x1a, 0x74, 0x5d, 0x54, 0x79,
+  0xd6, 0x02, 0x38, 0xd7, 0x66, 0x02, 0x24, 0x86, 0x2e, 0xf2, 0x18, 0x01,
+  0xfe, 0x44, 0x03, 0x65, 0x0c, 0x14, 0x14, 0xd3, 0x31, 0x20, 0x3e, 0x0f,
+  0x55, 0x4f, 0x11, 0x0d, 0xe5, 0x33, 0x06, 0x0c, 0x06, 0xa0, 0x06, 0xdd,
+  0x77, 0xf7, 0xe6, 0x0f, 0xdd, 0x36, 0xf8, 0x01, 0x3b, 0x3f, 0x10, 0x3c,
+  0xfe, 0x01, 0x60, 0xf8, 0x26, 0xdd, 0xcb, 0xf9, 0x16, 0x9d, 0x27, 0x42,
+  0xcd, 0xbd, 0xf9, 0xc1, 0x49, 0x02, 0x50, 0x0a, 0xb7, 0xca, 0x72, 0x55,
+  0x03, 0x1f, 0x20, 0xcb, 0xc6, 0x9e, 0x2b, 0x04, 0x69, 0x17, 0x50, 0xf7,
+  0xd6, 0x12, 0x20, 0x28, 0xb7, 0x00, 0x10, 0x0d, 0x3e, 0x0a, 0x11, 0x43,
+  0xe8, 0x07, 0x00, 0x55, 0x01, 0x04, 0x1b, 0x49, 0x47, 0x7b, 0xe6, 0x87,
+  0x5f, 0xfc, 0x36, 0xc5, 0xf7, 0xd6, 0x13, 0x38, 0x1b, 0x3e, 0x16, 0xdd,
+  0x96, 0xf7, 0x38, 0x14, 0x24, 0x00, 0x26, 0xcb, 0x93, 0x22, 0x00, 0x03,
+  0x9c, 0x08, 0x01, 0x39, 0x06, 0x20, 0xa6, 0xf8, 0xc0, 0x4a, 0x43, 0xf9,
+  0xb3, 0x20, 0x49, 0x97, 0x27, 0x03, 0x0f, 0x03, 0x06, 0x19, 0x00, 0x12,
+  0x14, 0xc9, 0x01, 0x11, 0x02, 0xc9, 0x01, 0x04, 0x60, 0x08, 0x06, 0xe1,
+  0x17, 0x20, 0xdd, 0xb6, 0x29, 0x00, 0x32, 0xb6, 0xf9, 0x57, 0x13, 0x00,
+  0x00, 0xa0, 0x49, 0x40, 0xd6, 0x02, 0x20, 0x0f, 0xd1, 0x03, 0x51, 0x79,
+  0x93, 0x20, 0x07, 0x78, 0xbf, 0x42, 0x03, 0xf3, 0x3d, 0x08, 0x6a, 0x08,
+  0x02, 0x12, 0x0e, 0x03, 0x46, 0x2d, 0xa0, 0x69, 0x60, 0x11, 0x1c, 0x00,
+  0x19, 0xcb, 0x4e, 0x28, 0x0a, 0xbe, 0x02, 0x01, 0xe3, 0x50, 0x40, 0x17,
+  0xc5, 0x3e, 0x11, 0x1d, 0x11, 0x00, 0x78, 0x04, 0x01, 0x36, 0x1d, 0x64,
+  0x00, 0xf4, 0x36, 0x07, 0x21, 0x01, 0x58, 0x2a, 0x10, 0xf5, 0x08, 0x16,
+  0x00, 0xae, 0x14, 0x01, 0xa0, 0x05, 0x22, 0x21, 0x67, 0x88, 0x0a, 0x32,
+  0xcd, 0xdf, 0x35, 0x7a, 0x0a, 0x00, 0xae, 0x01, 0x22, 0x18, 0x00, 0x54,
+  0x50, 0x00, 0x0c, 0x00, 0x13, 0x1e, 0x0c, 0x00, 0x04, 0x31, 0x04, 0xf0,
+  0x13, 0xe5, 0xcd, 0xc4, 0x86, 0xf1, 0x01, 0x7b, 0xf4, 0x16, 0x00, 0x6a,
+  0x26, 0x00, 0x09, 0x7e, 0x3c, 0x28, 0x0a, 0xc5, 0xd5, 0xd5, 0x33, 0xcd,
+  0xfb, 0x32, 0x33, 0xd1, 0xc1, 0x14, 0x7a, 0xd6, 0x0a, 0x38, 0xe8, 0x36,
+  0x00, 0x00, 0xef, 0x3a, 0x05, 0x4b, 0x1b, 0x21, 0x87, 0xf4, 0x58, 0x3a,
+  0x22, 0x2a, 0x89, 0x08, 0x00, 0x07, 0x3a, 0x05, 0x80, 0xd2, 0xde, 0x56,
+  0x1a, 0xb7, 0xca, 0xd6, 0x56, 0x67, 0x02, 0x81, 0x7b, 0x91, 0x20, 0x04,
+  0x7a, 0x90, 0x28, 0x73, 0x74, 0x0d, 0x10, 0x19, 0xa1, 0x08, 0x02, 0x68,
+  0x4f, 0x30, 0x77, 0xff, 0x79, 0xab, 0x08, 0x20, 0x15, 0x78, 0xa9, 0x08,
+  0x14, 0x0f, 0x72, 0x0b, 0xab, 0xd5, 0xd5, 0xcd, 0x81, 0x55, 0xf1, 0xd1,
+  0xfd, 0x21, 0x40, 0x2d, 0x00, 0x04, 0xde, 0x00, 0x00, 0x9c, 0x42, 0x84,
+  0x20, 0x26, 0xdd, 0x7e, 0xff, 0x90, 0x20, 0x20, 0x0e, 0x1b, 0x01, 0x47,
+  0x12, 0x03, 0x91, 0x05, 0x01, 0x42, 0x12, 0x08, 0x9d, 0x05, 0x63, 0xc3,
+  0x47, 0x56, 0xcd, 0x51, 0x3b, 0xe9, 0x1b, 0x00, 0x1c, 0x24, 0x60, 0x02,
+  0xf4, 0x2e, 0xff, 0x22, 0x04, 0x34, 0x06, 0x10, 0xe5, 0x6c, 0x00, 0x00,
+  0x68, 0x0c, 0xf1, 0x06, 0x2a, 0xfb, 0x9b, 0x2b, 0x22, 0xfb, 0x9b, 0xcd,
+  0xee, 0x4a, 0xe5, 0xcd, 0xd1, 0xfa, 0x21, 0x73, 0x9a, 0xe3, 0xcd, 0x19,
+  0x57, 0x98, 0x01, 0x31, 0x21, 0x85, 0x9a, 0x0a, 0x34, 0x02, 0xaf, 0x08,
+  0x82, 0x9e, 0x0d, 0xf1, 0xc3, 0x00, 0xf7, 0x21, 0x8f, 0x14, 0x00, 0x53,
+  0xcd, 0x9e, 0x57, 0x21, 0x9f, 0x66, 0x2c, 0xe8, 0x01, 0x00, 0x02, 0x16,
+  0x09, 0x2a, 0x85, 0xf4, 0x7d, 0xa1, 0x5f, 0x7c, 0xa0, 0xb3, 0x3d, 0x01,
+  0x90, 0xcb, 0x38, 0xcb, 0x19, 0x15, 0xcb, 0x7a, 0x28, 0xe2, 0xd0, 0x06,
+  0x22, 0x85, 0xf4, 0x06, 0x0d, 0x80, 0xfe, 0xc3, 0x28, 0x08, 0xd6, 0x18,
+  0x28, 0x04, 0x34, 0x2e, 0xf2, 0x09, 0x03, 0x03, 0x03, 0x0a, 0x03, 0xd6,
+  0x46, 0x20, 0x11, 0x0a, 0x03, 0xd6, 0x5a, 0x20, 0x0b, 0x0a, 0x03, 0xd6,
+  0x58, 0x20, 0x05, 0x0a, 0xd6, 0x31, 0x1e, 0x00, 0x00, 0x15, 0x12, 0x00,
+  0x5b, 0x03, 0xc0, 0xe0, 0xff, 0x39, 0xf9, 0x2a, 0x20, 0x9b, 0x22, 0x9d,
+  0xb4, 0x2a, 0x12, 0xb5, 0x4d, 0x50, 0xc5, 0xe5, 0xcd, 0x23, 0x11, 0x81,
+  0x46, 0x30, 0xed, 0x43, 0x9b, 0x98, 0x39, 0x01, 0x3b, 0x18, 0x42, 0x6a,
+  0x5c, 0x2a, 0x9b, 0x73, 0x45, 0x00, 0x71, 0x24, 0x31, 0x2a, 0x9b, 0xb4,
+  0x82, 0x30, 0x06, 0xac, 0x40, 0x20, 0xff, 0x7e, 0x9b, 0x11, 0x44, 0xfe,
+  0xe6, 0x49, 0x20, 0x8f, 0x45, 0x20, 0x5f, 0x5c, 0x3c, 0x01, 0x01, 0x36,
+  0x00, 0x03, 0xa7, 0x2c, 0x03, 0x9e, 0x3f, 0x10, 0x10, 0x5c, 0x2a, 0x02,
+  0xe5, 0x26, 0x00, 0xde, 0x29, 0x00, 0x68, 0x00, 0x06, 0x50, 0x3e, 0x01,
+  0x30, 0x00, 0x03, 0x97, 0x3f, 0x83, 0x7d, 0xd6, 0x10, 0xb4, 0x28, 0x09,
+  0x21, 0x08, 0x4f, 0x00, 0xa0, 0xdd, 0x4e, 0xf2, 0xdd, 0x46, 0xf3, 0xc5,
+  0xcd, 0x6b, 0x57, 0x54, 0x0a, 0x07, 0x18, 0x00, 0x02, 0x5f, 0x29, 0xf0,
+  0x08, 0x07, 0x00, 0x19, 0x4e, 0x51, 0x1e, 0x00, 0x7a, 0xb3, 0x20, 0x03,
+  0x11, 0x00, 0x01, 0xdd, 0x7e, 0xf2, 0xc6, 0x08, 0x6f, 0xdd, 0x7e, 0xf3,
+  0x4b, 0x22, 0x35, 0xfd, 0x21, 0x9d, 0xf4, 0x46, 0x03, 0x03, 0x45, 0x12,
+  0x08, 0xf2, 0x00, 0xc0, 0x18, 0x0a, 0x21, 0x9d, 0xb4, 0x7e, 0x83, 0x77,
+  0x23, 0x7e, 0x8a, 0x77, 0x33, 0x00, 0x21, 0x0e, 0x4f, 0x33, 0x00, 0x41,
+  0x47, 0x0a, 0xdd, 0x77, 0x91, 0x1d, 0x51, 0xf5, 0xfd, 0x2a, 0x9b, 0xb4,
+  0x42, 0x0d, 0x11, 0xf6, 0x42, 0x0d, 0x10, 0xf7, 0xd9, 0x21, 0x20, 0x86,
+  0xf6, 0x22, 0x26, 0x30, 0xdd, 0x8e, 0xf7, 0x01, 0x11, 0x63, 0xf6, 0x78,
+  0xdd, 0x9e, 0xf7, 0x30, 0xd5, 0x0a, 0x01, 0xa6, 0x00, 0x00, 0x65, 0x06,
+  0xf1, 0x03, 0xc6, 0x04, 0x47, 0x79, 0xdd, 0x86, 0xf4, 0x4f, 0x78, 0xdd,
+  0x8e, 0xf5, 0x47, 0x7a, 0xd6, 0x01, 0x38, 0x26, 0x84, 0x00, 0x32, 0x7e,
+  0x00, 0x93, 0x77, 0x02, 0x12, 0x9a, 0xf7, 0x06, 0x01, 0x0c, 0x45, 0x2f,
+  0x38, 0x0a, 0x47, 0x00, 0x00, 0x00, 0x83, 0x03, 0x70, 0x08, 0xd5, 0xcd,
+  0x8c, 0x05, 0x4d, 0x44, 0x28, 0x39, 0x20, 0x8c, 0x05, 0x15, 0x1f, 0x00,
+  0xea, 0x18, 0x40, 0x2a, 0x14, 0xf4, 0xc5, 0x59, 0x10, 0x20, 0x6f, 0x5c,
+  0x2e, 0x51, 0x02, 0x36, 0x43, 0x01, 0x52, 0x22, 0x01, 0xdf, 0x26, 0xd0,
+  0x77, 0xfd, 0xcb, 0x45, 0xc2, 0x44, 0x5c, 0x2a, 0x16, 0xf4, 0xe5, 0xfd,
+  0xe1, 0xc8, 0x0d, 0x01, 0x8f, 0x16, 0x14, 0xfd, 0x2f, 0x00, 0x01, 0x1d,
+  0x00, 0x60, 0xfd, 0x2a, 0x9d, 0xb4, 0xc5, 0xd5, 0x9f, 0x2e, 0x90, 0xfd,
+  0xe5, 0x2e, 0x00, 0xe5, 0xcd, 0x33, 0x87, 0xf1, 0x1c, 0x00, 0x74, 0x7c,
+  0xb5, 0xc2, 0x44, 0x5c, 0xc5, 0xd5, 0xe7, 0x01, 0x72, 0xdd, 0x75, 0xfe,
+  0xd1, 0xc1, 0x3a, 0xba, 0xb4, 0x06, 0x42, 0xfe, 0x56, 0x28, 0x0b, 0x0a,
+  0x01, 0x30, 0x07, 0xe6, 0x0c, 0x2c, 0x29, 0x80, 0xff, 0xcb, 0xc7, 0x32,
+  0xba, 0xf4, 0x18, 0x08, 0x0a, 0x00, 0x73, 0x87, 0x32, 0xba, 0xf4, 0x21,
+  0x1c, 0xf4, 0xe1, 0x00, 0x02, 0x50, 0x0c, 0x95, 0x2a, 0x00, 0xf4, 0xd5,
+  0x11, 0x44, 0x00, 0x19, 0xd1, 0x12, 0x00, 0x01, 0x3f, 0x00, 0xc1, 0xe5,
+  0xe1, 0xc5, 0x01, 0x07, 0x00, 0x09, 0xc1, 0xcb, 0x5e, 0x28, 0x1e, 0x0d,
+  0x00, 0x18, 0x0a, 0x9e, 0x1e, 0x11, 0x21, 0xd0, 0x31, 0x03, 0x57, 0x0e,
+  0x09, 0x2f, 0x00, 0x13, 0x56, 0x2f, 0x00, 0x19, 0x0c, 0x2f, 0x00, 0x16,
+  0x71, 0x2f, 0x00, 0x10, 0xd5, 0xbb, 0x22, 0x00, 0x07, 0x02, 0x04, 0x3a,
+  0x20, 0x20, 0x21, 0x10, 0xdf, 0x00, 0x04, 0x09, 0x20, 0x01, 0x25, 0x1b,
+  0x70, 0xcd, 0x41, 0x57, 0xd1, 0xc1, 0x21, 0x10, 0x29, 0x1a, 0x01, 0x3e,
+  0x06, 0x40, 0x10, 0xdd, 0xbe, 0xf6, 0x21, 0x34, 0x30, 0xf7, 0x30, 0x79,
+  0x01, 0x42, 0x40, 0xf0, 0xdd, 0x77, 0xf2, 0x01, 0x42, 0x14, 0xff, 0xd0,
+  0x29, 0x01, 0x8c, 0x08, 0x30, 0x77, 0xf7, 0x21, 0x3a, 0x2e, 0x10, 0xf6,
+  0x67, 0x00, 0x21, 0xf7, 0x77, 0xa1, 0x2b, 0x10, 0xf2, 0x0c, 0x00, 0x21,
+  0xf3, 0x77, 0xb4, 0x26, 0x01, 0xd2, 0x20, 0x05, 0xb4, 0x02, 0x40, 0xd1,
+  0xc1, 0x21, 0x97, 0xbb, 0x21, 0x10, 0xf6, 0xa0, 0x00, 0x00, 0xf6, 0x23,
+  0x60, 0xdd, 0x96, 0xf6, 0xc2, 0x37, 0x5c, 0x13, 0x24, 0x21, 0x96, 0xf7,
+  0x09, 0x00, 0x41, 0xfe, 0xdd, 0x86, 0xf2, 0xba, 0x08, 0x46, 0xff, 0xdd,
+  0x8e, 0xf3, 0xd8, 0x28, 0x02, 0xac, 0x01, 0x01, 0xe3, 0x29, 0x40, 0xfd,
+  0xe5, 0xcd, 0x5e, 0x9f, 0x23, 0x40, 0xc1, 0xfd, 0x21, 0x1e, 0xe0, 0x00,
+  0x30, 0xdd, 0x86, 0xf4, 0x12, 0x25, 0x42, 0xdd, 0x8e, 0xf5, 0x67, 0x17,
+  0x30, 0x63, 0xc5, 0x21, 0x20, 0xf4, 0x06, 0x40, 0xcd, 0x0e, 0x14, 0x10,
+  0x2b, 0x2a, 0x00, 0xd5, 0x01, 0x44, 0xfd, 0x2b, 0xfd, 0x2b, 0xfc, 0x20,
+  0x60, 0xc5, 0xfd, 0xe5, 0xcd, 0x36, 0x5d, 0xd9, 0x01, 0x02, 0x20, 0x00,
+  0x21, 0x4d, 0x44, 0xf2, 0x01, 0x03, 0x11, 0x02, 0x15, 0xc5, 0x1c, 0x00,
+  0x01, 0x2f, 0x2d, 0x01, 0xf6, 0x3d, 0x60, 0xd5, 0xc5, 0xcd, 0xab, 0x48,
+  0xf1, 0x56, 0x1c, 0x20, 0x01, 0x73, 0x18, 0x23, 0x01, 0x3b, 0x1c, 0x13,
+  0xd1, 0x7d, 0x0d, 0x51, 0xd5, 0xeb, 0x21, 0x73, 0xf4, 0x82, 0x0d, 0x04,
+  0x5e, 0x06, 0x34, 0xb6, 0x05, 0xf1, 0x26, 0x10, 0x31, 0xb6, 0x05, 0xf1,
+  0x03, 0x01, 0x20, 0x1d, 0x22, 0x5e, 0x47, 0x00, 0x61, 0x00, 0x23, 0x2b,
+  0x2b, 0x54, 0x00, 0x12, 0xe5, 0x4c, 0x1c, 0x10, 0xd1, 0xd0, 0x0d, 0x11,
+  0xfc, 0xeb, 0x0d, 0x90, 0xff, 0x47, 0xc5, 0xdd, 0x6e, 0xf0, 0xdd, 0x66,
+  0xf1, 0x83, 0x1e, 0x11, 0xc5, 0xa5, 0x1c, 0x01, 0x22, 0x00, 0x40, 0xc1,
+  0xed, 0x43, 0x1a, 0x3a, 0x05, 0x60, 0x36, 0x01, 0xd5, 0xcd, 0x31, 0xf8,
+  0x83, 0x06, 0x00, 0x42, 0x5a, 0x03, 0x3a, 0x0c, 0x00, 0x17, 0x00, 0x0f,
+  0x79, 0x00, 0x0b, 0x07, 0xde, 0x23, 0x02, 0x2c, 0x08, 0x08, 0x3d, 0x2a,
+  0x01, 0x1b, 0x11, 0x21, 0x69, 0x60, 0xad, 0x0f, 0x01, 0x61, 0x41, 0x00,
+  0xcc, 0x0d, 0x02, 0xa4, 0x32, 0x20, 0xc5, 0xd5, 0xf6, 0x00, 0x02, 0xa8,
+  0x35, 0x20, 0x28, 0x6b, 0x4b, 0x08, 0x00, 0xfa, 0x1e, 0x01, 0x4b, 0x08,
+  0x01, 0x78, 0x26, 0x12, 0x13, 0x42, 0x10, 0x32, 0xfa, 0x01, 0x09, 0x32,
+  0x4c, 0x22, 0xd1, 0xd5, 0xb3, 0x0d, 0x42, 0xd5, 0xfd, 0xe1, 0x13, 0xaa,
+  0x40, 0x32, 0x8d, 0x48, 0xf1, 0x51, 0x00, 0x10, 0xd1, 0x86, 0x32, 0x00,
+  0x83, 0x03, 0x23, 0x77, 0x23, 0x62, 0x00, 0xb3, 0x7e, 0xfb, 0x95, 0xdd,
+  0x7e, 0xfc, 0x9c, 0x30, 0x0a, 0x21, 0x07, 0x0c, 0x19, 0x11, 0x22, 0x87,
+  0x3a, 0x40, 0xc2, 0xc3, 0x99, 0x5c, 0x77, 0x32, 0x01, 0x8d, 0x00, 0x82,
+  0x7e, 0xf9, 0x95, 0x4f, 0xdd, 0x7e, 0xfa, 0x9c, 0x66, 0x0b, 0x07, 0xf6,
+  0x3c, 0x00, 0x4d, 0x17, 0x07, 0x3b, 0x17, 0x07, 0xcb, 0x3c, 0x04, 0x56,
+  0x08, 0x01, 0xce, 0x07, 0x00, 0x41, 0x0c, 0xe3, 0xdd, 0x77, 0x04, 0xdd,
+  0x7e, 0x05, 0x98, 0xdd, 0x77, 0x05, 0x7c, 0xb5, 0x28, 0x15, 0xe9, 0x31,
+  0x31, 0xfd, 0xe1, 0xd5, 0x07, 0x02, 0x01, 0xfd, 0x02, 0x15, 0xd1, 0x11,
+  0x1f, 0xe2, 0x69, 0x60, 0x23, 0x29, 0xdd, 0x7e, 0x04, 0x95, 0x6f, 0xdd,
+  0x7e, 0x05, 0x9c, 0x67, 0x1e, 0x02, 0x01, 0xe7, 0x24, 0x00, 0xc1, 0x36,
+  0x00, 0x6d, 0x24, 0x00, 0xaf, 0x32, 0x01, 0x11, 0x0a, 0x06, 0x56, 0x0f,
+  0x02, 0x3b, 0x35, 0x02, 0xd4, 0x01, 0x02, 0x49, 0x00, 0x12, 0x2b, 0x39,
+  0x00, 0x42, 0x78, 0xb1, 0x28, 0x3e, 0x79, 0x2a, 0x02, 0x64, 0x08, 0x00,
+  0x9a, 0x04, 0x03, 0xf1, 0x01, 0x01, 0x44, 0x20, 0x10, 0xfc, 0x4a, 0x01,
+  0x13, 0xfd, 0xaf, 0x46, 0x12, 0xbf, 0x99, 0x00, 0x62, 0x03, 0x1a, 0x13,
+  0xb7, 0x20, 0xfa, 0xaf, 0x4e, 0x22, 0x18, 0xab, 0xc2, 0x14, 0x00, 0xd2,
+  0x5c, 0x00, 0x38, 0x00, 0x03, 0xb3, 0x0f, 0x02, 0x07, 0x05, 0x01, 0xc4,
+  0x14, 0x05, 0x0a, 0x00, 0x00, 0x13, 0x01, 0x01, 0x2f, 0x11, 0x01, 0xbd,
+  0x0d, 0xf3, 0x02, 0x2a, 0x08, 0xf4, 0x01, 0xfb, 0xff, 0x09, 0x4d, 0x44,
+  0x21, 0x05, 0x00, 0xe5, 0xc5, 0x21, 0xa8, 0x9a, 0xe8, 0x00, 0x30, 0x7c,
+  0xb5, 0x28, 0x3c, 0x0c, 0x21, 0x8a, 0x5f, 0x44, 0x32, 0x03, 0x26, 0x00,
+  0x12, 0xd5, 0xd2, 0x06, 0x40, 0x7c, 0xb5, 0x28, 0x0c, 0xae, 0x07, 0x31,
+  0x1d, 0x22, 0xf1, 0x23, 0x00, 0x03, 0x8e, 0x2d, 0x71, 0x88, 0x5f, 0x21,
+  0xa8, 0x9a, 0x4d, 0x44, 0x87, 0x07, 0x22, 0xc7, 0x1a, 0x93, 0x43, 0x00,
+  0x15, 0x00, 0x00, 0xb3, 0x3b, 0x50, 0x00, 0x23, 0x36, 0x81, 0xc5, 0x69,
+  0x1c, 0x02, 0x6c, 0x33, 0x00, 0xd3, 0x36, 0x02, 0x30, 0x43, 0x00, 0x28,
+  0x3c, 0x10, 0xc1, 0x8b, 0x00, 0xf2, 0x00, 0xb3, 0x9b, 0x22, 0xb5, 0x9b,
+  0xfd, 0x21, 0xb7, 0x9b, 0x2a, 0x1e, 0xf4, 0x11, 0x00, 0x00, 0xa4, 0x03,
+  0x04, 0x66, 0x0f, 0x4c, 0xbb, 0x9b, 0x2a, 0x08, 0x16, 0x00, 0x50, 0x21,
+  0x00, 0xde, 0x22, 0xbf, 0xc4, 0x5d, 0x36, 0x22, 0xc1, 0x9b, 0x78, 0x47,
+  0x33, 0xae, 0x9b, 0x22, 0x05, 0x07, 0x00, 0x43, 0x34, 0x20, 0x62, 0xf4,
+  0xeb, 0x41, 0x11, 0xc5, 0x56, 0x45, 0x11, 0xc1, 0x69, 0x04, 0x00, 0x27,
+  0x00, 0x00, 0x1b, 0x2b, 0x11, 0x1e, 0x1b, 0x2b, 0x07, 0x1e, 0x00, 0x31,
+  0xed, 0x5b, 0x0e, 0x36, 0x2b, 0x30, 0x2a, 0x0e, 0xf4, 0xa0, 0x32, 0x3a,
+  0xde, 0x9c, 0x57, 0x21, 0x00, 0x01, 0xee, 0x00, 0x14, 0x80, 0x6a, 0x33,
+  0x84, 0x01, 0x87, 0xaa, 0x11, 0x7b, 0xf4, 0x2a, 0x12, 0x3e, 0x2b, 0x00,
+  0x63, 0x2c, 0x00, 0x07, 0x32, 0x33, 0x2a, 0x66, 0xf4, 0x20, 0x10, 0x51,
+  0x75, 0x02, 0xfd, 0x74, 0x03, 0x47, 0x03, 0x00, 0x74, 0x3a, 0x01, 0x75,
+  0x18, 0x51, 0x2a, 0x14, 0xf4, 0x01, 0x04, 0x6d, 0x20, 0x01, 0x14, 0x04,
+  0x04, 0x4e, 0x20, 0x52, 0xad, 0x60, 0x3a, 0x12, 0xf4, 0xa1, 0x2b, 0x01,
+  0x37, 0x2a, 0x03, 0x15, 0x00, 0x20, 0xc5, 0xc5, 0x13, 0x2b, 0x84, 0xc1,
+  0x7d, 0xd6, 0x10, 0x20, 0x0c, 0x21, 0x1d, 0xe7, 0x23, 0x29, 0xad, 0x60,
+  0x78, 0x00, 0x02, 0xb6, 0x2b, 0x02, 0x72, 0x5d, 0x01, 0x88, 0x03, 0x06,
+  0xca, 0x2d, 0x30, 0xc1, 0x2a, 0x16, 0xc3, 0x2a, 0x60, 0x05, 0x21, 0x9f,
+  0xb4, 0x18, 0x15, 0x14, 0x28, 0x00, 0xf6, 0x2b, 0x90, 0x39, 0x18, 0x0a,
+  0x7d, 0xd6, 0x02, 0xb4, 0x20, 0x55, 0xbc, 0x3b, 0x04, 0x71, 0x4c, 0x30,
+  0xdd, 0x86, 0xfa, 0x61, 0x07, 0x50, 0xfb, 0x47, 0x7b, 0xdd, 0x8e, 0x1b,
+  0x56, 0xf5, 0x04, 0x8e, 0xfd, 0x57, 0xdd, 0x71, 0xf6, 0xdd, 0x70, 0xf7,
+  0xdd, 0x73, 0xf8, 0xdd, 0x72, 0xf9, 0xcb, 0x7a, 0x20, 0x26, 0xca, 0x21,
+  0x00, 0x93, 0x30, 0x31, 0xed, 0x4b, 0x14, 0x78, 0x08, 0x26, 0x11, 0x04,
+  0xa2, 0x21, 0x00, 0xff, 0x0a, 0x15, 0x09, 0x01, 0x56, 0x02, 0x7c, 0x03,
+  0x20, 0xdf, 0x35, 0x1f, 0x09, 0x0a, 0x0d, 0x09, 0x00, 0xe1, 0x00, 0x01,
+  0x55, 0x17, 0x00, 0x80, 0x07, 0x92, 0xe5, 0xc5, 0xcd, 0x02, 0x61, 0xf1,
+  0xf1, 0xc1, 0xe5, 0xfe, 0x3e, 0x1a, 0xc9, 0x08, 0x01, 0x04, 0x27, 0x00,
+  0x03, 0x26, 0x00, 0x04, 0xcc, 0x03, 0x01, 0x72, 0x36, 0x21, 0x4b, 0x42,
+  0x99, 0x04, 0x11, 0xfa, 0x99, 0x04, 0x11, 0xfb, 0xc5, 0x3d, 0x68, 0xfd,
+  0xe1, 0xd5, 0x21, 0x04, 0x00, 0xaa, 0x03, 0x02, 0x00, 0x46, 0x30, 0x04,
+  0x00, 0x19, 0xd9, 0x0a, 0x00, 0x4c, 0x40, 0x10, 0xd5, 0x96, 0x05, 0x00,
+  0x2a, 0x05, 0x03, 0x21, 0x00, 0x32, 0x7e, 0xfc, 0xb5, 0x1b, 0x14, 0x10,
+  0xb4, 0x07, 0x07, 0x10, 0x0c, 0x29, 0x00, 0x13, 0x1e, 0x29, 0x00, 0x1a,
+  0x02, 0x29, 0x00, 0x82, 0xfe, 0xb5, 0x4f, 0xdd, 0x7e, 0xff, 0xb4, 0x47,
+  0xc1, 0x03, 0x20, 0x21, 0x0e, 0x2b, 0x00, 0x13, 0x0e, 0x2b, 0x00, 0x1f,
+  0x10, 0x2b, 0x00, 0x03, 0x50, 0x21, 0x1e, 0x00, 0x19, 0xeb, 0x11, 0x15,
+  0x53, 0xe5, 0xd5, 0x21, 0xa3, 0xb4, 0x20, 0x00, 0x72, 0xc1, 0x7d, 0xb1,
+  0x6f, 0x7c, 0xb0, 0x67, 0xa1, 0x12, 0x04, 0xee, 0x00, 0x04, 0x68, 0x18,
+  0x52, 0xcd, 0x15, 0x22, 0x4d, 0x2c, 0x0b, 0x00, 0x54, 0x11, 0x7b, 0xf4,
+  0xe5, 0x69, 0x6b, 0x46, 0x00, 0xef, 0x01, 0x00, 0xa7, 0x15, 0x0a, 0xf7,
+  0x01, 0x00, 0xa9, 0x09, 0x68, 0x34, 0x79, 0x17, 0x9f, 0x67, 0x69, 0x38,
+  0x01, 0x12, 0xb1, 0x40, 0x00, 0x00, 0xa3, 0x01, 0x73, 0xcb, 0x78, 0x20,
+  0x0b, 0x79, 0xd6, 0x0a, 0xb5, 0x38, 0x03, 0x8f, 0x3a, 0x01, 0x1d, 0x00,
+  0x20, 0x5b, 0x12, 0xe8, 0x0c, 0xa0, 0x06, 0x78, 0x92, 0x20, 0x02, 0xeb,
+  0xc9, 0x21, 0x7b, 0xf4, 0x4d, 0x0c, 0x31, 0x07, 0x79, 0xf5, 0x0f, 0x0b,
+  0x01, 0xdd, 0x01, 0x40, 0x7b, 0xf4, 0x09, 0xeb, 0xb8, 0x01, 0x00, 0x1b,
+  0x00, 0x1d, 0x12, 0x27, 0x2e, 0x00, 0x4c, 0x08, 0x90, 0x34, 0x2a, 0x14,
+  0xf4, 0xc9, 0xed, 0x4b, 0x6b, 0xf4, 0x4d, 0x00, 0xa1, 0x7a, 0xe6, 0x01,
+  0x57, 0xed, 0x53, 0x6b, 0xf4, 0x69, 0x60, 0xd9, 0x0e, 0xe5, 0x2a, 0x14,
+  0xf4, 0x4c, 0x79, 0xcb, 0x07, 0x9f, 0x79, 0xe6, 0xc0, 0xdd, 0x77, 0xff,
+  0x9d, 0x00, 0x33, 0x5d, 0x7c, 0x57, 0xdd, 0x02, 0x31, 0x4d, 0x63, 0x01,
+  0xc5, 0x02, 0x12, 0x09, 0x54, 0x00, 0x01, 0xa3, 0x2f, 0x20, 0xd5, 0xd5,
+  0x88, 0x2f, 0x32, 0x4d, 0xd1, 0xe1, 0x69, 0x2b, 0x47, 0xff, 0xd6, 0x80,
+  0x20, 0x2e, 0x23, 0x10, 0x4e, 0x12, 0x00, 0xa0, 0x40, 0x20, 0x11, 0xe5,
+  0xd5, 0xcd, 0x12, 0x28, 0x7d, 0xd1, 0x8b, 0x4e, 0x01, 0xf8, 0x37, 0x10,
+  0x36, 0x18, 0x00, 0x33, 0xc0, 0x20, 0x14, 0xdc, 0x2f, 0x22, 0x20, 0x0b,
+  0x0e, 0x3b, 0x00, 0x1b, 0x00, 0x00, 0x04, 0x48, 0x10, 0x19, 0xa3, 0x2d,
+  0x01, 0x25, 0x59, 0x50, 0x16, 0xf4, 0x2a, 0x14, 0xf4, 0x47, 0x07, 0x01,
+  0x68, 0x59, 0x00, 0x0e, 0x0f, 0x02, 0x98, 0x00, 0x24, 0xfb, 0x32, 0x3e,
+  0x41, 0xe0, 0xcd, 0x15, 0x22, 0xdd, 0x75, 0xfb, 0x2c, 0xca, 0x92, 0x64,
+  0xcd, 0x21, 0x21, 0x55, 0x08, 0x00, 0x00, 0x56, 0x53, 0x40, 0x7b, 0xdd,
+  0x77, 0xfc, 0x53, 0x30, 0x05, 0x02, 0x2f, 0x50, 0x72, 0xd5, 0xcd, 0x15,
+  0x22, 0x0d, 0x08, 0xc1, 0x2c, 0xca, 0x84, 0x64, 0xd5, 0xcd, 0x21, 0x21,
+  0xd1, 0xdd, 0x75, 0xff, 0x0c, 0x00, 0x00, 0x7d, 0x05, 0x41, 0x2a, 0x02,
+  0x9c, 0xe5, 0x90, 0x48, 0x02, 0x02, 0x2e, 0x25, 0x0e, 0xd5, 0xc0, 0x2f,
+  0x4d, 0xd1, 0xc3, 0x84, 0x64, 0xe0, 0x48, 0x40, 0x7d, 0x64, 0x3e, 0x7b,
+  0xdb, 0x3e, 0x50, 0x3e, 0xf4, 0xce, 0x00, 0x67, 0x80, 0x09, 0x11, 0x7a,
+  0xd8, 0x59, 0x03, 0xc0, 0x42, 0x12, 0xeb, 0x28, 0x43, 0x02, 0x5f, 0x3f,
+  0x11, 0x04, 0xc0, 0x45, 0x00, 0xd4, 0x00, 0x00, 0x31, 0x43, 0x1f, 0xff,
+  0x28, 0x00, 0x11, 0x11, 0x01, 0x9a, 0x2e, 0x01, 0x80, 0x05, 0x44, 0xff,
+  0x23, 0x36, 0x11, 0x0f, 0x58, 0x20, 0x21, 0x47, 0x16, 0x00, 0x10, 0x48,
+  0xc4, 0x01, 0x93, 0x12, 0xf4, 0xdd, 0x7e, 0xfb, 0x4f, 0x17, 0x9f, 0x47,
+  0x60, 0x08, 0x87, 0x2a, 0x12, 0xf4, 0x23, 0x23, 0xdd, 0x7e, 0xfe, 0x13,
+  0x00, 0x00, 0xd9, 0x03, 0x21, 0x18, 0xd5, 0xa1, 0x03, 0x22, 0xd1, 0xd5,
+  0x8a, 0x30, 0x01, 0x08, 0x01, 0x28, 0x36, 0xff, 0x09, 0x2c, 0x02, 0x26,
+  0x06, 0x23, 0x12, 0xf4, 0x22, 0x06, 0x00, 0xd9, 0x28, 0x01, 0xab, 0x06,
+  0x30, 0x04, 0x78, 0xb1, 0x20, 0x42, 0x01, 0x0c, 0x00, 0x01, 0xb7, 0x30,
+  0x00, 0x63, 0x08, 0x01, 0xde, 0x4b, 0x00, 0xa3, 0x01, 0x20, 0x26, 0xc5,
+  0x8d, 0x51, 0x04, 0x6a, 0x09, 0x30, 0xcd, 0xdb, 0x2a, 0x22, 0x03, 0x00,
+  0xa7, 0x3e, 0x00, 0xca, 0x04, 0x10, 0xd5, 0x2c, 0x00, 0x01, 0x18, 0x04,
+  0x04, 0xfc, 0x29, 0x30, 0xed, 0x4b, 0x16, 0x47, 0x2d, 0x01, 0xeb, 0x29,
+  0x55, 0x5e, 0xcb, 0x78, 0x28, 0x0b, 0x70, 0x04, 0x21, 0x18, 0x4f, 0x4f,
+  0x04, 0x04, 0xe9, 0x1b, 0x01, 0x1b, 0x02, 0x10, 0x3c, 0x94, 0x00, 0xb0,
+  0xaf, 0xdd, 0xbe, 0x04, 0x17, 0xe5, 0xf5, 0x33, 0xcd, 0x1b, 0x34, 0x9c,
+  0x3b, 0x13, 0x47, 0x1c, 0x00, 0xf1, 0x00, 0x20, 0xdd, 0x7e, 0x04, 0xb7,
+  0x28, 0x05, 0x11, 0x02, 0x2d, 0x18, 0x03, 0x11, 0x43, 0x30, 0xa5, 0x01,
+  0x21, 0xc5, 0xeb, 0x48, 0x36, 0x60, 0xcd, 0x8e, 0x5f, 0x2a, 0x97, 0xf4,
+  0x21, 0x02, 0x01, 0x87, 0x61, 0xf2, 0x05, 0xff, 0x64, 0x33, 0xc9, 0x2a,
+  0x16, 0xf4, 0x11, 0x20, 0x80, 0x29, 0x3f, 0xcb, 0x1c, 0xcb, 0x1d, 0xed,
+  0x52, 0x30, 0x0a, 0x58, 0x45, 0x01, 0x56, 0x07, 0x80, 0x20, 0x00, 0x22,
+  0x16, 0xf4, 0xc3, 0x72, 0x65, 0x89, 0x43, 0x00, 0x2b, 0x00, 0x02, 0x03,
+  0x15, 0x06, 0x30, 0x58, 0x02, 0xd0, 0x3a, 0x22, 0x28, 0x13, 0x72, 0x53,
+  0x02, 0x14, 0x00, 0x02, 0x66, 0x09, 0x04, 0x89, 0x1c, 0x02, 0x96, 0x2f,
+  0x01, 0xed, 0x00, 0x15, 0xc1, 0xe2, 0x1e, 0x02, 0x7c, 0x52, 0x0f, 0x3e,
+  0x05, 0x08, 0x20, 0x21, 0x87, 0x17, 0x05, 0x4f, 0xb0, 0x65, 0xf1, 0xf1,
+  0x35, 0x05, 0x01, 0x02, 0xf8, 0x01, 0x06, 0x23, 0x00, 0x01, 0x2c, 0x1c,
+  0x11, 0x12, 0x16, 0x3e, 0x00, 0xfe, 0x00, 0x19, 0x27, 0x55, 0x00, 0x02,
+  0x5b, 0x3f, 0x01, 0x19, 0x00, 0x43, 0x0e, 0x21, 0x89, 0xf4, 0xc1, 0x07,
+  0x00, 0x38, 0x00, 0x05, 0x43, 0x1f, 0x02, 0x2b, 0x08, 0x01, 0x58, 0x3e,
+  0xd0, 0x20, 0x1b, 0x2a, 0x14, 0xf4, 0x0e, 0x00, 0x7c, 0xe6, 0xf0, 0x47,
+  0x79, 0xb7, 0x14, 0x54, 0x14, 0x10, 0x82, 0x3e, 0x3c, 0xc3, 0x61, 0x67,
+  0x06, 0x02, 0x00, 0xce, 0x5c, 0x12, 0x09, 0x5a, 0x4e, 0x33, 0xc3, 0x55,
+  0x67, 0xec, 0x41, 0x15, 0x0c, 0x00, 0x02, 0x68, 0xc3, 0x64, 0x67, 0x21,
+  0x69, 0xb4, 0x32, 0x08, 0x00, 0x96, 0x3f, 0x11, 0x77, 0x87, 0x10, 0x44,
+  0x09, 0x2a, 0x14, 0xf4, 0xb7, 0x4b, 0x22, 0x6b, 0xf4, 0xea, 0x14, 0x40,
+  0x7b, 0xdd, 0xa6, 0xfe, 0xe1, 0x11, 0x22, 0xff, 0x57, 0x74, 0x5a, 0x02,
+  0xff, 0x42, 0x01, 0xfd, 0x06, 0x10, 0xc5, 0x3d, 0x04, 0x00, 0xc4, 0x33,
+  0x10, 0x06, 0xeb, 0x03, 0x02, 0x8b, 0x32, 0x04, 0xdc, 0x11, 0x0e, 0x78,
+  0x08, 0x03, 0x6c, 0x4b, 0x22, 0x18, 0x0f, 0x78, 0x06, 0x03, 0x97, 0x02,
+  0x09, 0xd8, 0x2e, 0xb1, 0x2a, 0x14, 0xf4, 0x7d, 0xe6, 0x07, 0x28, 0x18,
+  0x2a, 0x12, 0xf4, 0x9b, 0x0a, 0x01, 0x2d, 0x5a, 0x05, 0xb9, 0x00, 0x20,
+  0x39, 0x68, 0x8a, 0x3f, 0x02, 0x15, 0x3f, 0x02, 0xf6, 0x33, 0x00, 0x46,
+  0x17, 0x02, 0x87, 0x12, 0xb0, 0xed, 0x53, 0x6f, 0xf4, 0xed, 0x5b, 0x6d,
+  0xf4, 0xed, 0x53, 0x71, 0xe4, 0x04, 0x30, 0xc5, 0x11, 0x00, 0xc6, 0x58,
+  0x00, 0x10, 0x01, 0x20, 0x5d, 0xc1, 0xb6, 0x34, 0xc0, 0x74, 0xfd, 0x7c,
+  0xb3, 0x20, 0x0a, 0xdd, 0x36, 0xfe, 0xff, 0xdd, 0x36, 0x59, 0x5e, 0x04,
+  0xd9, 0x53, 0x14, 0xc5, 0x8e, 0x0b, 0x72, 0x25, 0x28, 0xf1, 0x5d, 0xc1,
+  0x16, 0x00, 0xf4, 0x00, 0x02, 0x88, 0x00, 0x31, 0x6f, 0x26, 0x00, 0x5c,
+  0x29, 0x32, 0xb3, 0x28, 0x0e, 0x16, 0x10, 0x04, 0x3f, 0x00, 0x05, 0x35,
+  0x00, 0x02, 0xde, 0x54, 0x01, 0x94, 0x00, 0x30, 0xdd, 0x7e, 0xfa, 0x5a,
+  0x0d, 0x13, 0xfb, 0xf1, 0x12, 0x07, 0x96, 0x43, 0x02, 0xf8, 0x13, 0x00,
+  0x22, 0x32, 0x01, 0x8a, 0x04, 0x06, 0x42, 0x33, 0x05, 0x03, 0x40, 0x00,
+  0xa3, 0x30, 0x70, 0x92, 0x28, 0x0e, 0xc5, 0xcd, 0x12, 0x28, 0x4e, 0x01,
+  0x01, 0x16, 0x02, 0x03, 0xc2, 0x45, 0x06, 0x5d, 0x50, 0x00, 0x15, 0x00,
+  0x10, 0x2a, 0x66, 0x34, 0x90, 0x7a, 0xe6, 0x0f, 0x57, 0xe1, 0xe5, 0x23,
+  0x66, 0x2e, 0x10, 0x02, 0xca, 0x67, 0x7b, 0xb5, 0x5f, 0x7a, 0xb4, 0x57,
+  0xe1, 0xe5, 0x73, 0x23, 0x72, 0x56, 0x3d, 0x00, 0x81, 0x00, 0x0f, 0xc8,
+  0x02, 0x04, 0x5f, 0xc5, 0xc5, 0xcd, 0x3e, 0x68, 0x01, 0x08, 0x0a, 0x0b,
+  0x22, 0x00, 0x07, 0xc9, 0x00, 0x05, 0x97, 0x00, 0x07, 0x1b, 0x45, 0x20,
+  0x05, 0x6a, 0x98, 0x00, 0x06, 0xf4, 0x4d, 0x01, 0x15, 0x33, 0x14, 0x1e,
+  0xcf, 0x00, 0x01, 0x7d, 0x06, 0x02, 0x23, 0x00, 0x05, 0x1e, 0x02, 0x53,
+  0x18, 0x0f, 0x2a, 0x16, 0xf4, 0x2f, 0x2c, 0x77, 0x00, 0x00, 0xc3, 0x05,
+  0x6a, 0x21, 0x16, 0xeb, 0x40, 0x21, 0x7e, 0xfc, 0x75, 0x35, 0x44, 0xfd,
+  0x3c, 0x28, 0x67, 0x67, 0x23, 0x0c, 0x36, 0x41, 0x11, 0x31, 0xee, 0x34,
+  0x30, 0x2b, 0xed, 0x5b, 0x7a, 0x01, 0x06, 0x6b, 0x1c, 0x01, 0x23, 0x2e,
+  0x10, 0x06, 0x23, 0x2e, 0x14, 0x28, 0xad, 0x4b, 0x02, 0x11, 0x41, 0x1a,
+  0x20, 0x5e, 0x01, 0x13, 0x2c, 0x8a, 0x4e, 0x13, 0x16, 0x8a, 0x4e, 0x00,
+  0x9f, 0x01, 0x01, 0xbe, 0x43, 0x4f, 0x7a, 0xe6, 0xf3, 0x57, 0x4b, 0x01,
+  0x1c, 0x2f, 0x07, 0x69, 0x4b, 0x01, 0x0b, 0x00, 0x21, 0x00, 0x01, 0x93,
+  0x0a, 0x12, 0xea, 0xb2, 0x52, 0x0a, 0x9f, 0x02, 0x03, 0xd1, 0x15, 0x01,
+  0x87, 0x40, 0x53, 0xff, 0xff, 0xc3, 0x84, 0x6b, 0xaa, 0x28, 0x55, 0x49,
+  0x00, 0x19, 0xcb, 0x76, 0xb3, 0x06, 0x40, 0x76, 0x6b, 0x2a, 0x14, 0xc5,
+  0x37, 0x16, 0x49, 0xde, 0x28, 0x00, 0xf5, 0x02, 0x24, 0x4b, 0x6f, 0x47,
+  0x14, 0x11, 0x08, 0x6a, 0x04, 0x20, 0xc2, 0x70, 0x28, 0x00, 0x01, 0x1c,
+  0x09, 0x03, 0x96, 0x05, 0x20, 0xca, 0x76, 0xcb, 0x3f, 0x02, 0x06, 0x0b,
+  0x16, 0x10, 0x06, 0x0b, 0x24, 0x18, 0x28, 0x91, 0x0e, 0x01, 0xa7, 0x52,
+  0x22, 0xca, 0x70, 0x26, 0x00, 0x41, 0x4b, 0x42, 0xd5, 0xc5, 0xbd, 0x4e,
+  0x00, 0xdc, 0x30, 0x12, 0xeb, 0x32, 0x0f, 0x00, 0x3a, 0x2a, 0x03, 0x92,
+  0x53, 0x00, 0xd4, 0x15, 0x11, 0xeb, 0xab, 0x33, 0x48, 0xc5, 0xeb, 0x21,
+  0x16, 0x81, 0x1e, 0x14, 0x14, 0x81, 0x1e, 0x20, 0x21, 0x10, 0x23, 0x00,
+  0x50, 0x08, 0x00, 0x39, 0xd5, 0xeb, 0x15, 0x00, 0x03, 0x29, 0x51, 0x00,
+  0x62, 0x68, 0x01, 0x0a, 0x00, 0x00, 0x58, 0x01, 0x04, 0x7a, 0x00, 0x01,
+  0x5a, 0x51, 0x03, 0x0c, 0x00, 0x03, 0x1b, 0x04, 0x00, 0x57, 0x57, 0x01,
+  0x28, 0x23, 0x06, 0x16, 0x00, 0x03, 0x20, 0x04, 0x06, 0xe6, 0x60, 0x01,
+  0x1c, 0x04, 0x07, 0x4d, 0x44, 0x01, 0x85, 0x35, 0x46, 0x0d, 0x14, 0x20,
+  0x0a, 0x1b, 0x61, 0x01, 0x8e, 0x02, 0x56, 0x06, 0x00, 0x09, 0x01, 0xdd,
+  0x65, 0x2c, 0x06, 0x15, 0x0c, 0x51, 0x00, 0x00, 0x22, 0xa9, 0xb4, 0xe9,
+  0x04, 0x00, 0x79, 0x01, 0x53, 0x23, 0x4d, 0x79, 0xe6, 0x01, 0xe8, 0x1c,
+  0x21, 0x79, 0xe6, 0x39, 0x2e, 0x01, 0x3f, 0x1d, 0xa0, 0xfa, 0xe6, 0x03,
+  0x4f, 0x06, 0x00, 0x79, 0xd6, 0x03, 0xb0, 0x2e, 0x5c, 0x30, 0xfa, 0xe6,
+  0xc0, 0x91, 0x3a, 0x55, 0xfb, 0xe6, 0xe0, 0x28, 0x0c, 0x8b, 0x00, 0x31,
+  0xc3, 0x3b, 0x6f, 0xbf, 0x08, 0x23, 0xf6, 0x2c, 0xd0, 0x45, 0x70, 0x6f,
+  0xcd, 0x21, 0x21, 0xdd, 0x75, 0xf7, 0x5e, 0x08, 0x00, 0x67, 0x58, 0x00,
+  0x60, 0x08, 0x90, 0xdd, 0x77, 0xf9, 0x2c, 0xca, 0x32, 0x6f, 0x01, 0xa9,
+  0x9f, 0x14, 0x03, 0x3e, 0x02, 0x64, 0x22, 0xa7, 0xb4, 0xfd, 0x21, 0xa7,
+  0x7b, 0x5a, 0x32, 0x25, 0x2a, 0xa9, 0x05, 0x10, 0x03, 0xe3, 0x05, 0xd3,
+  0x03, 0x47, 0x79, 0xb7, 0xc2, 0x0b, 0x6d, 0x78, 0xd6, 0x03, 0xc2, 0x0b,
+  0x6d, 0xc7, 0x05, 0x21, 0x29, 0x6f, 0x9e, 0x62, 0x83, 0x0e, 0xb4, 0xca,
+  0x29, 0x6f, 0xfd, 0x21, 0xa9, 0x3b, 0x00, 0x85, 0xca, 0x29, 0x6f, 0x2a,
+  0x14, 0xf4, 0xcb, 0x44, 0x83, 0x5a, 0x21, 0x29, 0x6f, 0x67, 0x59, 0x00,
+  0x50, 0x00, 0x00, 0xd9, 0x05, 0x09, 0x68, 0x00, 0x00, 0x3a, 0x00, 0x20,
+  0x2a, 0xa7, 0xf9, 0x14, 0x21, 0xfd, 0x19, 0xd3, 0x07, 0x36, 0xe6, 0x0f,
+  0x47, 0xe5, 0x05, 0x02, 0x5d, 0x2e, 0x22, 0xcb, 0xf8, 0x47, 0x0d, 0x00,
+  0xbb, 0x05, 0x23, 0x2a, 0xa7, 0xfb, 0x14, 0x01, 0x09, 0x00, 0x00, 0x13,
+  0x4a, 0x23, 0x7e, 0xf7, 0xff, 0x08, 0x00, 0x3a, 0x0a, 0x05, 0xd0, 0x1a,
+  0x05, 0x6f, 0x56, 0x00, 0x94, 0x1f, 0x00, 0x6d, 0x00, 0x03, 0x32, 0x13,
+  0x11, 0xc5, 0x38, 0x00, 0x00, 0x46, 0x52, 0x02, 0x82, 0x06, 0x63, 0x28,
+  0x04, 0xcb, 0x55, 0x28, 0x0c, 0x95, 0x08, 0x11, 0x0d, 0x5a, 0x52, 0x02,
+  0x6a, 0x15, 0x11, 0x29, 0x21, 0x12, 0x42, 0xb6, 0xfe, 0x28, 0x3a, 0x33,
+  0x00, 0x03, 0x30, 0x5b, 0x22, 0x20, 0x09, 0x8e, 0x42, 0x32, 0xc3, 0x29,
+  0x6f, 0x18, 0x00, 0x02, 0x6b, 0x06, 0x20, 0x20, 0x14, 0xc6, 0x00, 0x0a,
+  0xd0, 0x09, 0x0a, 0x22, 0x00, 0x23, 0x28, 0x22, 0xe5, 0x0c, 0x21, 0x48,
+  0x35, 0x4e, 0x24, 0x61, 0xc2, 0x29, 0x6f, 0x69, 0x60, 0x7e, 0x9c, 0x00,
+  0x04, 0x4b, 0x5c, 0x13, 0x71, 0x72, 0x00, 0x10, 0x69, 0x3f, 0x01, 0x35,
+  0x54, 0x28, 0x62, 0x78, 0x00, 0x41, 0xd6, 0x80, 0x20, 0x55, 0x0d, 0x00,
+  0x31, 0xe9, 0x23, 0xf1, 0x3a, 0x00, 0x01, 0x06, 0x64, 0xbb, 0x29, 0x29,
+  0x29, 0x7d, 0xc6, 0x87, 0x5f, 0x7c, 0xce, 0xaa, 0x57, 0x07, 0x58, 0x03,
+  0xf2, 0x00, 0x01, 0xe7, 0x23, 0x03, 0x5b, 0x20, 0x60, 0x09, 0xaf, 0x12,
+  0x13, 0x12, 0x13, 0x05, 0x00, 0x43, 0x03, 0x79, 0xd6, 0x0f, 0x07, 0x0c,
+  0x12, 0xbb, 0x6a, 0x62, 0x22, 0xf7, 0x77, 0xda, 0x02, 0x05, 0x38, 0x0a,
+  0x08, 0x5d, 0x03, 0x40, 0x3a, 0x14, 0xf4, 0x02, 0x90, 0x00, 0xf1, 0x09,
+  0x64, 0x28, 0x1a, 0xed, 0x5b, 0x85, 0xf4, 0xdd, 0x46, 0xf7, 0x21, 0x01,
+  0x00, 0x04, 0x18, 0x01, 0x29, 0x10, 0xfd, 0x7b, 0xb5, 0x4f, 0x7a, 0xb4,
+  0x99, 0x3a, 0x01, 0x99, 0x06, 0x71, 0x03, 0x28, 0x08, 0x2a, 0xa7, 0xb4,
+  0x01, 0x4c, 0x0a, 0x01, 0x10, 0x00, 0x00, 0xa9, 0x02, 0x76, 0x3d, 0xb0,
+  0x28, 0x20, 0x2a, 0xa7, 0xb4, 0x73, 0x31, 0x1d, 0x47, 0x50, 0x30, 0x16,
+  0x34, 0xe8, 0x00, 0x23, 0x10, 0x20, 0x41, 0x2d, 0x00, 0xd0, 0x0c, 0x40,
+  0x7e, 0x3d, 0x20, 0x1e, 0x7a, 0x00, 0x31, 0x65, 0x20, 0x17, 0x22, 0x00,
+  0x05, 0x6f, 0x61, 0x12, 0x08, 0x38, 0x2b, 0x22, 0x18, 0x22, 0x74, 0x01,
+  0x41, 0x48, 0xb7, 0x20, 0x0f, 0x28, 0x00, 0x22, 0x28, 0x08, 0x6c, 0x03,
+  0x50, 0x18, 0x09, 0xdd, 0x7e, 0xf6, 0x15, 0x02, 0x21, 0x18, 0x12, 0x40,
+  0x2c, 0x00, 0xa8, 0x0a, 0x00, 0xea, 0x00, 0x0a, 0xa6, 0x0a, 0x00, 0xd8,
+  0x07, 0x0d, 0x3d, 0x05, 0x01, 0x31, 0x03, 0x25, 0x68, 0x70, 0x6f, 0x0f,
+  0x06, 0xf0, 0x01, 0x29, 0x60, 0x70, 0xab, 0x64, 0x84, 0x1c, 0x20, 0x0c,
+  0x14, 0x20, 0x09, 0x21, 0x1f, 0x1c, 0x00, 0x03, 0xcd, 0x04, 0x00, 0xd8,
+  0x03, 0x01, 0x3f, 0x05, 0x00, 0xe0, 0x0c, 0x22, 0x28, 0x19, 0xcb, 0x09,
+  0x05, 0xe1, 0x53, 0x13, 0xc1, 0x38, 0x03, 0x20, 0x60, 0x70, 0xd4, 0x12,
+  0x53, 0xb6, 0xf8, 0xca, 0x60, 0x70, 0x03, 0x5d, 0x02, 0x62, 0x06, 0x2b,
+  0xd1, 0xd5, 0xed, 0x59, 0x11, 0xfc, 0x0e, 0x5d, 0x00, 0xaa, 0x02, 0x30,
+  0x96, 0xff, 0x28, 0x47, 0x47, 0x01, 0x45, 0x00, 0x11, 0x12, 0xe5, 0x00,
+  0x21, 0x5b, 0xc5, 0x31, 0x0b, 0x57, 0x21, 0xad, 0x9a, 0xe5, 0xd5, 0x57,
+  0x54, 0x07, 0x50, 0x54, 0x3f, 0xc1, 0x18, 0x37, 0x1e, 0x65, 0x00, 0x04,
+  0x6e, 0x11, 0x06, 0x4c, 0x06, 0x05, 0x31, 0x00, 0x04, 0xf0, 0x04, 0x11,
+  0x08, 0x37, 0x06, 0x08, 0x2d, 0x01, 0x20, 0x11, 0x00, 0x3a, 0x3c, 0x12,
+  0xd5, 0x45, 0x06, 0x02, 0x4e, 0x07, 0x13, 0xd1, 0x56, 0x1e, 0x02, 0xa2,
+  0x10, 0x66, 0x71, 0x01, 0x87, 0xaa, 0x21, 0x12, 0x63, 0x37, 0x04, 0xcb,
+  0x0c, 0x00, 0xa7, 0x4b, 0x06, 0x16, 0x11, 0x20, 0xc5, 0x01, 0xce, 0x09,
+  0x10, 0xc1, 0x1f, 0x02, 0x80, 0xb7, 0xb4, 0x28, 0x48, 0x7d, 0x3d, 0xb4,
+  0x28, 0x87, 0x43, 0x04, 0xb4, 0x4a, 0x01, 0x58, 0x1c, 0x50, 0xfe, 0x26,
+  0xdd, 0xcb, 0xff, 0x58, 0x1c, 0x00, 0x9c, 0x10, 0xf0, 0x0d, 0x28, 0x2c,
+  0x7d, 0xd6, 0x03, 0xb4, 0x28, 0x41, 0x7d, 0xd6, 0x04, 0xb4, 0x28, 0x69,
+  0xc3, 0xa4, 0x71, 0xfd, 0x7e, 0x00, 0xe6, 0xeb, 0x4f, 0x3a, 0x16, 0xf4,
+  0xe6, 0x14, 0xa9, 0x2b, 0x00, 0xa6, 0x07, 0x60, 0xad, 0x71, 0xfd, 0x6e,
+  0x00, 0x26, 0x08, 0x00, 0x00, 0xd1, 0x19, 0x00, 0x17, 0x0a, 0x00, 0xc7,
+  0x66, 0x10, 0xb3, 0x7a, 0x47, 0x42, 0x10, 0xc3, 0xad, 0x71, 0x23, 0x00,
+  0x00, 0x5c, 0x04, 0xf1, 0x01, 0x2a, 0x85, 0xf4, 0xcb, 0x60, 0x28, 0x10,
+  0x7d, 0xdd, 0xb6, 0xfe, 0x4f, 0x7c, 0xdd, 0xb6, 0xff, 0xbb, 0x02, 0x20,
+  0x18, 0x0e, 0x33, 0x00, 0x00, 0x04, 0x1e, 0x02, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x31, 0x4d, 0x3a, 0x16, 0x26, 0x3d, 0xe2, 0xec, 0x21, 0x33, 0xc1,
+  0x7d, 0x17, 0x9f, 0x67, 0x5d, 0x54, 0x2c, 0x20, 0x08, 0x24, 0x17, 0x0b,
+  0x51, 0x31, 0x21, 0x7b, 0xf4, 0x19, 0xd8, 0x0a, 0x00, 0x08, 0x0f, 0x1b,
+  0xd1, 0x12, 0x0f, 0x11, 0x09, 0x0f, 0x0f, 0x0a, 0x00, 0x11, 0x01, 0x23,
+  0x12, 0x20, 0x41, 0x00, 0xf5, 0x00, 0x50, 0xd6, 0x41, 0x7c, 0xde, 0x00,
+  0x0b, 0x46, 0x66, 0x21, 0x2a, 0x9b, 0xfd, 0x21, 0xf7, 0x2b, 0x24, 0xf4,
+  0x04, 0xc5, 0xcd, 0x4c, 0x87, 0xeb, 0xc1, 0xed, 0x53, 0x2c, 0x9b, 0x21,
+  0x27, 0x9b, 0x36, 0x0f, 0x21, 0x05, 0x9c, 0x5e, 0xb0, 0x43, 0xf0, 0x0e,
+  0xeb, 0xed, 0x53, 0x28, 0x9b, 0xed, 0x5b, 0x6a, 0x9b, 0xed, 0x53, 0x30,
+  0x9b, 0xed, 0x5b, 0x6d, 0x9b, 0xed, 0x53, 0x32, 0x9b, 0xed, 0x5b, 0x70,
+  0x9b, 0xed, 0x53, 0x34, 0x9b, 0xbe, 0x05, 0x53, 0xc5, 0xe5, 0x21, 0x24,
+  0x9b, 0x4f, 0x06, 0x05, 0xdb, 0x02, 0x80, 0x3a, 0x14, 0xf4, 0xe6, 0xef,
+  0xfd, 0x21, 0xac, 0x5e, 0x04, 0x00, 0x5b, 0x06, 0x40, 0xad, 0xb4, 0x3e,
+  0x02, 0x48, 0x21, 0x33, 0x0b, 0x2e, 0x16, 0x26, 0x06, 0x2f, 0x9f, 0x73,
+  0x6a, 0x12, 0x00, 0x2d, 0x9f, 0x73, 0xe1, 0x0f, 0x00, 0x3c, 0x6b, 0x10,
+  0x49, 0x2d, 0x50, 0x50, 0xe6, 0x0f, 0x32, 0xab, 0xb4, 0x74, 0x16, 0x11,
+  0x06, 0x6c, 0x11, 0x10, 0xf9, 0xc3, 0x03, 0x02, 0x3b, 0x20, 0x04, 0x68,
+  0x3b, 0x02, 0x1b, 0x32, 0x40, 0xcb, 0x79, 0x28, 0x34, 0x31, 0x07, 0x50,
+  0xad, 0xb4, 0x3a, 0xab, 0xb4, 0x14, 0x51, 0x00, 0xf8, 0x2f, 0xf2, 0x0c,
+  0x47, 0x3a, 0xac, 0xb4, 0xb7, 0x20, 0x0c, 0xb0, 0xca, 0x6b, 0x73, 0x21,
+  0xab, 0xb4, 0x36, 0x01, 0xc3, 0x6b, 0x73, 0x78, 0xb7, 0x28, 0x0c, 0x3a,
+  0xac, 0xb4, 0x3d, 0x6c, 0x09, 0x21, 0x9f, 0x73, 0x21, 0x01, 0x60, 0x02,
+  0xb4, 0x20, 0x14, 0xcb, 0xb9, 0x92, 0x02, 0x10, 0x71, 0x8b, 0x0b, 0x21,
+  0x6c, 0x21, 0x37, 0x4c, 0x22, 0x9f, 0x73, 0x3f, 0x5b, 0x41, 0xfd, 0x21,
+  0xab, 0xb4, 0x80, 0x62, 0x32, 0xfd, 0x21, 0xad, 0x3a, 0x61, 0x00, 0x28,
+  0x29, 0x31, 0x90, 0x20, 0x0d, 0x48, 0x00, 0x10, 0x07, 0x5a, 0x00, 0x31,
+  0x0f, 0x18, 0x4d, 0x26, 0x00, 0xb0, 0x7e, 0x00, 0xd6, 0x0e, 0x30, 0x05,
+  0xfd, 0x34, 0x00, 0x18, 0x3d, 0x87, 0x00, 0x54, 0x0e, 0x20, 0x0b, 0x21,
+  0x23, 0xb0, 0x0a, 0x10, 0x5f, 0x1e, 0x01, 0x24, 0x10, 0x67, 0x4f, 0x17,
+  0x07, 0xb9, 0x47, 0x01, 0xe3, 0x01, 0x41, 0x40, 0x1a, 0xe6, 0x0f, 0x44,
+  0x00, 0x43, 0x77, 0x00, 0x18, 0x8d, 0x7b, 0x3e, 0x42, 0x07, 0x30, 0x0b,
+  0xd5, 0xb2, 0x0d, 0x20, 0x6c, 0x21, 0x4d, 0x32, 0x63, 0xf0, 0x12, 0x21,
+  0xab, 0xb4, 0xb6, 0x7e, 0x68, 0x30, 0x7e, 0xcb, 0xff, 0x1c, 0x00, 0x10,
+  0x77, 0x2a, 0x32, 0x05, 0x89, 0x3f, 0x03, 0x02, 0x1d, 0x20, 0x66, 0x69,
+  0x0a, 0x00, 0x02, 0x27, 0x1e, 0x11, 0x66, 0xa0, 0x32, 0x03, 0x12, 0x00,
+  0x01, 0xba, 0x44, 0x00, 0x0c, 0x00, 0xb2, 0x6f, 0xf4, 0xc9, 0x2a, 0x6d,
+  0xf4, 0xc9, 0x2a, 0x71, 0xf4, 0xc9, 0x56, 0x0d, 0x17, 0x22, 0x40, 0x0c,
+  0x24, 0x4b, 0x12, 0x4b, 0x09, 0x10, 0x0c, 0x65, 0x0a, 0x81, 0x79, 0x93,
+  0x20, 0x28, 0x78, 0x92, 0x20, 0x24, 0xef, 0x4b, 0x21, 0x20, 0x11, 0xe3,
+  0x38, 0x30, 0x03, 0x03, 0x03, 0x78, 0x11, 0x01, 0xe3, 0x25, 0x00, 0x30,
+  0x00, 0x01, 0xfa, 0x0b, 0x02, 0x8b, 0x1c, 0x07, 0xe6, 0x15, 0x02, 0x5b,
+  0x00, 0x11, 0x30, 0x8d, 0x0c, 0x67, 0x4b, 0x12, 0xf4, 0x33, 0x33, 0xc5,
+  0x95, 0x0a, 0x12, 0x19, 0xb1, 0x0a, 0x05, 0xf4, 0x0b, 0x20, 0x09, 0xc5,
+  0xa0, 0x0a, 0x60, 0x7c, 0xb5, 0x28, 0x1c, 0x2a, 0x71, 0x69, 0x00, 0x12,
+  0x08, 0x58, 0x00, 0x02, 0x3b, 0x00, 0x31, 0xed, 0x43, 0x71, 0x26, 0x03,
+  0x03, 0xeb, 0x0d, 0x03, 0xe2, 0x02, 0x04, 0xa7, 0x58, 0x00, 0x33, 0x12,
+  0x50, 0x79, 0xb7, 0xb0, 0x28, 0x07, 0xfb, 0x05, 0x31, 0x0d, 0x18, 0x36,
+  0x81, 0x58, 0x00, 0xbd, 0x09, 0x03, 0x0b, 0x00, 0x00, 0x25, 0x28, 0x05,
+  0x51, 0x42, 0x00, 0xd1, 0x09, 0x03, 0xa6, 0x45, 0x35, 0x04, 0x00, 0x39,
+  0x80, 0x06, 0x17, 0x18, 0xcd, 0x0f, 0x10, 0x14, 0x73, 0x00, 0x01, 0x61,
+  0x14, 0x16, 0x08, 0x61, 0x14, 0x08, 0xc5, 0x05, 0x01, 0x7c, 0x0c, 0x00,
+  0xb3, 0x6a, 0x05, 0x33, 0x00, 0x00, 0x80, 0x03, 0x50, 0x39, 0xeb, 0xd5,
+  0xfd, 0xe1, 0xa6, 0x03, 0x00, 0xe6, 0x13, 0x24, 0xfd, 0xe5, 0x7a, 0x19,
+  0x00, 0xe4, 0x1c, 0x00, 0x36, 0x12, 0x00, 0xcd, 0x3d, 0x01, 0xec, 0x01,
+  0x56, 0x08, 0xd5, 0xcd, 0x67, 0x47, 0x3d, 0x41, 0x00, 0x44, 0x2b, 0x30,
+  0xfd, 0x2a, 0x12, 0x34, 0x19, 0x10, 0x11, 0xe1, 0x28, 0x40, 0x11, 0x10,
+  0x00, 0xd5, 0x3e, 0x00, 0x02, 0xb0, 0x13, 0x00, 0x67, 0x01, 0x00, 0xec,
+  0x1a, 0x04, 0xca, 0x13, 0x24, 0x12, 0x9c, 0x06, 0x1b, 0x00, 0xac, 0x1e,
+  0x20, 0x00, 0x00, 0x9a, 0x2e, 0x00, 0x45, 0x17, 0x50, 0x5d, 0x7c, 0xc6,
+  0xfe, 0x57, 0x9d, 0x68, 0x70, 0x38, 0x24, 0x79, 0x93, 0x5f, 0x78, 0x9a,
+  0x6e, 0x27, 0x03, 0x06, 0x36, 0x22, 0x21, 0xae, 0x6c, 0x4a, 0x26, 0xf1,
+  0xf1, 0x85, 0x17, 0x22, 0x2a, 0x1e, 0x23, 0x4a, 0x82, 0x0d, 0x79, 0x95,
+  0x4f, 0x78, 0x9c, 0x47, 0xc5, 0xad, 0x1a, 0x02, 0x6b, 0x01, 0x11, 0x1e,
+  0xcb, 0x01, 0x00, 0x79, 0x00, 0x50, 0x2a, 0x1e, 0xf4, 0x4d, 0x44, 0xd8,
+  0x72, 0x61, 0x12, 0xf4, 0xc5, 0xcd, 0x98, 0x75, 0x4e, 0x4d, 0x00, 0x3e,
+  0x00, 0x02, 0x68, 0x13, 0x20, 0x21, 0xf1, 0x7c, 0x01, 0x02, 0x0b, 0x01,
+  0x10, 0x1a, 0xe9, 0x2c, 0x14, 0xd5, 0x00, 0x11, 0x12, 0x0c, 0xe5, 0x2d,
+  0x00, 0xde, 0x03, 0x41, 0xcc, 0x78, 0x2a, 0x12, 0x5e, 0x5d, 0x03, 0x19,
+  0x28, 0x00, 0xeb, 0x52, 0xf5, 0x04, 0x91, 0x4f, 0x3e, 0x00, 0x98, 0x47,
+  0xed, 0x43, 0x12, 0xf4, 0xcd, 0xce, 0x53, 0x3a, 0x11, 0xf4, 0xb7, 0x28,
+  0x0c, 0xce, 0x68, 0x30, 0xc3, 0xcc, 0x78, 0x43, 0x49, 0x80, 0xdd, 0x36,
+  0xf2, 0x3e, 0xdd, 0x36, 0xf3, 0xa6, 0x92, 0x00, 0xb3, 0xdd, 0x71, 0xf4,
+  0xdd, 0x70, 0xf5, 0x79, 0x3c, 0x20, 0x07, 0x78, 0x08, 0x48, 0x70, 0xdd,
+  0x77, 0xf6, 0x2a, 0x16, 0xf4, 0x7d, 0xa4, 0x0a, 0x10, 0xf7, 0x1b, 0x24,
+  0xd0, 0xaf, 0x91, 0xdd, 0x77, 0xf9, 0x3e, 0x00, 0x98, 0xdd, 0x77, 0xfa,
+  0x21, 0x00, 0x11, 0x06, 0x02, 0x1d, 0x49, 0x65, 0xdd, 0x5e, 0xf2, 0xdd,
+  0x56, 0xf3, 0x72, 0x20, 0x20, 0xa0, 0x78, 0x62, 0x6a, 0x64, 0xb7, 0xca,
+  0x92, 0x78, 0x6b, 0x62, 0x04, 0x6b, 0xa0, 0x7e, 0xfb, 0x91, 0xc2, 0x92,
+  0x78, 0xdd, 0x7e, 0xfc, 0x90, 0x07, 0x00, 0x01, 0xe0, 0x48, 0x40, 0xf6,
+  0xb7, 0x20, 0x42, 0x14, 0x07, 0x01, 0x1f, 0x00, 0x11, 0xf4, 0x3b, 0x08,
+  0x14, 0xf5, 0x8b, 0x20, 0x10, 0x06, 0x8b, 0x20, 0x12, 0x28, 0x1e, 0x41,
+  0x11, 0x40, 0xfc, 0x08, 0x11, 0x41, 0x98, 0x1a, 0x00, 0x76, 0x3f, 0x00,
+  0x07, 0x1e, 0x01, 0x4c, 0x00, 0x11, 0xff, 0x4c, 0x00, 0x70, 0x7e, 0xfd,
+  0xd6, 0x07, 0xc2, 0x76, 0x78, 0x9c, 0x02, 0x43, 0x78, 0xb1, 0x28, 0x14,
+  0xdd, 0x1e, 0x02, 0xae, 0x0c, 0x21, 0xc5, 0xd5, 0xdb, 0x12, 0x02, 0x14,
+  0x00, 0x02, 0x6a, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x3c, 0x43, 0x54, 0x00,
+  0xf4, 0xfd, 0x21, 0x38, 0xda, 0x20, 0x11, 0xf8, 0xda, 0x20, 0xa0, 0xf9,
+  0xfd, 0x7e, 0x02, 0xdd, 0x77, 0xfa, 0xfd, 0x7e, 0x03, 0xfe, 0x04, 0x02,
+  0x49, 0x00, 0x11, 0x30, 0xb6, 0x1f, 0x02, 0xc4, 0x07, 0x07, 0xbf, 0x07,
+  0x02, 0x1d, 0x00, 0x11, 0x38, 0x66, 0x00, 0x10, 0x23, 0xe7, 0x3c, 0x00,
+  0x45, 0x6b, 0x00, 0x2e, 0x4b, 0x10, 0xfd, 0xaf, 0x28, 0x10, 0xfe, 0xaf,
+  0x28, 0x60, 0xff, 0x8c, 0x67, 0xdd, 0x7e, 0xf8, 0x14, 0x00, 0x10, 0xf9,
+  0x14, 0x00, 0x10, 0xfa, 0x14, 0x00, 0x32, 0xfb, 0x8c, 0x67, 0xd3, 0x10,
+  0x02, 0x37, 0x18, 0x02, 0x86, 0x00, 0x1f, 0x3c, 0x86, 0x00, 0x0f, 0x1f,
+  0x34, 0x86, 0x00, 0x09, 0x1f, 0x3c, 0x86, 0x00, 0x2c, 0xb0, 0x69, 0x60,
+  0x18, 0x56, 0x21, 0x43, 0x00, 0x19, 0x46, 0x78, 0xb7, 0x18, 0x27, 0xb0,
+  0xf8, 0xdd, 0xb6, 0xf7, 0x28, 0x0b, 0x3e, 0x00, 0xf6, 0xff, 0x4f, 0x10,
+  0x2c, 0x21, 0x18, 0x3a, 0xbc, 0x21, 0xf4, 0x02, 0xdd, 0x73, 0xf2, 0xdd,
+  0x72, 0xf3, 0xc3, 0xb9, 0x76, 0xdd, 0x7e, 0xf1, 0xb7, 0x20, 0x0b, 0x21,
+  0x0a, 0x92, 0x03, 0x40, 0x1b, 0x2a, 0x16, 0xf4, 0xc8, 0x6f, 0x01, 0xc5,
+  0x21, 0x65, 0xec, 0x49, 0xf1, 0xc3, 0x55, 0x76, 0x65, 0x02, 0x04, 0xc7,
+  0x0e, 0x40, 0x45, 0x0e, 0x00, 0xc5, 0x5b, 0x25, 0x04, 0x98, 0x4f, 0x01,
+  0xab, 0x02, 0x08, 0xd7, 0x03, 0x41, 0x57, 0xcd, 0x17, 0x4d, 0x44, 0x4f,
+  0x01, 0xb9, 0x03, 0x11, 0x49, 0x77, 0x24, 0x02, 0x2a, 0x23, 0xf1, 0x03,
+  0x36, 0x02, 0xc5, 0xc5, 0xcd, 0x3a, 0xfb, 0xf1, 0xeb, 0xc1, 0x7b, 0x3c,
+  0x20, 0x25, 0x7a, 0x3c, 0x20, 0x21, 0xdd, 0x1c, 0x01, 0x92, 0x74, 0x50,
+  0x86, 0xf1, 0xd1, 0xc1, 0xaf, 0xb3, 0x2e, 0x00, 0xe0, 0x1a, 0x02, 0x38,
+  0x22, 0x00, 0x43, 0x22, 0x03, 0xcd, 0x05, 0x00, 0xd1, 0x2a, 0x00, 0xbe,
+  0x04, 0x00, 0xdb, 0x02, 0x00, 0xb8, 0x0d, 0x00, 0x19, 0x03, 0x30, 0x22,
+  0x00, 0x19, 0x78, 0x41, 0x01, 0x3f, 0x1b, 0x20, 0xec, 0x49, 0x07, 0x15,
+  0x10, 0x7c, 0x88, 0x6f, 0x02, 0x1a, 0x00, 0x00, 0xe8, 0x39, 0x02, 0x67,
+  0x29, 0x0b, 0xf5, 0x6b, 0x01, 0x8e, 0x04, 0x05, 0xc6, 0x25, 0x72, 0x2a,
+  0x12, 0xf4, 0x7d, 0xd6, 0x01, 0x7c, 0x67, 0x0b, 0x43, 0x0b, 0x7d, 0xd6,
+  0x20, 0x0b, 0x00, 0x03, 0x16, 0x08, 0xf1, 0x02, 0xc3, 0xa9, 0x7a, 0x3e,
+  0x0f, 0xbd, 0x3e, 0x00, 0x9c, 0xe2, 0xce, 0x79, 0xee, 0x80, 0xf2, 0xd6,
+  0x79, 0x32, 0x28, 0x01, 0xa7, 0x3f, 0x00, 0xd2, 0x00, 0x60, 0x14, 0xf4,
+  0x4d, 0x44, 0x13, 0x13, 0x19, 0x24, 0x10, 0x35, 0x99, 0x00, 0xc2, 0x79,
+  0xd6, 0x09, 0xb0, 0x28, 0x79, 0x79, 0xd6, 0x13, 0xb0, 0x28, 0x73, 0x27,
+  0x53, 0x53, 0x79, 0xe6, 0x0f, 0xf5, 0x01, 0x2b, 0x46, 0x67, 0x21, 0xcb,
+  0x10, 0x3d, 0x20, 0xf9, 0x54, 0x28, 0x94, 0x18, 0x4e, 0x78, 0xb1, 0x28,
+  0x18, 0xd5, 0x01, 0x01, 0x6f, 0x0f, 0x00, 0xf6, 0x04, 0x12, 0x08, 0x06,
+  0x04, 0x26, 0x18, 0x6e, 0xe1, 0x50, 0xa2, 0x3a, 0x12, 0xf4, 0xe6, 0x0f,
+  0x6f, 0x01, 0x01, 0x00, 0x2c, 0x46, 0x00, 0xa0, 0x2d, 0x20, 0xf9, 0x79,
+  0x2f, 0x4f, 0x78, 0x2f, 0x47, 0x79, 0x11, 0x09, 0x10, 0x78, 0x11, 0x09,
+  0x01, 0x50, 0x00, 0x21, 0x11, 0x20, 0xf7, 0x05, 0x00, 0x85, 0x5d, 0x02,
+  0xa6, 0x53, 0x00, 0x87, 0x03, 0x21, 0x74, 0xff, 0x96, 0x00, 0x11, 0x0f,
+  0x96, 0x00, 0x11, 0x09, 0xf5, 0x05, 0x00, 0x2c, 0x00, 0x33, 0xcd, 0x8a,
+  0x51, 0xbb, 0x23, 0x00, 0x60, 0x01, 0x2c, 0x18, 0x03, 0x20, 0x42, 0x02,
+  0x1f, 0x01, 0x02, 0x41, 0x0a, 0x02, 0x2f, 0x0a, 0x02, 0x32, 0x13, 0x09,
+  0x47, 0x08, 0x20, 0x7e, 0xfc, 0x4c, 0x65, 0x40, 0xfd, 0xde, 0x00, 0x38,
+  0xcc, 0x5b, 0x21, 0xd6, 0x20, 0x0c, 0x00, 0x20, 0x30, 0x14, 0x0c, 0x00,
+  0x40, 0x09, 0xdd, 0xb6, 0xfd, 0x2b, 0x21, 0x77, 0xfc, 0xd6, 0x13, 0xdd,
+  0xb6, 0xfd, 0x20, 0xf5, 0x0e, 0x70, 0x96, 0x7b, 0x3e, 0x0f, 0xdd, 0xbe,
+  0xfc, 0x7c, 0x20, 0x1b, 0xfd, 0xbf, 0x26, 0x01, 0x55, 0x0f, 0x02, 0x80,
+  0x0c, 0x11, 0xfe, 0x18, 0x0e, 0x10, 0xff, 0x41, 0x64, 0x27, 0x5e, 0xfa,
+  0xa7, 0x6e, 0x42, 0xe6, 0x0f, 0x6f, 0x11, 0x09, 0x01, 0xa0, 0x23, 0xcb,
+  0x12, 0x2d, 0x20, 0xf9, 0xdd, 0x7e, 0xfc, 0x3d, 0x61, 0x00, 0x40, 0x11,
+  0x7b, 0xdd, 0xb6, 0x67, 0x14, 0x22, 0xb6, 0xff, 0xa2, 0x4e, 0x2c, 0x18,
+  0x15, 0x7e, 0x14, 0x01, 0x17, 0x00, 0x3b, 0xcd, 0x8a, 0x51, 0x80, 0x47,
+  0x01, 0xb4, 0x76, 0x03, 0xde, 0x65, 0x27, 0x21, 0x14, 0xbd, 0x4a, 0x50,
+  0xcb, 0xff, 0x7e, 0x20, 0x0f, 0xf3, 0x5c, 0x14, 0x20, 0xf3, 0x5c, 0x17,
+  0x38, 0xc6, 0x00, 0x2f, 0x07, 0x7d, 0xa2, 0x05, 0x09, 0x70, 0xdd, 0x36,
+  0xfe, 0x3e, 0xdd, 0x36, 0xff, 0xb8, 0x25, 0x06, 0xba, 0x2e, 0x23, 0xe4,
+  0x7c, 0xf9, 0x26, 0x0a, 0x2f, 0x00, 0x00, 0x12, 0x08, 0x02, 0x39, 0x08,
+  0x17, 0x15, 0xda, 0x1e, 0xa0, 0x7b, 0x91, 0xc2, 0xd3, 0x7c, 0x7a, 0x90,
+  0xc2, 0xd3, 0x7c, 0xb2, 0x39, 0x00, 0xb7, 0x01, 0x01, 0xe8, 0x26, 0x33,
+  0xd6, 0x12, 0xb0, 0x4c, 0x66, 0x11, 0x47, 0x55, 0x47, 0x11, 0x48, 0xce,
+  0x09, 0x00, 0x36, 0x00, 0x23, 0x01, 0x47, 0x9c, 0x05, 0x21, 0xfc, 0x91,
+  0xfc, 0x12, 0x44, 0x90, 0x28, 0x24, 0xeb, 0x75, 0x4d, 0x08, 0x70, 0x27,
+  0x82, 0x79, 0x93, 0x20, 0x04, 0x78, 0x92, 0x28, 0x07, 0x70, 0x54, 0x13,
+  0x32, 0x8a, 0x06, 0x00, 0xd1, 0x6b, 0x04, 0x2f, 0x22, 0x00, 0x74, 0x20,
+  0x40, 0xdd, 0x36, 0xfa, 0x01, 0x12, 0x01, 0xe0, 0x2a, 0x12, 0xf4, 0xaf,
+  0xbd, 0x9c, 0xe2, 0xcb, 0x7c, 0xee, 0x80, 0xf2, 0xd3, 0x7c, 0x4d, 0x08,
+  0x14, 0x34, 0x7d, 0x2e, 0x30, 0xd2, 0xff, 0x7b, 0xab, 0x55, 0x22, 0xff,
+  0x7b, 0x7f, 0x5f, 0x02, 0xcc, 0x41, 0x30, 0x16, 0x21, 0x03, 0x22, 0x01,
+  0x02, 0x36, 0x0d, 0x00, 0x53, 0x3c, 0x08, 0x5a, 0x1c, 0x03, 0xbb, 0x41,
+  0x00, 0x9f, 0x0d, 0x01, 0xa3, 0x5e, 0x01, 0x3b, 0x6e, 0x11, 0xd5, 0x35,
+  0x6e, 0x01, 0x20, 0x04, 0x41, 0x12, 0xf4, 0x5d, 0x54, 0x49, 0x0b, 0x03,
+  0x41, 0x2f, 0x00, 0xf0, 0x03, 0x35, 0xc3, 0xd0, 0x8f, 0x62, 0x01, 0x00,
+  0x67, 0x59, 0x23, 0x87, 0x4a, 0xc4, 0x03, 0x20, 0x21, 0xdd, 0x0e, 0x13,
+  0x18, 0xb1, 0x17, 0x11, 0x54, 0xaf, 0xb4, 0xfd, 0x21, 0xaf, 0xe6, 0x69,
+  0x46, 0x1a, 0xfd, 0x21, 0xb1, 0xcc, 0x6b, 0x15, 0xb1, 0x28, 0x21, 0x32,
+  0xc3, 0x3a, 0x7f, 0x7e, 0x25, 0x00, 0x68, 0x02, 0x60, 0xeb, 0x21, 0x69,
+  0xb4, 0x01, 0x1f, 0xd6, 0x08, 0x00, 0xce, 0x6b, 0x00, 0x3c, 0x00, 0x03,
+  0xe7, 0x0b, 0x20, 0x01, 0xb5, 0xe2, 0x11, 0x04, 0x59, 0x00, 0x42, 0xb3,
+  0xb4, 0x3a, 0xb3, 0x5c, 0x00, 0x63, 0x96, 0x00, 0x20, 0x17, 0x3a, 0xb4,
+  0x0c, 0x00, 0x34, 0x01, 0x20, 0x0b, 0x07, 0x16, 0x34, 0xc3, 0x0c, 0x7f,
+  0xdd, 0x15, 0x34, 0xfd, 0x21, 0xb5, 0x33, 0x11, 0x51, 0x0c, 0x7f, 0x2a,
+  0xaf, 0xb4, 0xcf, 0x01, 0x22, 0x2a, 0xb5, 0xd3, 0x60, 0x03, 0x7e, 0x01,
+  0x12, 0x09, 0x1b, 0x0e, 0x20, 0xc3, 0x24, 0x21, 0x00, 0x05, 0x40, 0x53,
+  0x04, 0xc2, 0x0e, 0x40, 0x24, 0x7f, 0x2a, 0x8b, 0x5c, 0x02, 0x04, 0x84,
+  0x04, 0x21, 0x24, 0x7f, 0xc0, 0x00, 0x02, 0x11, 0x66, 0x12, 0x10, 0x13,
+  0x18, 0x04, 0xfe, 0x10, 0x54, 0x24, 0x7f, 0xfd, 0x21, 0xb3, 0xe8, 0x00,
+  0x3f, 0x37, 0x2a, 0xb3, 0x4e, 0x00, 0x01, 0x01, 0xd5, 0x11, 0x31, 0xb5,
+  0xb4, 0xe5, 0x1e, 0x00, 0x01, 0xaf, 0x19, 0x71, 0x2c, 0x20, 0x04, 0x24,
+  0xca, 0x24, 0x7f, 0x11, 0x00, 0x00, 0x3a, 0x12, 0x31, 0xaf, 0xb4, 0xe5,
+  0xa3, 0x0e, 0x21, 0xc7, 0x9a, 0x29, 0x00, 0x05, 0xa7, 0x53, 0x22, 0x28,
+  0x43, 0xdf, 0x20, 0x01, 0xce, 0x53, 0x41, 0xc7, 0x9a, 0xe5, 0xc5, 0x89,
+  0x00, 0x05, 0xc5, 0x53, 0x32, 0x0a, 0x21, 0xc8, 0xb2, 0x27, 0x21, 0x18,
+  0x1b, 0x37, 0x00, 0x31, 0x18, 0x23, 0xf1, 0x21, 0x00, 0x00, 0xad, 0x17,
+  0x24, 0xdf, 0x35, 0x1c, 0x01, 0x01, 0x1b, 0x00, 0x03, 0x66, 0x00, 0x01,
+  0x08, 0x00, 0x03, 0x8d, 0x01, 0x02, 0x70, 0x02, 0x27, 0x18, 0x16, 0xc1,
+  0x00, 0x14, 0xd4, 0x92, 0x00, 0x27, 0x18, 0xca, 0xa4, 0x03, 0x0e, 0xa7,
+  0x1a, 0x01, 0xd0, 0x1d, 0x25, 0x78, 0xb1, 0xa7, 0x18, 0x23, 0xac, 0x80,
+  0x2f, 0x69, 0x07, 0xee, 0x17, 0x45, 0xc1, 0x80, 0xc1, 0xc5, 0x16, 0x58,
+  0x09, 0x06, 0x10, 0x22, 0xb7, 0x80, 0x6b, 0x19, 0x0a, 0xc6, 0x18, 0x00,
+  0xf8, 0x20, 0x26, 0xb7, 0x80, 0x83, 0x64, 0x01, 0x5d, 0x64, 0x4a, 0x80,
+  0x23, 0x36, 0x40, 0x8a, 0x18, 0x70, 0x21, 0xe7, 0x9a, 0xe5, 0x21, 0xe6,
+  0x9a, 0x48, 0x48, 0x02, 0xcb, 0x0f, 0x02, 0xe0, 0x66, 0x75, 0x13, 0x13,
+  0xcb, 0x45, 0xca, 0x6d, 0x80, 0x01, 0x59, 0x2a, 0x21, 0xe9, 0x27, 0x00,
+  0x01, 0xab, 0x4c, 0x31, 0x5e, 0x3e, 0x02, 0x3d, 0x5d, 0x20, 0xd1, 0xd5,
+  0x20, 0x15, 0x06, 0x67, 0x61, 0x07, 0x77, 0x04, 0x06, 0x53, 0x13, 0x00,
+  0x6f, 0x0f, 0x20, 0x66, 0xff, 0x40, 0x18, 0x55, 0xe6, 0x0f, 0x57, 0xcb,
+  0xf2, 0x55, 0x2b, 0x07, 0x37, 0x10, 0x0a, 0x18, 0x19, 0x10, 0x54, 0x35,
+  0x12, 0x05, 0x13, 0x00, 0x01, 0x2d, 0x22, 0x21, 0xe6, 0x9a, 0xd8, 0x01,
+  0x0a, 0xd4, 0x64, 0x62, 0xcb, 0x45, 0x20, 0x08, 0x21, 0xec, 0xde, 0x0a,
+  0x06, 0x46, 0x19, 0x13, 0x18, 0x7e, 0x04, 0x02, 0xe1, 0x64, 0x0e, 0x5d,
+  0x19, 0x0f, 0x2c, 0x1c, 0x09, 0x04, 0x40, 0x14, 0xf2, 0x00, 0x13, 0x82,
+  0x3a, 0x69, 0xb4, 0xd6, 0x2e, 0x20, 0x14, 0x3a, 0x6a, 0xb4, 0xb7, 0x20,
+  0x0e, 0xbf, 0x02, 0x01, 0xa3, 0x10, 0x35, 0xc3, 0x13, 0x82, 0x32, 0x5e,
+  0x50, 0x7b, 0x3d, 0xb2, 0x20, 0x09, 0x08, 0x29, 0x52, 0x0c, 0xf4, 0xc3,
+  0x00, 0x82, 0xc2, 0x11, 0x09, 0xe2, 0x6e, 0x20, 0x00, 0x82, 0x23, 0x04,
+  0x20, 0x55, 0x5c, 0x2c, 0x57, 0x40, 0x02, 0xb4, 0x20, 0x0d, 0x1f, 0x08,
+  0x21, 0x97, 0x17, 0x43, 0x01, 0x44, 0x20, 0x09, 0x21, 0x24, 0x39, 0x00,
+  0x05, 0xe9, 0x46, 0x20, 0x25, 0x28, 0x1c, 0x00, 0x20, 0x4d, 0xca, 0x14,
+  0x00, 0x01, 0xaa, 0x02, 0x14, 0xfd, 0xf7, 0x00, 0x02, 0x20, 0x00, 0x07,
+  0x82, 0x01, 0x30, 0x6f, 0x6a, 0x63, 0xbd, 0x0c, 0x21, 0xd1, 0xd5, 0x74,
+  0x56, 0x12, 0x19, 0x01, 0x43, 0x26, 0x5d, 0x54, 0x74, 0x56, 0x18, 0x1a,
+  0x9c, 0x01, 0x00, 0x9d, 0x01, 0x33, 0xc5, 0x21, 0xfe, 0xaa, 0x2a, 0x07,
+  0x89, 0x11, 0x03, 0x03, 0x23, 0x02, 0x8a, 0x01, 0x03, 0x13, 0x23, 0x01,
+  0xe8, 0x4b, 0x0b, 0xa0, 0x11, 0x16, 0x25, 0xad, 0x01, 0x04, 0x67, 0x01,
+  0x1c, 0x12, 0x58, 0x1d, 0x05, 0x96, 0x0d, 0x03, 0xed, 0x1b, 0x01, 0xdf,
+  0x0f, 0x2f, 0x53, 0x83, 0xf3, 0x12, 0x04, 0x20, 0x53, 0x83, 0x98, 0x04,
+  0x07, 0xff, 0x17, 0x02, 0x09, 0x1c, 0x14, 0x0b, 0x09, 0x12, 0x35, 0xc3,
+  0x53, 0x83, 0x14, 0x13, 0x51, 0x60, 0x28, 0x09, 0x21, 0x0f, 0x2e, 0x01,
+  0x23, 0x42, 0x83, 0x89, 0x00, 0x0c, 0x6b, 0x01, 0x24, 0x42, 0x83, 0x13,
+  0x4d, 0x01, 0x61, 0x0b, 0x10, 0xd5, 0x44, 0x79, 0x01, 0x29, 0x01, 0x11,
+  0x20, 0x09, 0x0a, 0x02, 0xd5, 0x05, 0x70, 0x03, 0x21, 0x02, 0x00, 0x7d,
+  0xc5, 0xd5, 0xff, 0x2b, 0x01, 0x27, 0x4d, 0x00, 0xd2, 0x0c, 0x04, 0xc2,
+  0x13, 0x10, 0x60, 0x35, 0x00, 0x21, 0x48, 0x29, 0x42, 0x29, 0x50, 0x20,
+  0x19, 0xe1, 0xe5, 0xc5, 0xbb, 0x2e, 0x30, 0xc1, 0x7e, 0x3d, 0xf6, 0x34,
+  0x03, 0x95, 0x36, 0x42, 0x3d, 0xb4, 0x20, 0x08, 0xef, 0x01, 0x80, 0x18,
+  0x32, 0xc5, 0xd5, 0xcd, 0xdf, 0x35, 0xd1, 0xe5, 0x22, 0x00, 0x59, 0x40,
+  0x01, 0x9f, 0x01, 0x43, 0xd5, 0xcd, 0x94, 0x29, 0xa7, 0x43, 0x1b, 0x13,
+  0x2f, 0x01, 0x00, 0x24, 0x80, 0x0d, 0x42, 0x01, 0x04, 0x2e, 0x01, 0x10,
+  0x3b, 0x1c, 0x10, 0x11, 0x80, 0x00, 0x07, 0x09, 0x21, 0x5c, 0x08, 0x6c,
+  0x08, 0x21, 0xdb, 0x84, 0xe1, 0x14, 0xa6, 0x81, 0x5f, 0x16, 0x00, 0x7b,
+  0xd6, 0x81, 0xb2, 0x20, 0x64, 0xad, 0x4d, 0x14, 0x59, 0xad, 0x4d, 0x1f,
+  0x49, 0xb8, 0x6d, 0x01, 0x13, 0x34, 0x75, 0x39, 0x10, 0x2c, 0xdf, 0x00,
+  0x03, 0x6a, 0x50, 0x23, 0x20, 0x1f, 0x4d, 0x58, 0x01, 0x25, 0x5c, 0x11,
+  0x19, 0x0e, 0x49, 0x12, 0x0c, 0xd9, 0x00, 0x02, 0x6c, 0x00, 0x02, 0xe3,
+  0x4d, 0x16, 0x9f, 0x64, 0x00, 0x1f, 0x68, 0x5b, 0x00, 0x01, 0x13, 0x4c,
+  0x5b, 0x00, 0x11, 0x44, 0x68, 0x73, 0x13, 0x2a, 0xa4, 0x62, 0x35, 0xcb,
+  0x00, 0xb6, 0x3c, 0x1d, 0x00, 0x3f, 0x0c, 0x70, 0xcb, 0xfe, 0x46, 0x28,
+  0x07, 0xcb, 0xf7, 0xda, 0x10, 0x30, 0x1b, 0xcb, 0xb7, 0x07, 0x00, 0x14,
+  0x14, 0xb1, 0x00, 0x15, 0x0b, 0x74, 0x00, 0x22, 0x18, 0x7b, 0x73, 0x00,
+  0x11, 0x90, 0xc5, 0x01, 0x14, 0xd2, 0xdc, 0x29, 0x01, 0x66, 0x27, 0x12,
+  0x08, 0x5f, 0x01, 0x20, 0x36, 0x00, 0xca, 0x59, 0x00, 0x44, 0x17, 0x30,
+  0xb7, 0x28, 0x35, 0x18, 0x37, 0x01, 0xc6, 0x2f, 0x21, 0xfc, 0x5f, 0xd9,
+  0x27, 0x02, 0xfe, 0x15, 0x32, 0x6f, 0x26, 0x00, 0x05, 0x1c, 0x01, 0x77,
+  0x07, 0x35, 0xcb, 0x43, 0x28, 0x3b, 0x00, 0x01, 0x46, 0x20, 0x05, 0xb8,
+  0x03, 0x03, 0xd6, 0x14, 0x45, 0x3e, 0xff, 0x02, 0x03, 0x40, 0x4a, 0x34,
+  0x01, 0xff, 0xff, 0x18, 0x1b, 0x02, 0xf9, 0x23, 0x0a, 0x9c, 0x1a, 0x01,
+  0x3d, 0x22, 0x02, 0xc6, 0x1a, 0x20, 0xd5, 0xd5, 0x7d, 0x02, 0x11, 0xd1,
+  0x97, 0x02, 0x12, 0x08, 0x97, 0x02, 0x23, 0x18, 0x2d, 0xbc, 0x2e, 0x01,
+  0xb3, 0x51, 0x00, 0xd9, 0x4a, 0x00, 0x7f, 0x02, 0x02, 0xb4, 0x70, 0x15,
+  0x20, 0x23, 0x16, 0x00, 0x73, 0x1a, 0x22, 0x83, 0xf1, 0x09, 0x2c, 0x01,
+  0x24, 0x1b, 0x06, 0xae, 0x1f, 0x02, 0x31, 0x03, 0x04, 0x72, 0x24, 0x00,
+  0xa5, 0x14, 0x30, 0x03, 0xcd, 0xdf, 0x21, 0x51, 0x00, 0x0b, 0x00, 0x10,
+  0x06, 0x91, 0x14, 0x52, 0x20, 0x0b, 0x21, 0x11, 0x9b, 0x55, 0x2e, 0x21,
+  0x00, 0xf7, 0xec, 0x0b, 0x76, 0x02, 0xb4, 0x20, 0x03, 0xcd, 0x00, 0xf7,
+  0x10, 0x1a, 0x00, 0x93, 0x08, 0x73, 0x2a, 0x12, 0xf4, 0xcb, 0x7c, 0x28,
+  0x0d, 0xcb, 0x00, 0x02, 0xb2, 0x00, 0x32, 0xfd, 0x21, 0x42, 0x96, 0x5a,
+  0x11, 0x16, 0xc3, 0x23, 0x41, 0xeb, 0x7b, 0xd6, 0xec, 0x27, 0x71, 0xf0,
+  0x0b, 0x7f, 0x30, 0x03, 0x11, 0xec, 0xff, 0x3e, 0x13, 0xbb, 0x3e, 0x00,
+  0x9a, 0xe2, 0xe4, 0x85, 0xee, 0x80, 0xf2, 0xea, 0x85, 0x11, 0x13, 0x00,
+  0xfd, 0x73, 0x00, 0x0a, 0x5d, 0x20, 0x4b, 0x42, 0x87, 0x5d, 0x00, 0x04,
+  0x00, 0x22, 0x3e, 0x32, 0xe1, 0x09, 0x00, 0xa2, 0x0c, 0x31, 0x14, 0x00,
+  0x19, 0x0c, 0x21, 0x21, 0x3a, 0x6a, 0x52, 0x2c, 0x02, 0xd1, 0x74, 0x23,
+  0x4b, 0x60, 0xd1, 0x3d, 0x11, 0x19, 0x17, 0x33, 0x70, 0x11, 0xdd, 0x5e,
+  0x08, 0xdd, 0x56, 0x09, 0xee, 0x22, 0x20, 0xe5, 0x45, 0x63, 0x1b, 0x13,
+  0x0f, 0x11, 0x00, 0x05, 0x4c, 0x11, 0x01, 0x9c, 0x28, 0x03, 0x13, 0x32,
+  0x04, 0x4b, 0x00, 0x10, 0x7e, 0x54, 0x1d, 0x00, 0x95, 0x3e, 0x10, 0x78,
+  0x93, 0x3e, 0x3f, 0x2a, 0x60, 0xf4, 0x4c, 0x00, 0x0e, 0x01, 0x60, 0x11,
+  0x06, 0x4c, 0x00, 0x70, 0x01, 0x0d, 0xb5, 0xfd, 0x21, 0xc3, 0x9b, 0xb4,
+  0x3d, 0x65, 0x34, 0x00, 0x6b, 0x26, 0x00, 0x09, 0xcf, 0x20, 0x70, 0x77,
+  0x3a, 0xc3, 0x9b, 0x32, 0x14, 0xb5, 0x6e, 0x00, 0x03, 0x84, 0x1e, 0x11,
+  0x0e, 0xc8, 0x6a, 0x01, 0x7a, 0x5f, 0x42, 0xd5, 0x21, 0x1a, 0x9b, 0x15,
+  0x5f, 0x01, 0x3e, 0x00, 0x10, 0x4e, 0x3e, 0x00, 0xb3, 0x3e, 0x0d, 0x81,
+  0x4f, 0x3e, 0xb5, 0xce, 0x00, 0x47, 0x1a, 0x02, 0xb8, 0x35, 0x94, 0xc3,
+  0x9b, 0xb7, 0x20, 0x05, 0x21, 0x0c, 0x00, 0x18, 0xa6, 0x61, 0x00, 0x42,
+  0x00, 0xc0, 0x21, 0xc3, 0x9b, 0x35, 0xfd, 0x21, 0x0d, 0xb5, 0xed, 0x4b,
+  0xc3, 0x9b, 0x66, 0x16, 0x53, 0xfd, 0x7e, 0x00, 0x06, 0x00, 0x9f, 0x67,
+  0x00, 0xed, 0x42, 0x01, 0xd8, 0x3a, 0x01, 0x23, 0x83, 0x10, 0xe0, 0x23,
+  0x83, 0x33, 0x04, 0x21, 0x0c, 0xa9, 0x7c, 0xf5, 0x02, 0x14, 0xb5, 0x4e,
+  0x06, 0x00, 0x21, 0xc3, 0x9b, 0x5e, 0x16, 0x00, 0x79, 0x93, 0x4f, 0x78,
+  0x9a, 0x47, 0x40, 0x74, 0x03, 0x61, 0x1e, 0x00, 0x1f, 0x22, 0x51, 0x17,
+  0xdd, 0x7e, 0x04, 0x3d, 0x06, 0x00, 0x40, 0xd6, 0x02, 0x28, 0x39, 0x07,
+  0x00, 0x60, 0x03, 0x28, 0x61, 0xc3, 0x67, 0x88, 0x9e, 0x14, 0x20, 0x70,
+  0x88, 0xbf, 0x4e, 0x00, 0x79, 0x01, 0x35, 0x2a, 0x64, 0xf4, 0x58, 0x01,
+  0x04, 0xd2, 0x27, 0x51, 0x70, 0x88, 0x2a, 0x62, 0xf4, 0xd8, 0x55, 0x70,
+  0xc3, 0x70, 0x88, 0x21, 0x6a, 0xf4, 0x46, 0x37, 0x5b, 0xb1, 0x21, 0x62,
+  0xf4, 0x4e, 0x23, 0x66, 0xcb, 0x40, 0x28, 0x0f, 0x69, 0xf3, 0x84, 0x40,
+  0xd5, 0xcd, 0x35, 0x46, 0x51, 0x01, 0x41, 0x08, 0x69, 0xe5, 0xd5, 0xfe,
+  0x11, 0x32, 0x2a, 0x62, 0xf4, 0x3a, 0x00, 0x20, 0x3e, 0x49, 0x28, 0x0e,
+  0x40, 0x30, 0x06, 0x21, 0x49, 0xc2, 0x28, 0x09, 0xc8, 0x5b, 0x00, 0x6f,
+  0x4f, 0x10, 0x59, 0xe2, 0x6b, 0x33, 0x7b, 0xdd, 0x86, 0xab, 0x27, 0x33,
+  0x7d, 0xdd, 0x8e, 0x1c, 0x63, 0x90, 0x3e, 0x47, 0xbb, 0x3e, 0x04, 0x9a,
+  0x3e, 0x00, 0x9d, 0x66, 0x0e, 0x60, 0x34, 0x88, 0xee, 0x80, 0xf2, 0x3c,
+  0xad, 0x00, 0x20, 0x18, 0x34, 0xcd, 0x01, 0x41, 0x7e, 0xfc, 0xc6, 0x3e,
+  0xfb, 0x4a, 0x21, 0xa6, 0x57, 0x6d, 0x39, 0x04, 0xe5, 0x29, 0x00, 0xfd,
+  0x03, 0x14, 0x13, 0xaf, 0x00, 0x0f, 0xe4, 0x4f, 0x00, 0x01, 0x0b, 0x01,
+  0x11, 0x16, 0x0b, 0x01, 0x12, 0x15, 0x0b, 0x01, 0x00, 0x60, 0x32, 0xbb,
+  0xd6, 0x03, 0x28, 0x2e, 0x18, 0x37, 0x2a, 0x62, 0xf4, 0x18, 0x3b, 0x09,
+  0x01, 0x04, 0xdb, 0x28, 0x01, 0x59, 0x00, 0x15, 0x1e, 0x59, 0x00, 0x16,
+  0x14, 0xd5, 0x0f, 0x07, 0x64, 0x00, 0x04, 0xc1, 0x43, 0x36, 0x03, 0x28,
+  0x0a, 0x33, 0x7e, 0x21, 0x21, 0x05, 0x19, 0x23, 0x32, 0xfd, 0x21, 0x03,
+  0x3e, 0x02, 0x60, 0x3d, 0xfd, 0xb6, 0x01, 0x28, 0x0c, 0xde, 0x15, 0x10,
+  0x02, 0x0a, 0x00, 0x72, 0x0e, 0x18, 0x18, 0xc5, 0x2a, 0xf9, 0x9b, 0xe8,
+  0x2a, 0x53, 0x18, 0x16, 0xc5, 0x21, 0x49, 0xf4, 0x2a, 0x13, 0x18, 0xdb,
+  0x5e, 0x04, 0x9f, 0x0f, 0x04, 0xa3, 0x0f, 0x60, 0x01, 0x99, 0xf4, 0x3a,
+  0xb9, 0xf4, 0x48, 0x3c, 0x20, 0x09, 0xeb, 0xa2, 0x13, 0x26, 0x30, 0x21,
+  0x06, 0x0e, 0x01, 0xb1, 0x72, 0x00, 0x4c, 0x05, 0x13, 0xe6, 0x4c, 0x05,
+  0x20, 0xde, 0x21, 0xa5, 0x54, 0x08, 0x95, 0x53, 0x07, 0x6e, 0x38, 0x1a,
+  0x5e, 0x6e, 0x38, 0x11, 0x48, 0x6e, 0x38, 0x15, 0x42, 0xce, 0x12, 0x01,
+  0x91, 0x20, 0x07, 0x97, 0x12, 0x02, 0x5a, 0x00, 0x00, 0x32, 0x49, 0x00,
+  0xb6, 0x12, 0x35, 0x1a, 0x69, 0x60, 0x5a, 0x0d, 0x82, 0x06, 0x91, 0x20,
+  0x0b, 0xdd, 0x7e, 0x07, 0x90, 0xcc, 0x24, 0x12, 0x0a, 0xa3, 0x38, 0x10,
+  0x98, 0x30, 0x38, 0x03, 0x57, 0x15, 0x1e, 0xf3, 0x40, 0x53, 0x60, 0xdd,
+  0x75, 0xf5, 0xdd, 0x74, 0xf6, 0x56, 0x3b, 0x00, 0x68, 0x04, 0x00, 0x30,
+  0x48, 0x14, 0x15, 0x8e, 0x13, 0x40, 0xf8, 0xdd, 0x71, 0xf9, 0x26, 0x76,
+  0x01, 0xfa, 0x79, 0x01, 0xed, 0x2c, 0x11, 0xfd, 0xed, 0x2c, 0x13, 0xfe,
+  0x9a, 0x52, 0x70, 0x56, 0x28, 0x1a, 0xdd, 0xcb, 0xf8, 0x46, 0xdd, 0x67,
+  0x01, 0x58, 0x3b, 0x03, 0x57, 0x3a, 0x00, 0xe1, 0x2b, 0x22, 0x33, 0x8b,
+  0x24, 0x00, 0x01, 0x54, 0x0c, 0x31, 0x7a, 0xb3, 0x28, 0x43, 0x4f, 0x04,
+  0xc9, 0x00, 0x11, 0xf3, 0xc9, 0x00, 0x51, 0xf4, 0x7b, 0xdd, 0x96, 0xf3,
+  0x36, 0x16, 0x52, 0xf4, 0x28, 0x09, 0x69, 0x60, 0xca, 0x4a, 0x02, 0x3c,
+  0x00, 0x02, 0x38, 0x55, 0x01, 0x2c, 0x63, 0x00, 0x85, 0x1c, 0x35, 0xe6,
+  0x0f, 0x47, 0x2a, 0x1c, 0x60, 0x7d, 0xa3, 0x4f, 0x7c, 0xa2, 0xb1, 0x92,
+  0x39, 0x30, 0xff, 0x87, 0x4f, 0x6b, 0x2f, 0x04, 0xbd, 0x52, 0x21, 0x20,
+  0x04, 0x52, 0x38, 0x30, 0x7e, 0xf7, 0xb7, 0x2f, 0x68, 0x42, 0x08, 0xb7,
+  0x20, 0x25, 0x0a, 0x2e, 0x23, 0x11, 0x47, 0x63, 0x0e, 0x00, 0xce, 0x52,
+  0x03, 0xc4, 0x3c, 0x51, 0xc5, 0xd5, 0xcd, 0x74, 0x89, 0x4f, 0x02, 0x03,
+  0xdb, 0x85, 0x41, 0x2e, 0x01, 0x18, 0x29, 0x3b, 0x00, 0x00, 0x70, 0x70,
+  0x12, 0x1f, 0x09, 0x01, 0x00, 0xbc, 0x25, 0x02, 0x73, 0x35, 0x00, 0x2b,
+  0x1c, 0x34, 0xca, 0x35, 0x8a, 0x64, 0x47, 0x04, 0xc3, 0x02, 0x01, 0xa8,
+  0x59, 0x01, 0x4c, 0x4f, 0x24, 0x3e, 0x15, 0xeb, 0x48, 0x20, 0xea, 0x89,
+  0x4f, 0x4f, 0x64, 0xb7, 0x20, 0x03, 0x6f, 0x18, 0x15, 0x0c, 0x7e, 0x04,
+  0xdd, 0x11, 0x20, 0x22, 0x97, 0x3d, 0x00, 0x02, 0xfe, 0x02, 0x52, 0x4e,
+  0x05, 0xdd, 0x46, 0x06, 0x00, 0x64, 0x31, 0x23, 0xcb, 0x46, 0x18, 0x7f,
+  0x11, 0x30, 0x13, 0x47, 0x2f, 0x3e, 0x16, 0x4b, 0x00, 0x19, 0x53, 0x3e,
+  0x0d, 0xfd, 0x21, 0x05, 0x8c, 0x04, 0x61, 0x00, 0xfd, 0x9e, 0x01, 0x38,
+  0x54, 0xd4, 0x18, 0xa0, 0x21, 0xdc, 0x8b, 0x09, 0x09, 0x09, 0xe9, 0xc3,
+  0x24, 0x8c, 0x03, 0x00, 0x14, 0x06, 0x03, 0x00, 0x08, 0x0c, 0x00, 0x05,
+  0x0f, 0x00, 0x01, 0x06, 0x00, 0x01, 0xbe, 0x55, 0x03, 0xba, 0x42, 0x00,
+  0x82, 0x00, 0x01, 0xb3, 0x42, 0x04, 0x84, 0x00, 0x05, 0x02, 0x64, 0x00,
+  0x22, 0x23, 0x00, 0xab, 0x2f, 0x01, 0x8a, 0x30, 0x02, 0x30, 0x13, 0x00,
+  0x5e, 0x01, 0x06, 0x7b, 0x11, 0x02, 0x40, 0x2e, 0x02, 0xc4, 0x07, 0x40,
+  0xdd, 0x7e, 0xf8, 0x93, 0xf3, 0x62, 0x22, 0xf9, 0x92, 0x96, 0x19, 0x24,
+  0xeb, 0x8c, 0x3a, 0x3f, 0x36, 0x1e, 0x3e, 0x16, 0xfc, 0x02, 0x1c, 0x61,
+  0x75, 0x15, 0x00, 0x0b, 0x5a, 0x30, 0xfe, 0x20, 0x3d, 0xa1, 0x0f, 0x43,
+  0x96, 0xff, 0x20, 0x35, 0x48, 0x53, 0x13, 0x47, 0x0f, 0x02, 0x11, 0xfa,
+  0x58, 0x18, 0x11, 0xfb, 0x4c, 0x24, 0x11, 0x05, 0x0b, 0x07, 0x01, 0x11,
+  0x04, 0x40, 0x24, 0xdd, 0x7e, 0xf8, 0x0b, 0x76, 0x10, 0xf9, 0xf8, 0x07,
+  0x23, 0x18, 0x16, 0x43, 0x14, 0x00, 0xcb, 0x59, 0x2b, 0x18, 0x95, 0x3e,
+  0x2c, 0x55, 0x12, 0x28, 0x4d, 0xcb, 0x41, 0x0c, 0x08, 0x61, 0xcb, 0x7c,
+  0x20, 0x0e, 0x3e, 0x10, 0x40, 0x13, 0x76, 0x0e, 0x8d, 0xee, 0x80, 0xf2,
+  0x1b, 0x8d, 0xed, 0x03, 0x70, 0x7c, 0xb5, 0x28, 0x1a, 0x29, 0x4d, 0x44,
+  0xcf, 0x0a, 0x25, 0x01, 0x99, 0x73, 0x31, 0x04, 0x2d, 0x17, 0x52, 0x3a,
+  0x12, 0xf4, 0x32, 0xb9, 0x53, 0x17, 0x20, 0x4b, 0x14, 0x0a, 0x04, 0x50,
+  0x5f, 0x16, 0x00, 0x78, 0xb1, 0xfa, 0x2a, 0x00, 0xc6, 0x07, 0x50, 0x93,
+  0x7c, 0x9a, 0xe2, 0x5f, 0x51, 0x00, 0x17, 0x6c, 0x51, 0x00, 0x73, 0xeb,
+  0x29, 0xe5, 0xc5, 0x21, 0x99, 0xf4, 0xd6, 0x05, 0x23, 0xcb, 0x7c, 0x49,
+  0x00, 0x01, 0x45, 0x04, 0x03, 0x8d, 0x00, 0x43, 0x0b, 0x7d, 0xd6, 0x09,
+  0xe1, 0x13, 0x07, 0x77, 0x04, 0x31, 0x01, 0xbb, 0xf4, 0x3e, 0x49, 0x00,
+  0xe4, 0x22, 0x07, 0x57, 0x4e, 0x05, 0xf2, 0x21, 0x01, 0x3c, 0x00, 0x55,
+  0xc2, 0xae, 0x8e, 0x11, 0x09, 0x4f, 0x28, 0x50, 0xd2, 0xae, 0x8e, 0x01,
+  0x17, 0xb2, 0x09, 0x03, 0xed, 0x18, 0x09, 0x1b, 0x2e, 0x40, 0xb7, 0x8e,
+  0x01, 0xbb, 0x53, 0x08, 0x01, 0x4c, 0x1d, 0x36, 0x11, 0x17, 0xb6, 0xde,
+  0x2d, 0x36, 0x11, 0x1b, 0xb6, 0x79, 0x41, 0x10, 0xd1, 0x4c, 0x13, 0x21,
+  0x96, 0xf6, 0x8c, 0x5b, 0x10, 0xf7, 0x43, 0x1e, 0x11, 0x9e, 0xca, 0x40,
+  0x42, 0x9e, 0xf9, 0x38, 0x77, 0xd1, 0x4d, 0x00, 0xcc, 0x09, 0x00, 0xee,
+  0x2d, 0x01, 0x0c, 0x16, 0x04, 0x26, 0x35, 0x50, 0x7d, 0xdd, 0x9e, 0xf8,
+  0x7c, 0x25, 0x00, 0x14, 0x12, 0xb9, 0x60, 0x50, 0x7d, 0xdd, 0x9e, 0xfc,
+  0x7c, 0x4d, 0x13, 0x19, 0x0e, 0x31, 0x19, 0x20, 0x3b, 0xd5, 0x7b, 0x00,
+  0x06, 0x6e, 0x00, 0x05, 0xe5, 0x41, 0x89, 0xed, 0x4b, 0x1b, 0xb6, 0xed,
+  0x5b, 0x1d, 0xb6, 0x1e, 0x2e, 0x0f, 0x0a, 0x2e, 0x01, 0x06, 0x21, 0x13,
+  0x0c, 0x8b, 0x02, 0x05, 0xa9, 0x13, 0x02, 0x8f, 0x15, 0x22, 0x20, 0x0e,
+  0x41, 0x18, 0x10, 0xf8, 0x1d, 0x00, 0x38, 0xf9, 0x18, 0x30, 0x7e, 0x05,
+  0x19, 0x23, 0x04, 0x0b, 0x01, 0x10, 0x18, 0x11, 0x09, 0x9b, 0x38, 0x42,
+  0x03, 0x33, 0x33, 0xd5, 0x43, 0x05, 0x12, 0xd3, 0x2f, 0x12, 0x22, 0x20,
+  0x0c, 0x3d, 0x12, 0x00, 0x43, 0x01, 0x43, 0xcb, 0x8f, 0xe1, 0xe5, 0x5b,
+  0x04, 0x03, 0x7c, 0x00, 0x02, 0x3d, 0x11, 0x54, 0x71, 0x78, 0x92, 0x20,
+  0x6d, 0x7f, 0x6a, 0x01, 0x66, 0x7c, 0x04, 0x49, 0x17, 0x08, 0x74, 0x00,
+  0x17, 0x31, 0xf2, 0x05, 0x30, 0xfc, 0x91, 0x20, 0x1f, 0x83, 0x55, 0x90,
+  0x20, 0x15, 0x6b, 0x62, 0xca, 0x05, 0xa2, 0xfa, 0x91, 0x20, 0x27, 0xdd,
+  0x7e, 0xfb, 0x90, 0x20, 0x21, 0x82, 0x00, 0x18, 0xc5, 0x8d, 0x41, 0x30,
+  0xdd, 0x7e, 0xfc, 0xed, 0x02, 0x11, 0xfd, 0xed, 0x02, 0x06, 0x3c, 0x1b,
+  0x06, 0x14, 0x01, 0x02, 0xed, 0x00, 0x02, 0x77, 0x00, 0x00, 0x84, 0x00,
+  0x41, 0x5e, 0x23, 0x56, 0x01, 0x7e, 0x00, 0x7b, 0x79, 0x96, 0x78, 0x23,
+  0x9e, 0x30, 0x49, 0x52, 0x06, 0x07, 0xbf, 0x1b, 0x12, 0x1b, 0x33, 0x64,
+  0x01, 0x1b, 0x00, 0x14, 0x48, 0x1b, 0x00, 0x11, 0x11, 0x92, 0x54, 0x07,
+  0x04, 0x2d, 0x10, 0x23, 0xc7, 0x1d, 0xa0, 0x4d, 0x44, 0x18, 0xad, 0xc1,
+  0xc5, 0x21, 0x40, 0x00, 0x09, 0x9e, 0x01, 0x11, 0x47, 0x07, 0x00, 0x14,
+  0x03, 0x19, 0x55, 0x09, 0x28, 0x33, 0x00, 0x7c, 0x00, 0x07, 0xa2, 0x15,
+  0x25, 0x59, 0x50, 0x08, 0x01, 0x13, 0x3d, 0x7c, 0x01, 0x04, 0x17, 0x27,
+  0x00, 0x6e, 0x5e, 0x01, 0xbb, 0x15, 0x04, 0xb2, 0x20, 0x12, 0x13, 0xb2,
+  0x20, 0x21, 0x20, 0x0b, 0x71, 0x6c, 0x61, 0x47, 0xfd, 0x66, 0x48, 0x18,
+  0x12, 0x12, 0x01, 0x45, 0x4b, 0x42, 0x18, 0xb9, 0x8e, 0x01, 0x04, 0x6c,
+  0x00, 0x00, 0xb9, 0x05, 0x80, 0x79, 0xd6, 0x3e, 0x4f, 0x78, 0xde, 0xa6,
+  0x47, 0xc0, 0x07, 0x11, 0xc5, 0xfb, 0x79, 0x04, 0xa7, 0x49, 0x61, 0x69,
+  0x60, 0x3e, 0x03, 0xcb, 0x3c, 0x28, 0x6a, 0x55, 0x19, 0x79, 0xe6, 0x07,
+  0x47, 0xaf, 0x4b, 0x23, 0x7e, 0xb1, 0x1e, 0x6f, 0x0f, 0x40, 0x00, 0x17,
+  0x19, 0xeb, 0x41, 0x00, 0x65, 0x79, 0x2f, 0x4f, 0x1a, 0xa1, 0x12, 0x10,
+  0x29, 0x03, 0x5c, 0x15, 0x08, 0x6c, 0x4b, 0x62, 0x11, 0x00, 0x00, 0x21,
+  0xf9, 0x9b, 0xf5, 0x00, 0x41, 0x47, 0x6b, 0x62, 0x06, 0x49, 0x00, 0x8b,
+  0x10, 0xfa, 0xc1, 0xc5, 0x09, 0x7b, 0xe6, 0x07, 0x81, 0x17, 0x12, 0x6e,
+  0x92, 0x4e, 0x45, 0xa0, 0xb1, 0x28, 0x0d, 0x42, 0x10, 0x00, 0x57, 0x47,
+  0x09, 0x55, 0x43, 0x35, 0x13, 0x18, 0xaf, 0x62, 0x01, 0x03, 0xbb, 0x0a,
+  0x48, 0x40, 0x00, 0x09, 0xeb, 0xc2, 0x00, 0x00, 0xbd, 0x02, 0x03, 0xc3,
+  0x00, 0x28, 0xd1, 0x7d, 0xaf, 0x00, 0x30, 0x7d, 0xdd, 0xa6, 0xc6, 0x07,
+  0x30, 0x45, 0xcb, 0x38, 0x02, 0x00, 0x01, 0xd9, 0x07, 0x41, 0xff, 0x78,
+  0x2f, 0x47, 0x99, 0x0b, 0x20, 0x0b, 0x69, 0x16, 0x70, 0xce, 0xa0, 0x77,
+  0xdd, 0xb6, 0xfe, 0x77, 0x13, 0x13, 0xdd, 0xcb, 0xff, 0x4e, 0x13, 0x00,
+  0x19, 0x56, 0x13, 0x00, 0x09, 0xda, 0x70, 0x00, 0x85, 0x00, 0x01, 0xa1,
+  0x57, 0x51, 0xdd, 0xcb, 0x06, 0x46, 0x28, 0x7f, 0x2f, 0x50, 0x4e, 0x91,
+  0xf1, 0xd1, 0xe1, 0x38, 0x00, 0x29, 0x06, 0x4e, 0x11, 0x00, 0xa0, 0x4b,
+  0xdd, 0xcb, 0x06, 0x56, 0x28, 0x08, 0xe5, 0x42, 0xc5, 0x12, 0x00, 0x11,
+  0xe1, 0xeb, 0x17, 0x04, 0x43, 0x01, 0x03, 0x34, 0x47, 0x41, 0x46, 0x04,
+  0x0e, 0x00, 0x1e, 0x89, 0x03, 0xf8, 0x53, 0x01, 0x56, 0x13, 0xb4, 0x11,
+  0xff, 0xaa, 0x3e, 0x90, 0x93, 0x3e, 0xb0, 0x9a, 0x38, 0x32, 0x71, 0x0e,
+  0x10, 0x22, 0x15, 0x31, 0x04, 0x23, 0x3c, 0x11, 0x15, 0x23, 0x3c, 0x24,
+  0x0f, 0xd5, 0x12, 0x5d, 0x62, 0xcd, 0x46, 0x92, 0xf1, 0xf1, 0xd1, 0x88,
+  0x0e, 0x1c, 0xc6, 0xe3, 0x45, 0x90, 0x01, 0x00, 0x00, 0x2a, 0xe8, 0x9b,
+  0x23, 0x22, 0xe8, 0x14, 0x09, 0x07, 0x91, 0x47, 0x11, 0xfc, 0x4f, 0x3a,
+  0x41, 0xfd, 0xfd, 0x7e, 0x10, 0x0b, 0x03, 0x10, 0x11, 0x92, 0x02, 0x41,
+  0xb6, 0xfe, 0xdd, 0xb6, 0xd8, 0x03, 0x14, 0x09, 0x58, 0x7d, 0x30, 0x03,
+  0x01, 0x01, 0x4b, 0x44, 0x60, 0xd6, 0x10, 0xdd, 0x7e, 0xfe, 0xde, 0x3f,
+  0x2f, 0x00, 0x93, 0x21, 0x21, 0xcb, 0xc9, 0x0d, 0x5d, 0x03, 0x2c, 0x42,
+  0x21, 0xc0, 0x91, 0x82, 0x13, 0x82, 0x06, 0x16, 0x00, 0x79, 0xa3, 0x6f,
+  0x78, 0xa2, 0xa3, 0x31, 0xb0, 0x2a, 0xe8, 0x9b, 0x2b, 0x22, 0xe8, 0x9b,
+  0xaf, 0x57, 0x1e, 0x07, 0x5d, 0x32, 0x02, 0x7f, 0x49, 0x00, 0x2a, 0x00,
+  0x54, 0xc9, 0xfd, 0x21, 0xe8, 0x9b, 0x06, 0x5d, 0x0c, 0x52, 0x4a, 0x00,
+  0xc8, 0x00, 0x01, 0xf3, 0x05, 0x11, 0xe4, 0xd4, 0x41, 0x60, 0xe5, 0x00,
+  0xdd, 0x36, 0xe6, 0x80, 0x45, 0x3f, 0x04, 0x1e, 0x18, 0x05, 0xf2, 0x65,
+  0x20, 0x36, 0xfe, 0x24, 0x22, 0x10, 0xe5, 0xa7, 0x07, 0x62, 0xdd, 0x75,
+  0xe7, 0xdd, 0x74, 0xe8, 0x23, 0x34, 0x13, 0x09, 0x12, 0x00, 0x42, 0xe9,
+  0xdd, 0x74, 0xea, 0x4b, 0x06, 0x04, 0x12, 0x00, 0xf1, 0x13, 0xeb, 0xdd,
+  0x74, 0xec, 0xdd, 0x7e, 0xe7, 0xdd, 0xb6, 0xe9, 0x4f, 0xdd, 0x7e, 0xe8,
+  0xdd, 0xb6, 0xea, 0x47, 0x79, 0xdd, 0xb6, 0xeb, 0x4f, 0x78, 0xdd, 0xb6,
+  0xec, 0x47, 0xdd, 0x71, 0xed, 0xdd, 0x70, 0xee, 0x18, 0x17, 0x10, 0x22,
+  0x90, 0x1a, 0x11, 0x14, 0x77, 0x4a, 0x11, 0xd5, 0x3a, 0x00, 0x31, 0x4d,
+  0x44, 0xd1, 0xad, 0x19, 0x30, 0xdd, 0x36, 0xef, 0x86, 0x49, 0x91, 0xdd,
+  0x75, 0xf0, 0xdd, 0x74, 0xf1, 0xdd, 0x7e, 0xe5, 0xd0, 0x62, 0x34, 0xe6,
+  0xd6, 0x80, 0x4a, 0x0a, 0x10, 0xf2, 0x67, 0x15, 0x01, 0xf5, 0x1d, 0x30,
+  0x6e, 0xff, 0x26, 0x85, 0x4c, 0x60, 0xd2, 0xef, 0x95, 0xdd, 0x7e, 0xef,
+  0xcb, 0x39, 0xf0, 0x05, 0x36, 0xf4, 0x00, 0xdd, 0x7e, 0xed, 0xdd, 0xa6,
+  0xf3, 0x4f, 0xdd, 0x7e, 0xee, 0xdd, 0xa6, 0xf4, 0xb1, 0xca, 0xe2, 0x95,
+  0x8b, 0x00, 0x30, 0xa6, 0xf3, 0x5f, 0x8b, 0x00, 0x90, 0xa6, 0xf4, 0xb3,
+  0x28, 0x06, 0xdd, 0x36, 0xe4, 0x01, 0xe8, 0x63, 0x52, 0xe4, 0x00, 0xdd,
+  0x7e, 0xe9, 0x2b, 0x00, 0x10, 0xea, 0x2b, 0x00, 0x00, 0x37, 0x54, 0x92,
+  0xe4, 0xf6, 0x02, 0xdd, 0x77, 0xe4, 0xdd, 0x7e, 0xeb, 0x18, 0x00, 0x16,
+  0xec, 0x18, 0x00, 0x11, 0x04, 0x18, 0x00, 0x00, 0x28, 0x31, 0x00, 0x99,
+  0x22, 0x02, 0x7a, 0x7e, 0x53, 0xff, 0xff, 0xc3, 0x66, 0x97, 0x80, 0x12,
+  0x01, 0x92, 0x15, 0x02, 0x0e, 0x5e, 0x32, 0xfc, 0xdd, 0xb6, 0x11, 0x5e,
+  0x11, 0xf9, 0x12, 0x00, 0x11, 0xf7, 0x5a, 0x42, 0xf0, 0x09, 0xf4, 0xdd,
+  0x77, 0xf8, 0x7d, 0xfe, 0x10, 0x28, 0x2c, 0xfe, 0x20, 0x28, 0x38, 0xfe,
+  0x40, 0x28, 0x15, 0xfe, 0x60, 0x28, 0x05, 0xd6, 0x80, 0xc2, 0xa0, 0x00,
+  0x11, 0xf5, 0x6a, 0x1a, 0x12, 0xf6, 0x95, 0x7c, 0x05, 0x35, 0x5e, 0x10,
+  0xc3, 0x1b, 0x00, 0x10, 0xe4, 0x38, 0x0a, 0x20, 0xfa, 0x92, 0x08, 0x64,
+  0x31, 0xe4, 0x18, 0x49, 0x64, 0x0d, 0x02, 0x7b, 0x2e, 0x04, 0xf9, 0x61,
+  0x73, 0xdd, 0x5e, 0xe5, 0xdd, 0x56, 0xe6, 0xd5, 0x9c, 0x8b, 0x72, 0xc1,
+  0x2c, 0x20, 0x0f, 0x24, 0x20, 0x0c, 0x0c, 0x2f, 0xc2, 0xdd, 0x36, 0xe4,
+  0x03, 0x18, 0x15, 0xdd, 0x7e, 0xf2, 0xb7, 0x28, 0x0f, 0x45, 0x02, 0x01,
+  0x4e, 0x00, 0x00, 0x1b, 0x02, 0x50, 0xdd, 0x4e, 0xe4, 0xcb, 0x41, 0x60,
+  0x28, 0x06, 0x6f, 0x00, 0x20, 0xcb, 0x49, 0x10, 0x00, 0x06, 0x8b, 0x00,
+  0x41, 0xcb, 0x51, 0x28, 0x12, 0x7b, 0x06, 0x11, 0xf3, 0x4d, 0x05, 0x11,
+  0xfe, 0xc3, 0x00, 0x80, 0xfe, 0xdd, 0x7e, 0xef, 0x87, 0xdd, 0x77, 0xef,
+  0x0b, 0x19, 0x20, 0x6b, 0x94, 0xe2, 0x00, 0x21, 0xa6, 0xe7, 0x42, 0x00,
+  0x41, 0xfa, 0xdd, 0xa6, 0xe8, 0x7f, 0x23, 0x41, 0xfb, 0xdd, 0xa6, 0xe9,
+  0x44, 0x00, 0x42, 0xfc, 0xdd, 0xa6, 0xea, 0xee, 0x6e, 0x33, 0xdd, 0xa6,
+  0xeb, 0x43, 0x00, 0x21, 0xa6, 0xec, 0x43, 0x00, 0x40, 0xf9, 0xdd, 0xb6,
+  0xfb, 0x07, 0x39, 0x30, 0xdd, 0xb6, 0xfc, 0x1b, 0x02, 0x10, 0xfd, 0x1b,
+  0x02, 0x83, 0xfe, 0x47, 0x59, 0x78, 0x57, 0xb1, 0x20, 0x25, 0x84, 0x45,
+  0x08, 0x39, 0x46, 0x11, 0x11, 0xf0, 0x71, 0x02, 0x0c, 0x23, 0x01, 0x86,
+  0x81, 0x23, 0x2c, 0xd5, 0x56, 0x3a, 0x01, 0xf5, 0x5b, 0x40, 0xdd, 0x36,
+  0xe5, 0x01, 0xbd, 0x02, 0x4c, 0x7a, 0xb3, 0x20, 0x13, 0x0e, 0x1d, 0x37,
+  0xda, 0x46, 0x94, 0x2b, 0x00, 0x07, 0xe0, 0x45, 0x00, 0xd2, 0x02, 0x02,
+  0xd3, 0x0b, 0x02, 0x98, 0x0d, 0x04, 0xd4, 0x02, 0x02, 0xda, 0x0b, 0x06,
+  0x14, 0x00, 0x00, 0xd6, 0x02, 0x02, 0x7d, 0x0c, 0x02, 0x14, 0x00, 0x04,
+  0x13, 0x26, 0x08, 0x7f, 0x02, 0x10, 0x30, 0x4b, 0x3a, 0x50, 0x06, 0x00,
+  0xdd, 0xa6, 0xed, 0x9e, 0x1c, 0x30, 0xee, 0xb1, 0x28, 0xcb, 0x1b, 0x04,
+  0x29, 0x02, 0x04, 0xf1, 0x15, 0x71, 0xfe, 0x10, 0x28, 0x33, 0xd6, 0x20,
+  0x20, 0xea, 0x32, 0x04, 0x81, 0x14, 0x01, 0xbe, 0x15, 0x43, 0x02, 0x80,
+  0xe5, 0xd5, 0xbd, 0x01, 0x01, 0xc3, 0x03, 0x02, 0xa1, 0x01, 0x03, 0xfc,
+  0x48, 0x50, 0x05, 0xc5, 0xcd, 0x75, 0x93, 0xda, 0x76, 0x10, 0x87, 0x39,
+  0x01, 0x44, 0x34, 0xff, 0x18, 0x87, 0x8b, 0x12, 0xf6, 0x90, 0x62, 0x61,
+  0x64, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x72, 0x20, 0x64, 0x75, 0x72, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0xd1,
+  0x78, 0xcb, 0x6b, 0x51, 0x63, 0x57, 0x7d, 0x77, 0x66, 0x40, 0x6f, 0x9a,
+  0x64, 0x72, 0x65, 0x9e, 0x65, 0xb6, 0x5f, 0xf7, 0x65, 0xb2, 0x60, 0x69,
+  0x67, 0xbf, 0x68, 0x0a, 0x6a, 0xb9, 0x60, 0xe4, 0x60, 0xd2, 0x61, 0xa4,
+  0x73, 0xae, 0x73, 0xc0, 0x73, 0x94, 0x62, 0x93, 0x6b, 0x9e, 0x57, 0x7b,
+  0x65, 0xd8, 0x73, 0x2f, 0x74, 0x93, 0x74, 0x05, 0x75, 0xa7, 0x62, 0x98,
+  0x75, 0xf0, 0x75, 0xe0, 0x78, 0x29, 0x82, 0xe0, 0x84, 0x93, 0x79, 0x1c,
+  0x62, 0x51, 0x79, 0x0c, 0x7d, 0x9b, 0x7b, 0x5b, 0x63, 0xd0, 0x73, 0x58,
+  0x75, 0x49, 0x6a, 0xcc, 0x73, 0xd4, 0x73, 0x3c, 0x66, 0x6d, 0x70, 0x19,
+  0x66, 0xe5, 0x68, 0x30, 0x6a, 0x3f, 0x7f, 0xc6, 0x80, 0x41, 0x7d, 0xb1,
+  0x71, 0x0f, 0x76, 0x54, 0x85, 0x5e, 0x85, 0xa3, 0x85, 0xb1, 0x7a, 0x1b,
+  0x72, 0x44, 0x7d, 0x50, 0x7d, 0x89, 0x6b, 0x35, 0x5e, 0x3f, 0x5e, 0xa6,
+  0x65, 0x02, 0x00, 0xf1, 0x24, 0xb0, 0x93, 0xf0, 0x8c, 0x43, 0x8d, 0x89,
+  0x8d, 0xbd, 0x8d, 0xbc, 0x8e, 0xd0, 0x8f, 0x5e, 0x90, 0x20, 0x20, 0x68,
+  0x64, 0x25, 0x64, 0x3a, 0x20, 0x25, 0x73, 0x20, 0x40, 0x20, 0x25, 0x64,
+  0x09, 0x23, 0x25, 0x64, 0x20, 0x61, 0x64, 0x64, 0x72, 0x20, 0x25, 0x64,
+  0x3a, 0x25, 0x78, 0x20, 0x64, 0x65, 0x73, 0x63, 0xca, 0x00, 0xd2, 0x20,
+  0x72, 0x61, 0x77, 0x20, 0x25, 0x64, 0x0a, 0x00, 0x72, 0x00, 0x57, 0x00,
+  0x33, 0x00, 0xe0, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x25, 0x64, 0x2c,
+  0x20, 0x65, 0x72, 0x72, 0x6f, 0x32, 0x00, 0xf2, 0x08, 0x0a, 0x00, 0x69,
+  0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x64, 0x65, 0x76, 0x00, 0x77,
+  0x61, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x73, 0x79, 0x2a, 0x00, 0xf2, 0x12,
+  0x00, 0x6e, 0x6f, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x62, 0x75, 0x66,
+  0x66, 0x65, 0x72, 0x73, 0x00, 0x62, 0x64, 0x72, 0x65, 0x61, 0x64, 0x00,
+  0x62, 0x64, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x63, 0x0f, 0x00, 0x13,
+  0x63, 0x0f, 0x00, 0xf3, 0x10, 0x64, 0x5f, 0x63, 0x6c, 0x6f, 0x73, 0x65,
+  0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x41,
+  0x42, 0x43, 0x44, 0x45, 0x46, 0x00, 0x69, 0x5f, 0x6f, 0x70, 0x65, 0x6e,
+  0x07, 0x00, 0x20, 0x3a, 0x20, 0x7a, 0x01, 0xd9, 0x69, 0x6e, 0x6f, 0x64,
+  0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x0a, 0x1a, 0x00, 0x42,
+  0x64, 0x69, 0x73, 0x6b, 0x1f, 0x00, 0x92, 0x0a, 0x00, 0x00, 0x67, 0x65,
+  0x74, 0x64, 0x65, 0x76, 0x18, 0x00, 0xf1, 0x0a, 0x65, 0x76, 0x00, 0x69,
+  0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x3a, 0x20, 0x63, 0x6f, 0x72, 0x72,
+  0x75, 0x70, 0x74, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0xac, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0xac, 0x00, 0x05, 0x5f, 0x00, 0x4b, 0x00, 0x62, 0x6c,
+  0x6b, 0x2f, 0x00, 0x00, 0xed, 0x00, 0x00, 0x77, 0x00, 0x00, 0x28, 0x00,
+  0xd4, 0x64, 0x2e, 0x00, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x79, 0x73, 0x74,
+  0x65, 0x6d, 0x21, 0x00, 0x31, 0x2e, 0x0a, 0x00, 0x0d, 0x01, 0xf7, 0x01,
+  0x62, 0x6c, 0x6b, 0x3a, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x75,
+  0x6e, 0x74, 0x65, 0x64, 0x16, 0x00, 0x04, 0x2f, 0x01, 0x30, 0x62, 0x6c,
+  0x6b, 0x9e, 0x00, 0x01, 0x51, 0x00, 0x03, 0xb9, 0x00, 0x00, 0x79, 0x01,
+  0x5b, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x19, 0x00, 0xc2, 0x4f, 0x46, 0x54,
+  0x00, 0x77, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x3a, 0x52, 0x00, 0xa0,
+  0x69, 0x6e, 0x67, 0x20, 0x64, 0x69, 0x72, 0x74, 0x79, 0x20, 0x84, 0x00,
+  0x12, 0x20, 0x85, 0x00, 0x60, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x63, 0x1b,
+  0x00, 0x64, 0x72, 0x2f, 0x6f, 0x2e, 0x0a, 0x00, 0xe4, 0x00, 0x01, 0x4a,
+  0x00, 0x92, 0x00, 0x00, 0x5f, 0x75, 0x6e, 0x6c, 0x69, 0x6e, 0x6b, 0x53,
+  0x00, 0x01, 0x0b, 0x00, 0xf0, 0x01, 0x0a, 0x00, 0x70, 0x73, 0x6c, 0x65,
+  0x65, 0x70, 0x3a, 0x20, 0x76, 0x6f, 0x6f, 0x64, 0x6f, 0x6f, 0x77, 0x00,
+  0x20, 0x70, 0x72, 0xf0, 0x00, 0x90, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20,
+  0x72, 0x75, 0x6e, 0x74, 0x00, 0x06, 0x17, 0x00, 0xe0, 0x63, 0x61, 0x6e,
+  0x27, 0x74, 0x20, 0x65, 0x69, 0x00, 0x6b, 0x69, 0x6c, 0x6c, 0x65, 0x26,
+  0x01, 0xc1, 0x69, 0x74, 0x00, 0x64, 0x6f, 0x65, 0x78, 0x69, 0x74, 0x20,
+  0x77, 0x6f, 0x1c, 0x00, 0xf1, 0x03, 0x78, 0x69, 0x74, 0x00, 0x0d, 0x0a,
+  0x70, 0x61, 0x6e, 0x69, 0x63, 0x3a, 0x20, 0x00, 0x53, 0x74, 0x61, 0x72,
+  0xad, 0x00, 0x10, 0x2f, 0x2b, 0x00, 0x10, 0x0a, 0x10, 0x02, 0x01, 0x0a,
+  0x00, 0x00, 0x9c, 0x00, 0x30, 0x65, 0x00, 0x00, 0x53, 0x02, 0xf1, 0x01,
+  0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
+  0x79, 0x20, 0x62, 0x79, 0x54, 0x02, 0xf2, 0x03, 0x00, 0x57, 0x41, 0x52,
+  0x4e, 0x49, 0x4e, 0x47, 0x3a, 0x20, 0x72, 0x65, 0x6e, 0x61, 0x6d, 0x65,
+  0x3a, 0x20, 0xbd, 0x00, 0xf2, 0x04, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x0a,
+  0x00, 0x00, 0x2e, 0x00, 0x2e, 0x2e, 0x00, 0x5f, 0x6d, 0x6b, 0x64, 0x69,
+  0x72, 0xd0, 0x00, 0x95, 0x72, 0x65, 0x63, 0x0a, 0x00, 0x00, 0x5f, 0x72,
+  0x6d, 0x12, 0x00, 0x03, 0xe2, 0x00, 0x90, 0x48, 0x61, 0x6c, 0x74, 0x65,
+  0x64, 0x2e, 0x0a, 0x00, 0xb4, 0x01, 0xb1, 0x30, 0x00, 0x00, 0xde, 0x01,
+  0x01, 0x41, 0x01, 0x0a, 0x0f, 0x64, 0x78, 0x99, 0x12, 0x04, 0x7f, 0x99,
+  0x0f, 0x01, 0x00, 0x06, 0xff, 0x56, 0x30, 0x2e, 0x33, 0x70, 0x72, 0x65,
+  0x31, 0x00, 0x46, 0x75, 0x7a, 0x69, 0x78, 0x00, 0x00, 0x65, 0x7a, 0x72,
+  0x65, 0x74, 0x72, 0x6f, 0x00, 0x00, 0x00, 0xff, 0xff, 0xeb, 0x00, 0x00,
+  0xfb, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x77, 0x03, 0x9f, 0x0a, 0x8e, 0x03,
+  0xa9, 0x03, 0xad, 0x0a, 0x34, 0x03, 0x9f, 0x0a, 0x4b, 0x03, 0x60, 0x03,
+  0xad, 0x0a, 0xc5, 0x39, 0x03, 0x3b, 0xaa, 0x36, 0x91, 0x38, 0xb4, 0x3b,
+  0xc3, 0x03, 0x9f, 0x0a, 0xda, 0x03, 0xf5, 0x03, 0xad, 0x0a, 0x9b, 0x0a,
+  0x32, 0x89, 0x68, 0x87, 0x75, 0x88, 0xd7, 0x88, 0x7f, 0x00, 0xff, 0x00,
+  0xff, 0x01, 0x3e, 0xa6, 0x00, 0x00, 0xad, 0xde, 0xde, 0xc0, 0x10, 0x82,
+  0x00, 0x0a, 0x20, 0x15, 0xb5, 0x02, 0x00, 0xff, 0x03, 0x00, 0x01, 0x00,
+  0x00, 0x80, 0x00, 0xa2, 0x00, 0x0d, 0x00, 0x80, 0x0c, 0x57, 0x00, 0x00,
+  0x00, 0xdc, 0x9b, 0x35, 0x00, 0x0a, 0x0f, 0x01, 0x00, 0xff, 0xff, 0xd4,
+  0x50, 0x18, 0xfe, 0xc9, 0x01, 0xf3, 0xac, 0x1b, 0xc0, 0xcd, 0x46, 0xf7,
+  0x21, 0x00, 0x00, 0x11, 0x01, 0x00, 0x01, 0x7f, 0x00, 0xdc, 0x9d, 0xf0,
+  0x1d, 0x3e, 0xc3, 0x32, 0x38, 0x00, 0x21, 0x86, 0xf8, 0x22, 0x39, 0x00,
+  0x32, 0x30, 0x00, 0x21, 0xbd, 0xf7, 0x22, 0x31, 0x00, 0x32, 0x00, 0x00,
+  0x21, 0x45, 0xf8, 0x22, 0x01, 0x00, 0x32, 0x66, 0x00, 0x21, 0x7e, 0xf8,
+  0x22, 0x67, 0x00, 0xf5, 0xaf, 0xcd, 0x4b, 0xf7, 0xf1, 0x15, 0x12, 0xc1,
+  0xf5, 0x7e, 0x5b, 0xc3, 0x5c, 0x01, 0x00, 0xc9, 0xf5, 0x3a, 0x02, 0xf4,
+  0x14, 0x00, 0x72, 0xf5, 0xed, 0x38, 0xb5, 0x32, 0x70, 0xf7, 0x21, 0x00,
+  0x41, 0xf5, 0x3a, 0x70, 0xf7, 0x09, 0x00, 0x23, 0x00, 0xf5, 0x21, 0x5a,
+  0x10, 0xf1, 0x21, 0x5a, 0x00, 0x10, 0x29, 0x10, 0xc8, 0xe6, 0x83, 0x41,
+  0x29, 0x11, 0x20, 0xf4, 0xa3, 0x73, 0xf0, 0x2d, 0x32, 0x11, 0xf4, 0x32,
+  0x03, 0xf7, 0x77, 0x2b, 0x77, 0x01, 0xa0, 0xf7, 0xc5, 0xeb, 0xfb, 0xe9,
+  0xe1, 0xf3, 0xed, 0x73, 0x08, 0xf4, 0x31, 0x00, 0xf6, 0x3e, 0x01, 0x32,
+  0x03, 0xf7, 0xcd, 0x3f, 0xf7, 0xcd, 0xce, 0x53, 0xcd, 0x51, 0xf7, 0xed,
+  0x7b, 0x08, 0xf4, 0x18, 0xc1, 0xf3, 0x08, 0xf5, 0x08, 0xd9, 0xc5, 0xd5,
+  0xe5, 0xd9, 0xc5, 0xd5, 0xdd, 0xe5, 0xfd, 0xe5, 0x6f, 0x34, 0xf3, 0x04,
+  0x7e, 0x32, 0x07, 0xf4, 0x23, 0x23, 0x01, 0x08, 0x00, 0x11, 0x12, 0xf4,
+  0xed, 0xb0, 0x3e, 0x01, 0x32, 0x06, 0xf4, 0x41, 0x00, 0xc0, 0xcd, 0x3f,
+  0xf7, 0xfb, 0xcd, 0x94, 0x50, 0xf3, 0xcd, 0x51, 0xf7, 0xaf, 0x16, 0x00,
+  0xa0, 0x7b, 0x08, 0xf4, 0x2a, 0x0c, 0xf4, 0xed, 0x5b, 0x0a, 0xf4, 0x86,
+  0x00, 0xf0, 0x02, 0x20, 0x18, 0x7c, 0xb5, 0x28, 0x03, 0x37, 0x18, 0x01,
+  0xeb, 0xfd, 0xe1, 0xdd, 0xe1, 0xd1, 0xc1, 0xd9, 0x04, 0x00, 0xf0, 0x05,
+  0x08, 0xf1, 0x08, 0xfb, 0xc9, 0x2a, 0x0c, 0xf4, 0xe5, 0x2a, 0x0a, 0xf4,
+  0xe5, 0xcd, 0x83, 0xf7, 0xd1, 0xe1, 0x18, 0xd9, 0x40, 0x00, 0x60, 0xc1,
+  0xd1, 0x2a, 0x1a, 0xf4, 0xf9, 0x46, 0x00, 0xf0, 0x02, 0xeb, 0x11, 0x00,
+  0x01, 0xfb, 0xe9, 0xf3, 0x3a, 0x06, 0xf4, 0xb7, 0xc2, 0x61, 0xf8, 0x3a,
+  0x01, 0x9c, 0x07, 0x00, 0x32, 0x21, 0x09, 0x00, 0x70, 0x00, 0x00, 0xcb,
+  0x4c, 0xa0, 0x21, 0x6a, 0xf8, 0xcd, 0x4d, 0xf9, 0xcd, 0x00, 0xf7, 0x5b,
+  0xed, 0x05, 0xb0, 0x67, 0x61, 0x6c, 0x5d, 0x0d, 0x0a, 0x00, 0x5b, 0x4e,
+  0x4d, 0x49, 0x08, 0x00, 0x84, 0xcd, 0x3f, 0xf7, 0x21, 0x76, 0xf8, 0x18,
+  0xde, 0xc8, 0x00, 0x40, 0xf5, 0xc5, 0xd5, 0xe5, 0xca, 0x00, 0xf0, 0x0d,
+  0xcd, 0x02, 0xf7, 0xed, 0x73, 0xfe, 0xf6, 0x31, 0xfe, 0xf6, 0x3a, 0x00,
+  0x00, 0xcd, 0x5a, 0xf7, 0xfe, 0xc3, 0xc4, 0xf4, 0xf8, 0x3e, 0x01, 0x32,
+  0x01, 0x9c, 0x32, 0x10, 0x20, 0x01, 0xf1, 0x0f, 0xcd, 0xde, 0x01, 0xaf,
+  0x32, 0x01, 0x9c, 0x3a, 0x89, 0xfc, 0xb7, 0x20, 0x44, 0xcd, 0x67, 0xf7,
+  0xed, 0x7b, 0xfe, 0xf6, 0xaf, 0x32, 0x10, 0xf4, 0x21, 0xd4, 0xf8, 0xe5,
+  0xed, 0x4d, 0x8f, 0x00, 0x90, 0x20, 0x03, 0xcd, 0x7e, 0xf7, 0xaf, 0x32,
+  0x03, 0xf7, 0xd0, 0x00, 0x46, 0xe1, 0xd1, 0xc1, 0xf1, 0xd2, 0x00, 0x20,
+  0x3e, 0xc3, 0xc9, 0x01, 0x20, 0x0b, 0x00, 0xab, 0x14, 0x00, 0x38, 0x24,
+  0xe1, 0xe1, 0xe1, 0xc9, 0xaf, 0x32, 0x89, 0xfc, 0xcd, 0x67, 0xf7, 0x2a,
+  0xfe, 0xf6, 0x22, 0x2d, 0x01, 0x30, 0x21, 0x1e, 0xf9, 0x49, 0x00, 0x31,
+  0xcd, 0x3f, 0xf7, 0x43, 0x01, 0x30, 0xcd, 0xce, 0x53, 0xdc, 0x44, 0x20,
+  0x01, 0xbe, 0xdb, 0x6a, 0x30, 0xcd, 0x83, 0xfa, 0x6c, 0x00, 0x00, 0x17,
+  0x00, 0x02, 0x89, 0x01, 0x00, 0x40, 0x01, 0xe0, 0xc4, 0x83, 0xf7, 0x18,
+  0x91, 0x7e, 0xa7, 0xc8, 0xcd, 0x71, 0xf7, 0x23, 0x18, 0xf7, 0x09, 0x00,
+  0x41, 0x8f, 0xf9, 0x3e, 0x20, 0x0e, 0x00, 0xf2, 0x0d, 0xf2, 0x3e, 0x0d,
+  0xcd, 0x71, 0xf7, 0x3e, 0x0a, 0xc3, 0x71, 0xf7, 0xf5, 0x7c, 0xcd, 0x8f,
+  0xf9, 0x7d, 0xcd, 0x8f, 0xf9, 0xf1, 0xc9, 0xf5, 0x78, 0xcd, 0x8f, 0xf9,
+  0x79, 0x0b, 0x00, 0x51, 0x7a, 0xcd, 0x8f, 0xf9, 0x7b, 0x0b, 0x00, 0xf0,
+  0x19, 0xc5, 0xf5, 0x4f, 0x1f, 0x1f, 0x1f, 0x1f, 0xcd, 0xa0, 0xf9, 0x79,
+  0xcd, 0xa0, 0xf9, 0xf1, 0xc1, 0xc9, 0xe6, 0x0f, 0xfe, 0x0a, 0x38, 0x02,
+  0xc6, 0x07, 0xc6, 0x30, 0xc3, 0x71, 0xf7, 0xe1, 0xc1, 0xed, 0x41, 0xc5,
+  0xe9, 0x4d, 0xed, 0x68, 0xc9, 0xd9, 0x00, 0xa1, 0xfb, 0xc9, 0x21, 0x03,
+  0xf7, 0xf3, 0x7e, 0x36, 0x01, 0x6f, 0xc5, 0x58, 0x92, 0xf3, 0x7d, 0x32,
+  0x03, 0xf7, 0xb7, 0xc0, 0xfb, 0xc9, 0x34, 0x1b, 0x83, 0x7a, 0xb3, 0xc8,
+  0x1b, 0x43, 0x04, 0x14, 0x4a, 0x74, 0x5b, 0x01, 0xc9, 0x40, 0x40, 0x78,
+  0xb1, 0xc9, 0xc1, 0x2b, 0x00, 0x86, 0xc5, 0xcd, 0x51, 0xf7, 0x73, 0xc3,
+  0x3f, 0xf7, 0x0d, 0x00, 0x20, 0x23, 0x72, 0x0f, 0x00, 0x20, 0xe1, 0xe5,
+  0x0d, 0x00, 0x36, 0x6e, 0x26, 0x00, 0x0d, 0x00, 0x00, 0x0e, 0x28, 0x34,
+  0xc3, 0x3f, 0xf7, 0xa1, 0x5b, 0xf0, 0x07, 0xcd, 0xd3, 0xf9, 0x28, 0x0f,
+  0x7e, 0x23, 0xcd, 0x51, 0xf7, 0x12, 0xcd, 0x3f, 0xf7, 0x13, 0x10, 0xf4,
+  0x0d, 0x20, 0xf1, 0xdd, 0xe1, 0xf0, 0x14, 0x08, 0x22, 0x00, 0x11, 0xed,
+  0x39, 0x00, 0x42, 0xcd, 0x3f, 0xf7, 0x12, 0x22, 0x00, 0xf0, 0x0e, 0x18,
+  0xdc, 0xd1, 0xe1, 0xc1, 0xc5, 0xe5, 0xd5, 0x78, 0xb1, 0xc8, 0xcd, 0x51,
+  0xf7, 0x36, 0x00, 0x0b, 0x78, 0xb1, 0xca, 0xfa, 0xf9, 0x5d, 0x54, 0x13,
+  0xed, 0xb0, 0xc3, 0xfa, 0x9a, 0x36, 0x01, 0xf5, 0x01, 0x30, 0xed, 0x73,
+  0x0e, 0x52, 0x01, 0xb0, 0x21, 0x00, 0xf4, 0x11, 0x00, 0xde, 0x01, 0x00,
+  0x02, 0xed, 0xb0, 0xef, 0x02, 0x02, 0x84, 0x4b, 0xf7, 0x06, 0xcd, 0x00,
+  0xf7, 0x5f, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x3a, 0x20,
+  0x46, 0x41, 0x49, 0x4c, 0x0d, 0x0a, 0x00, 0x12, 0x00, 0xb0, 0x53, 0x57,
+  0x41, 0x50, 0x50, 0x45, 0x44, 0x0d, 0x0a, 0x00, 0xf3, 0xf0, 0x5c, 0x00,
+  0x58, 0x02, 0x00, 0x3f, 0x75, 0xf0, 0x00, 0x2a, 0x00, 0xf4, 0xb7, 0xed,
+  0x52, 0x28, 0x1f, 0xcd, 0x4b, 0xf7, 0xd9, 0x21, 0x00, 0xde, 0xcd, 0xa1,
+  0x00, 0x58, 0x00, 0x82, 0xd9, 0xed, 0x7b, 0x0e, 0xf4, 0xcd, 0x3f, 0xf7,
+  0x1f, 0x00, 0x30, 0x20, 0x27, 0xdd, 0x3d, 0x59, 0x10, 0x36, 0x80, 0x4a,
+  0x31, 0x0e, 0x32, 0x02, 0xdd, 0x43, 0x20, 0xff, 0x9b, 0x23, 0x00, 0x01,
+  0x3b, 0x02, 0x11, 0x3a, 0x72, 0x02, 0x00, 0x59, 0x01, 0xe1, 0xcd, 0x6e,
+  0xf9, 0x21, 0xaa, 0xfa, 0xcd, 0x4d, 0xf9, 0xc3, 0x00, 0xf7, 0x00, 0x00,
+  0x36, 0x04, 0x52, 0x22, 0x38, 0xfb, 0x11, 0x02, 0x89, 0x8d, 0x05, 0xc4,
+  0x00, 0x31, 0x2a, 0x38, 0xfb, 0x62, 0x8f, 0x00, 0x09, 0x04, 0x2d, 0x8a,
+  0xfc, 0xd2, 0x00, 0xe0, 0xc1, 0xc1, 0xc1, 0x21, 0x00, 0xf4, 0xe5, 0x2a,
+  0x38, 0xfb, 0xe5, 0xcd, 0x5c, 0x4b, 0x0d, 0x00, 0x01, 0xdf, 0x52, 0x1f,
+  0xff, 0x01, 0x00, 0xec, 0x41, 0x00, 0x06, 0xde, 0x21, 0x39, 0x22, 0xf3,
+  0x05, 0x4b, 0xf7, 0x11, 0x89, 0xfb, 0x01, 0x00, 0x01, 0xed, 0xb0, 0xd1,
+  0xc1, 0xc5, 0x47, 0x79, 0xcd, 0x4b, 0xf7, 0xc5, 0x21, 0x11, 0x00, 0xc1,
+  0xc1, 0xeb, 0x78, 0xc1, 0x10, 0xdc, 0xc9, 0x11, 0xd7, 0xb4, 0x01, 0x01,
+  0x7d, 0x40, 0x00, 0x91, 0x39, 0x41, 0x15, 0xb7, 0x01, 0x14, 0x8f, 0x39,
+  0x62, 0x21, 0x20, 0x00, 0x19, 0xeb, 0x03, 0x30, 0x0e, 0xf6, 0x0e, 0xe2,
+  0x11, 0xb7, 0xee, 0x80, 0xf2, 0xef, 0xb6, 0xc9, 0x03, 0x00, 0x05, 0x00,
+  0xbb, 0x0c, 0x77, 0x00, 0x04, 0x00, 0x08, 0x03, 0x15, 0x1c, 0x11, 0x13,
+  0x1a, 0x19, 0x16, 0x0f, 0xf9, 0x9e, 0x42, 0x21, 0x00, 0x02, 0x19, 0xf7,
+  0x4e, 0x30, 0x05, 0x02, 0x19, 0xd0, 0x40, 0x01, 0x06, 0x00, 0x31, 0x06,
+  0x02, 0x19, 0xbb, 0x40, 0x01, 0xd2, 0x9d, 0xb1, 0xd5, 0x21, 0xdb, 0xb0,
+  0x7d, 0xd6, 0x67, 0x7c, 0xde, 0xb4, 0xd0, 0x2a, 0x00, 0x77, 0x2b, 0x01,
+  0xe3, 0x00, 0x09, 0x18, 0xed, 0x47, 0x7a, 0x83, 0x60, 0x46, 0xf1, 0x23,
+  0x4d, 0x44, 0x2a, 0xea, 0x2d, 0x12, 0x15, 0xc5, 0xf2, 0x1c, 0x83, 0xc1,
+  0x2a, 0xee, 0x9b, 0xc5, 0xe5, 0x2a, 0xea, 0x3f, 0x1c, 0xf0, 0x0b, 0xc1,
+  0x03, 0x03, 0x03, 0x79, 0xe6, 0xfc, 0x4f, 0x21, 0xea, 0x9b, 0x7e, 0x81,
+  0x77, 0x23, 0x7e, 0x88, 0x77, 0x2a, 0xee, 0x9b, 0x23, 0x23, 0x22, 0xee,
+  0x9b, 0x9b, 0x1c, 0xc0, 0x00, 0x03, 0x22, 0x1c, 0xf4, 0xcd, 0x17, 0x4d,
+  0x22, 0xf3, 0x9b, 0x21, 0x91, 0x2d, 0x16, 0xf3, 0xbd, 0x33, 0x61, 0xed,
+  0x4b, 0xf3, 0x9b, 0x21, 0x44, 0xc8, 0x13, 0x13, 0x1c, 0x07, 0x2b, 0xf1,
+  0x03, 0xe4, 0x01, 0x21, 0x7b, 0xf4, 0x7d, 0xd6, 0x85, 0x7c, 0xde, 0xf4,
+  0x30, 0x05, 0x36, 0xff, 0x23, 0x18, 0xf3, 0x54, 0x02, 0x20, 0xf3, 0x9b,
+  0x54, 0x02, 0xc2, 0xf1, 0xf1, 0x2a, 0xf3, 0x9b, 0x36, 0x01, 0x21, 0x06,
+  0xf4, 0x36, 0x01, 0x0a, 0x00, 0xe0, 0x00, 0x01, 0x22, 0xee, 0x9b, 0x26,
+  0x02, 0x22, 0xea, 0x9b, 0x21, 0x20, 0x00, 0xe5, 0xb6, 0x94, 0x00, 0x05,
+  0x1e, 0x92, 0x21, 0x3a, 0xb8, 0xe3, 0xcd, 0x6d, 0xb7, 0xf1, 0xc9, 0x4d,
+  0x0b, 0x31, 0x2a, 0xee, 0x9b, 0x2c, 0x1e, 0x01, 0xad, 0x00, 0x80, 0xed,
+  0x4b, 0xee, 0x9b, 0xed, 0x43, 0x16, 0xf4, 0xc3, 0xa4, 0xa0, 0x12, 0xf4,
+  0x26, 0x01, 0x22, 0x14, 0xf4, 0x2a, 0xf3, 0x9b, 0x8a, 0x16, 0x01, 0x12,
+  0x83, 0x00, 0x0c, 0x00, 0x13, 0x40, 0x0c, 0x00, 0x03, 0x5e, 0x16, 0x20,
+  0x01, 0x9c, 0x3b, 0x01, 0x00, 0x0c, 0x47, 0x81, 0x00, 0xde, 0x22, 0x20,
+  0x9b, 0xcd, 0xe9, 0xb6, 0x7a, 0x7c, 0x12, 0x02, 0xab, 0x7c, 0x02, 0x17,
+  0x18, 0x10, 0x7c, 0x43, 0x24, 0x42, 0x08, 0x21, 0x92, 0xba, 0x4b, 0x8a,
+  0x61, 0x4e, 0x9b, 0xe5, 0x21, 0x99, 0xba, 0xd2, 0x25, 0x72, 0x21, 0x38,
+  0x00, 0xe3, 0x2a, 0xf7, 0x9b, 0x8c, 0x97, 0x94, 0x22, 0xf9, 0x9b, 0x3e,
+  0x0f, 0xfd, 0x21, 0xf9, 0x9b, 0xc2, 0x1a, 0x20, 0x30, 0x13, 0x85, 0x1d,
+  0x32, 0x21, 0xb8, 0xbb, 0xdc, 0x30, 0x00, 0x88, 0x21, 0x91, 0xf9, 0x9b,
+  0x01, 0x3e, 0xa6, 0xed, 0x5b, 0xf9, 0x9b, 0x4d, 0x92, 0x10, 0x19, 0x04,
+  0x00, 0xf0, 0x01, 0x09, 0x22, 0x85, 0xaa, 0xcd, 0x29, 0xb7, 0xcd, 0x57,
+  0xb7, 0xcd, 0xb6, 0x01, 0xcd, 0xbd, 0xb7, 0x34, 0x00, 0x00, 0x54, 0x00,
+  0x63, 0x2a, 0xf5, 0x9b, 0xe5, 0x21, 0xef, 0x3c, 0x00, 0xa2, 0xf1, 0xf1,
+  0x21, 0x05, 0x9c, 0x36, 0x0a, 0x21, 0x2f, 0xbc, 0x60, 0x21, 0x43, 0xb7,
+  0xf9, 0x21, 0x48, 0x0b, 0x00, 0xf0, 0x02, 0x27, 0x04, 0x2a, 0xea, 0x9b,
+  0x22, 0xec, 0x9b, 0x2a, 0xee, 0x9b, 0x22, 0xf0, 0x9b, 0xfd, 0x21, 0x23,
+  0x83, 0x01, 0x30, 0xb7, 0x28, 0x09, 0x58, 0x50, 0x02, 0x51, 0x24, 0x00,
+  0x2f, 0x50, 0x00, 0x1b, 0x60, 0x00, 0x43, 0x5d, 0x11, 0x3c, 0x57, 0x59,
+  0x61, 0x3c, 0x20, 0x08, 0x21, 0x4d, 0xbc, 0xcf, 0x00, 0xf0, 0x00, 0x3a,
+  0x22, 0x9b, 0xb7, 0x28, 0x05, 0x01, 0x6f, 0x00, 0x18, 0x03, 0x01, 0x77,
+  0x00, 0xc5, 0x9e, 0x43, 0x34, 0x21, 0x55, 0xbc, 0x8e, 0x31, 0x51, 0x22,
+  0x9b, 0x4e, 0x06, 0x00, 0x2a, 0x10, 0x01, 0xb7, 0x43, 0x01, 0x3d, 0x24,
+  0x01, 0x7f, 0x12, 0x42, 0x1b, 0xc5, 0x21, 0x7b, 0x81, 0x00, 0xf2, 0x08,
+  0xc1, 0x2a, 0xec, 0x9b, 0x22, 0xea, 0x9b, 0x2a, 0xf0, 0x9b, 0x22, 0xee,
+  0x9b, 0x21, 0x22, 0x9b, 0x36, 0x01, 0x78, 0xb1, 0xca, 0x43, 0xb9, 0xdc,
+  0x27, 0x00, 0x3f, 0x01, 0x01, 0x86, 0x7e, 0x15, 0xd4, 0xbd, 0x93, 0x04,
+  0x00, 0x60, 0x01, 0x17, 0x00, 0x94, 0xd3, 0x00, 0x19, 0x4e, 0x06, 0x00,
+  0x11, 0x00, 0x00, 0xfa, 0x5f, 0x00, 0xb7, 0x5e, 0x05, 0x22, 0x44, 0x74,
+  0x22, 0x06, 0x9c, 0xfd, 0x21, 0x06, 0x9c, 0x48, 0x4f, 0x04, 0xb3, 0x00,
+  0x23, 0x21, 0x83, 0xfb, 0x00, 0x51, 0x40, 0xb8, 0x2a, 0x06, 0x9c, 0x4c,
+  0x96, 0x32, 0x21, 0x87, 0xf4, 0x2a, 0x00, 0x04, 0x15, 0x4e, 0x04, 0x18,
+  0x00, 0x27, 0x89, 0xf4, 0x91, 0x02, 0x61, 0x00, 0xf4, 0x21, 0x2c, 0x00,
+  0x09, 0x6d, 0x33, 0x05, 0x26, 0x1a, 0x10, 0xd1, 0xd6, 0x12, 0x02, 0xe0,
+  0x60, 0x12, 0x2d, 0x2e, 0x51, 0xf0, 0x02, 0x6e, 0x6f, 0x20, 0x74, 0x74,
+  0x79, 0x00, 0x46, 0x55, 0x5a, 0x49, 0x58, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0xde, 0x10, 0xf0, 0x0b, 0x25, 0x73, 0x0a, 0x43, 0x6f, 0x70, 0x79, 0x72,
+  0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x63, 0x29, 0x20, 0x31, 0x39, 0x38,
+  0x38, 0x2d, 0x32, 0x30, 0x30, 0x32, 0xb7, 0x0d, 0xfd, 0x19, 0x48, 0x2e,
+  0x46, 0x2e, 0x42, 0x6f, 0x77, 0x65, 0x72, 0x2c, 0x20, 0x44, 0x2e, 0x42,
+  0x72, 0x61, 0x75, 0x6e, 0x2c, 0x20, 0x53, 0x2e, 0x4e, 0x69, 0x74, 0x73,
+  0x63, 0x68, 0x6b, 0x65, 0x2c, 0x20, 0x48, 0x2e, 0x50, 0x65, 0x72, 0x61,
+  0x7a, 0x61, 0x44, 0x00, 0x20, 0x39, 0x37, 0x44, 0x00, 0x10, 0x31, 0x44,
+  0x00, 0xfc, 0x1c, 0x41, 0x72, 0x63, 0x61, 0x64, 0x79, 0x20, 0x53, 0x63,
+  0x68, 0x65, 0x6b, 0x6f, 0x63, 0x68, 0x69, 0x6b, 0x68, 0x69, 0x6e, 0x2c,
+  0x20, 0x41, 0x64, 0x72, 0x69, 0x61, 0x6e, 0x6f, 0x20, 0x43, 0x2e, 0x20,
+  0x52, 0x2e, 0x20, 0x64, 0x61, 0x20, 0x43, 0x75, 0x6e, 0x68, 0x48, 0x00,
+  0xf0, 0x01, 0x32, 0x30, 0x31, 0x33, 0x2d, 0x32, 0x30, 0x31, 0x35, 0x20,
+  0x57, 0x69, 0x6c, 0x6c, 0x20, 0x53, 0x8a, 0x00, 0xd5, 0x62, 0x75, 0x74,
+  0x74, 0x73, 0x20, 0x3c, 0x77, 0x69, 0x6c, 0x6c, 0x40, 0x73, 0x11, 0x00,
+  0x5e, 0x2e, 0x63, 0x6f, 0x6d, 0x3e, 0x3e, 0x00, 0x10, 0x34, 0x3e, 0x00,
+  0xf0, 0x0d, 0x39, 0x20, 0x41, 0x6c, 0x61, 0x6e, 0x20, 0x43, 0x6f, 0x78,
+  0x20, 0x3c, 0x61, 0x6c, 0x61, 0x6e, 0x40, 0x65, 0x74, 0x63, 0x68, 0x65,
+  0x64, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x39, 0x00, 0xd6, 0x2e, 0x75, 0x6b,
+  0x3e, 0x0a, 0x44, 0x65, 0x76, 0x62, 0x6f, 0x6f, 0x74, 0x0a, 0xa5, 0x0e,
+  0xf0, 0x08, 0x49, 0x6e, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x20, 0x50,
+  0x54, 0x41, 0x42, 0x53, 0x49, 0x5a, 0x45, 0x20, 0x74, 0x6f, 0x20, 0x25,
+  0x64, 0x06, 0x00, 0x90, 0x75, 0x73, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69,
+  0x6c, 0xd8, 0x0f, 0xf0, 0x01, 0x20, 0x52, 0x41, 0x4d, 0x0a, 0x00, 0x25,
+  0x64, 0x6b, 0x42, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x10, 0x00, 0x21,
+  0x2c, 0x20, 0x10, 0x00, 0x06, 0x24, 0x00, 0x30, 0x74, 0x6f, 0x20, 0x6e,
+  0x0f, 0x97, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x28, 0x25, 0x64, 0x0e,
+  0x00, 0xb0, 0x6d, 0x61, 0x78, 0x29, 0x0a, 0x00, 0x45, 0x6e, 0x61, 0x62,
+  0x6c, 0x55, 0x0f, 0x41, 0x69, 0x6e, 0x74, 0x65, 0xe3, 0x0f, 0xa1, 0x73,
+  0x20, 0x2e, 0x2e, 0x2e, 0x20, 0x00, 0x6f, 0x6b, 0x2e, 0x63, 0x0f, 0x64,
+  0x72, 0x6f, 0x6f, 0x74, 0x00, 0x4d, 0x28, 0x10, 0x00, 0x0e, 0x00, 0x50,
+  0x20, 0x66, 0x73, 0x20, 0x28, 0x09, 0x00, 0x50, 0x5f, 0x64, 0x65, 0x76,
+  0x3d, 0xc0, 0x11, 0x70, 0x72, 0x25, 0x63, 0x29, 0x3a, 0x20, 0x00, 0x50,
+  0x0f, 0x90, 0x65, 0x64, 0x0a, 0x00, 0x4f, 0x4b, 0x0a, 0x00, 0xff, 0x00,
+  0x00
@@ -32,10 +32,19 @@ PinB<2> ZDA;
 PinB<4> ZCL;
 PinB<8> RST;
 
+#define ZDI_DMA 1 // stream readMem/writeMem data via DMA, see zdi-dma.h
 #include <zdi-util.h>
+#include <zdi-lz.h>
+#include <zdi-crc.h>
+#include <zdi-disk.h>
+#include <zdi-script.h>
+#include <uart-bridge.h>
 
-const uint8_t fuzix [] = {
-#include "fuzix.h"
+UartBridge bridge;
+
+// the kernel, packed by lzpack.py, see pack.py
+const uint8_t fuzixLz [] = {
+#include "fuzix-lz.h"
 };
 
 void zdiConfig () {
@@ -50,9 +59,7 @@ void zdiConfig () {
     ZCL.mode(Pinmode::out); // XXX out_50mhz
     ZDA.mode(Pinmode::out);
 
-    // no wait states for external ram (default is 7)
-    zIns(0x3E,0x08);        // ld a,08h
-    zIns(0xED, 0x39, 0xAA); // out0 (0AAh),a
+    zdiScript(zsNoWaits); // no wait states for external ram (default is 7)
 
     ezReset(); // seems to be required for robust startup in all situations?
 }
@@ -78,44 +85,92 @@ void diskSetup () {
 
 void ramDisk () {
     FileMap< decltype(fat), 49 > file (fat);
+    uint32_t t = ticks;
+
+    // only the 4 KB blocks which differ from what's in ram are sent
     int len = file.open("ROOTFS  IMG");
-    printf("<%d>", len);
+    if (len > 0) {
+        printf("<%d>", len);
+        int n = crcSync(file, len, 0x080000, 0x1000000);
+        if (n < 0)
+            printf("? ram disk mismatch\n");
+        printf("<%d blocks, %d ms>", n, ticks - t);
+        return;
+    }
 
-#if 1 // this takes ≈ 10s, can be skipped as long as RAM retains its contents
-    zCmd(0x08); // set ADL
-    uint8_t buf [512];
-    for (int pos = 0; pos < len; pos += 512) {
-        if (!file.ioSect(false, pos/512, buf))
-            printf("? fat map error at %d\n", pos);
-        writeMem(0x080000 + pos, buf, sizeof buf);
+    // a packed image is sent as is, and then unpacked by the eZ80 itself
+    len = file.open("ROOTFS  LZ4");
+    printf("<%d>", len);
+    if (len > 0) {
+        uint8_t buf [512];
+        zCmd(0x08); // set ADL
+        file.ioSect(false, 0, buf);
+        uint32_t src = lzStaging(0x080000, buf, len);
+        for (int pos = 0; pos < len; pos += 512) {
+            if (!file.ioSect(false, pos/512, buf))
+                printf("? fat map error at %d\n", pos);
+            writeMem(src + pos, buf, len - pos < 512 ? len - pos : 512);
+        }
+        // the on-chip ram is still at 0xFFE000
+        if (!lzUnpack(0x080000, src, 0x1000000))
+            printf("? ram disk unpack failed\n");
+        printf("<%d ms>", ticks - t);
     }
+}
+
+// a disk image which is served block by block while the eZ80 runs, the mailbox
+// and bell addresses must match those used by the driver on the eZ80 side, so
+// this stays off until there is such a driver: the bell is a ZDI breakpoint
+#ifndef BLOCK_DISK
+#define BLOCK_DISK 0 // 1 to serve BLOCKS.IMG, see zdi-disk.h
+#endif
+FileMap< decltype(fat), 25 > blocks (fat);
+DiskServer< decltype(blocks) > disk (blocks);
+
+void blockDisk () {
+#if BLOCK_DISK
+    int len = blocks.open("BLOCKS  IMG");
+    printf("<%d>", len);
+    if (len > 0)
+        disk.init(len, 0x00FFE0, 0x00FFF0);
 #endif
 }
 
-void romBoot () {
+// the ZDI steps of romBoot, see zdi-script.h
+static const uint8_t bootSetup [] = {
     // 2) enter ADL mode to switch to 24-bit addressing
-    zCmd(0x08); // set ADL
-
+    ZS_CMD, 0x08,                   // set ADL
     // 3) set MBASE now that we're in ADL mode
-    setMbase(0x00);
-
+    ZS_INS+2, 0x3E, 0x00,           // ld a,00h
+    ZS_INS+2, 0xED, 0x6D,           // ld mb,a
     // 4) disable ERAM and move SRAM to same bank as MBASE
-    zIns(0x3E, 0x80);       // ld a,80h
-    zIns(0xED, 0x39, 0xB4); // out0 (RAM_CTL),a ; disable ERAM
-    zIns(0x3E, 0x00);       // ld a,00h
-    zIns(0xED, 0x39, 0xB5); // out0 (RAM_BANK),a ; SRAM to 0x00E000
-
+    ZS_INS+2, 0x3E, 0x80,           // ld a,80h
+    ZS_INS+3, 0xED, 0x39, 0xB4,     // out0 (RAM_CTL),a ; disable ERAM
+    ZS_INS+2, 0x3E, 0x00,           // ld a,00h
+    ZS_INS+3, 0xED, 0x39, 0xB5,     // out0 (RAM_BANK),a ; SRAM to 0x00E000
     // 4A) move flash to high memory
-    zIns(0x3E, 0xF0);       // ld a,0F0h
-    zIns(0xED, 0x39, 0xF7); // out0 (FLASH_BANK),a ; FLASH to 0xF00000
+    ZS_INS+2, 0x3E, 0xF0,           // ld a,0F0h
+    ZS_INS+3, 0xED, 0x39, 0xF7,     // out0 (FLASH_BANK),a ; FLASH to 0xF00000
+    ZS_END
+};
+static const uint8_t bootStart [] = {
+    // 9) switch from ADL mode to Z80 mode and jump to SLOAD address
+    ZS_SET, 0x87, ZS_24(0x000100),  // PC = 000100h
+    ZS_CMD, 0x09,                   // reset ADL
+    ZS_OUT+1, 0x10, 0x00,           // continue
+    ZS_END
+};
 
-    // 8) load FUZIX to {0x00,0x0100}
-    writeMem(0x000100, fuzix, sizeof fuzix);
+void romBoot () {
+    zdiScript(bootSetup);
 
-    // 9) switch from ADL mode to Z80 mode and jump to SLOAD address
-    setPC(0x000100);
-    zCmd(0x09); // reset ADL
-    zdiOut(0x10, 0x00); // continue
+    // 8) load FUZIX to {0x00,0x0100}, unpacked there using the on-chip ram
+    uint32_t t = ticks;
+    if (!lzUpload(0x000100, fuzixLz, sizeof fuzixLz, 0x010000))
+        printf("? kernel unpack failed\n");
+    printf("<%d b %d ms>", (int) sizeof fuzixLz, ticks - t);
+
+    zdiScript(bootStart);
 }
 
 int main() {
@@ -150,15 +205,22 @@ int main() {
         printf("D"); diskSetup(); // prepare SD card access
         printf("A"); ramDisk();   // load ram disk from SD card
         printf("B"); romBoot();   // simulate rom bootstrap
+        printf("K"); blockDisk(); // serve disk blocks from SD card
     } else
         ezReset(true);
 
     printf("\n");
 
+    // from now on, the console and the eZ80's serial port are bridged by DMA
+    bridge.init(false); // true if the eZ80's RTS/CTS are wired to PA1/PA0
+
+    // disk requests are checked for on each wake-up, i.e. at least once per ms,
+    // and continuously for a while after each one, as more tend to follow
+    uint32_t last = 0;
     while (true) {
-        if (serial.readable())
-            console.putc(serial.getc());
-        if (console.readable())
-            serial.putc(console.getc());
+        if (disk.sects > 0 && disk.poll())
+            last = ticks;
+        else if (ticks - last > 10)
+            asm volatile ("wfi"); // the serial bridge runs in interrupts
     }
 }
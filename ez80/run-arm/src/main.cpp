@@ -27,6 +27,10 @@ PinB<4> ZCL;
 PinB<8> RST;
 
 #include <zdi-util.h>
+#include <zdi-script.h>
+#include <uart-bridge.h>
+
+UartBridge bridge;
 
 void zdiConfig () {
     XIN.mode(Pinmode::alt_out); // XXX alt_out_50mhz
@@ -41,6 +45,13 @@ void zdiConfig () {
     ZDA.mode(Pinmode::out);
 }
 
+// start running from flash
+static const uint8_t flashStart [] = {
+    ZS_SET, 0x87, ZS_24(0x000000),  // PC = 0, moved by the injected code
+    ZS_OUT+1, 0x10, 0x00,           // continue
+    ZS_END
+};
+
 int main() {
     console.init();
     serial.init();
@@ -57,18 +68,11 @@ int main() {
     zdiConfig();
     ezReset();
 
-    // no wait states for external ram (default is 7)
-    zIns(0x3E,0x08);        // ld a,08h
-    zIns(0xED, 0x39, 0xAA); // out0 (0AAh),a
-
-    // start running from flash
-    setPC(0x000000);        // PC was messed up by zIns
-    zdiOut(0x10, 0x00);     // continue
+    zdiScript(zsNoWaits); // no wait states for external ram (default is 7)
+    zdiScript(flashStart);
 
-    while (true) {
-        if (serial.readable())
-            console.putc(serial.getc());
-        if (console.readable())
-            serial.putc(console.getc());
-    }
+    // from now on, the console and the eZ80's serial port are bridged by DMA
+    bridge.init(false); // true if the eZ80's RTS/CTS are wired to PA1/PA0
+    while (true)
+        asm volatile ("wfi"); // all the work is done in interrupts
 }
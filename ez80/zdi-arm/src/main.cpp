@@ -34,6 +34,8 @@ PinB<8> RST;
 #define SLOW 0  // 0 or 40, for 4 or 36 MHz clocks (flash demo assumes 4 MHz)
 
 #include <zdi-util.h>
+#include <zdi-mtest.h>
+#include <zdi-script.h>
 
 // see embello/explore/1608-forth/ezr/asm/hello.asm
 const uint8_t hello [] = {
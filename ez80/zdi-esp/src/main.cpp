@@ -41,8 +41,12 @@ Pin<26> ZDA;
 Pin<27> RST;
 
 #define SLOW 200
+#define EZ_MHZ 4 // the XIN clock from ledcSetup below, used for ZDI timeouts
+#define ZDI_DMA 1 // stream readMem/writeMem data via GPIO registers, see zdi-dma.h
 
 #include <zdi-util.h>
+#include <zdi-mtest.h>
+#include <zdi-script.h>
 
 void setup() {
     Serial.begin(115200);
@@ -77,6 +81,34 @@ void loop() {
 
 #include <zdi-cmds.h>
 
+            case 'U': { // upload fuzix.bin from SPIFFS, read it back, time both
+                // into external ram, as in 'T', 0x000100 is the on-chip flash
+                constexpr uint32_t base = 0x200000;
+                File f = SPIFFS.open("/fuzix.bin");
+                uint8_t buf [512], chk [512];
+                uint32_t addr = base, wr = 0, rd = 0, bad = 0;
+                zCmd(0x08); // set ADL
+                while (f) {
+                    int n = f.read(buf, sizeof buf);
+                    if (n <= 0)
+                        break;
+                    uint32_t t = micros();
+                    writeMem(addr, buf, n);
+                    zdiIdle();
+                    wr += micros() - t;
+                    t = micros();
+                    readMem(addr, chk, n);
+                    rd += micros() - t;
+                    bad += memcmp(buf, chk, n) != 0;
+                    addr += n;
+                }
+                uint32_t len = addr - base;
+                printf("%u b: write %u us, %u KB/s, read %u us, %u KB/s, "
+                        "%u bad blocks\n", len, wr, wr ? len * 1000 / wr : 0,
+                        rd, rd ? len * 1000 / rd : 0, bad);
+                break;
+            }
+
             default: printf("?\n");
         }
 }
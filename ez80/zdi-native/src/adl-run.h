@@ -0,0 +1,184 @@
+// Runs eZ80 code in ADL mode, for the run hook of the ZDI model in zdi-sim.h
+//
+// This only implements the instructions used by the unpacker in zdi-lz.h, the
+// CRC code in zdi-crc.h, and the memory test in zdi-mtest.h, and only the Z and
+// C flags. The alternate register set is kept here, since the ZDI model has no
+// access to it. It stops when it reaches a "jr $" or a halt, or when it runs
+// into an instruction it doesn't know, which is counted as unknown. It also
+// stops at an address breakpoint, and then puts the model back in break mode.
+
+static uint32_t adlSteps; // number of instructions executed
+static uint32_t adlAlt [3]; // BC', DE', HL'
+
+static void adlRun (ZdiSim& sim) {
+    uint32_t bc = sim.regs[1], de = sim.regs[2], hl = sim.regs[3];
+    uint32_t ix = sim.regs[4], iy = sim.regs[5], sp = sim.regs[6], pc = sim.pc;
+    uint8_t a = sim.regs[0] >> 8;
+    bool z = sim.regs[0] & 0x40, c = sim.regs[0] & 0x01;
+
+    auto fetch = [&]() -> uint8_t { return sim.at(pc++); };
+    auto fetch24 = [&]() -> uint32_t {
+        uint32_t v = fetch(); v |= fetch() << 8; return v | (fetch() << 16);
+    };
+    auto push = [&](uint32_t v) {
+        sp -= 3;
+        sim.at(sp) = v; sim.at(sp+1) = v >> 8; sim.at(sp+2) = v >> 16;
+    };
+    auto pop = [&]() -> uint32_t {
+        uint32_t v = sim.at(sp) | (sim.at(sp+1) << 8) | (sim.at(sp+2) << 16);
+        sp += 3;
+        return v;
+    };
+
+    for (bool running = true; running; ++adlSteps) {
+        uint32_t at = pc;
+        if (sim.breakAt(pc)) {
+            sim.brk = true;
+            break;
+        }
+        uint8_t op = fetch();
+        switch (op) {
+            case 0x00: break;                                       // nop
+            case 0x01: bc = fetch24(); break;                       // ld bc,nn
+            case 0x03: bc = (bc + 1) & 0xFFFFFF; break;             // inc bc
+            case 0x0B: bc = (bc - 1) & 0xFFFFFF; break;             // dec bc
+            case 0x09: {                                            // add hl,bc
+                hl += bc; c = hl >> 24; hl &= 0xFFFFFF; break;
+            }
+            case 0x0D: bc = (bc & 0xFFFF00) | ((bc - 1) & 0xFF);     // dec c
+                       z = (bc & 0xFF) == 0; break;
+            case 0x0E: bc = (bc & 0xFFFF00) | fetch(); break;       // ld c,n
+            case 0x0F: c = a & 1; a = (a >> 1) | (a << 7); break;   // rrca
+            case 0x10: {                                            // djnz e
+                int8_t e = fetch();
+                bc = (bc & 0xFF00FF) | ((bc - 0x100) & 0xFF00);
+                if (bc & 0xFF00)
+                    pc += e;
+                break;
+            }
+            case 0x13: de = (de + 1) & 0xFFFFFF; break;             // inc de
+            case 0x18: {                                            // jr e
+                int8_t e = fetch(); pc += e;
+                running = pc != at; // stop at "jr $"
+                break;
+            }
+            case 0x20: { int8_t e = fetch(); if (!z) pc += e; break; } // jr nz,e
+            case 0x21: hl = fetch24(); break;                       // ld hl,nn
+            case 0x23: hl = (hl + 1) & 0xFFFFFF; break;             // inc hl
+            case 0x28: { int8_t e = fetch(); if (z) pc += e; break; } // jr z,e
+            case 0x24: hl += 0x100; break;                          // inc h
+            case 0x25: hl -= 0x100; break;                          // dec h
+            case 0x2E: hl = (hl & 0xFFFF00) | fetch(); break;       // ld l,n
+            case 0x3C: ++a; z = a == 0; break;                      // inc a
+            case 0x43: bc = (bc & 0xFF00FF) | ((de & 0xFF) << 8); break; // ld b,e
+            case 0x46: bc = (bc & 0xFF00FF) | (sim.at(hl) << 8); break; // ld b,(hl)
+            case 0x4E: bc = (bc & 0xFFFF00) | sim.at(hl); break;    // ld c,(hl)
+            case 0x4F: bc = (bc & 0xFFFF00) | a; break;             // ld c,a
+            case 0x51: de = (de & 0xFF00FF) | ((bc & 0xFF) << 8); break; // ld d,c
+            case 0x57: de = (de & 0xFF00FF) | (a << 8); break;      // ld d,a
+            case 0x59: de = (de & 0xFFFF00) | (bc & 0xFF); break;   // ld e,c
+            case 0x5D: de = (de & 0xFFFF00) | (hl & 0xFF); break;   // ld e,l
+            case 0x5F: de = (de & 0xFFFF00) | a; break;             // ld e,a
+            case 0x62: hl = (hl & 0xFF00FF) | (de & 0xFF00); break; // ld h,d
+            case 0x63: hl = (hl & 0xFF00FF) | ((de & 0xFF) << 8); break; // ld h,e
+            case 0x6F: hl = (hl & 0xFFFF00) | a; break;             // ld l,a
+            case 0x76: sim.halted = true; running = false; break;   // halt
+            case 0x78: a = bc >> 8; break;                          // ld a,b
+            case 0x7A: a = de >> 8; break;                          // ld a,d
+            case 0x7D: a = hl; break;                               // ld a,l
+            case 0x7E: a = sim.at(hl); break;                       // ld a,(hl)
+            case 0x81: c = a + (uint8_t) bc > 0xFF; a += bc; z = a == 0; break; // add a,c
+            case 0x84: c = a + (uint8_t) (hl >> 8) > 0xFF; a += hl >> 8;   // add a,h
+                       z = a == 0; break;
+            case 0xA8: a ^= bc >> 8; z = a == 0; c = false; break;  // xor b
+            case 0xA9: a ^= bc; z = a == 0; c = false; break;       // xor c
+            case 0xAA: a ^= de >> 8; z = a == 0; c = false; break;  // xor d
+            case 0xAB: a ^= de; z = a == 0; c = false; break;       // xor e
+            case 0xB1: a |= bc; z = a == 0; c = false; break;       // or c
+            case 0xB7: z = a == 0; c = false; break;                // or a
+            case 0xC0: if (!z) pc = pop(); break;                   // ret nz
+            case 0xC1: bc = pop(); break;                           // pop bc
+            case 0xC5: push(bc); break;                             // push bc
+            case 0xC9: pc = pop(); break;                           // ret
+            case 0xCD: { uint32_t t = fetch24(); push(pc); pc = t; break; } // call
+            case 0xD1: de = pop(); break;                           // pop de
+            case 0xD5: push(de); break;                             // push de
+            case 0xD9: {                                            // exx
+                uint32_t t;
+                t = bc; bc = adlAlt[0]; adlAlt[0] = t;
+                t = de; de = adlAlt[1]; adlAlt[1] = t;
+                t = hl; hl = adlAlt[2]; adlAlt[2] = t;
+                break;
+            }
+            case 0xE1: hl = pop(); break;                           // pop hl
+            case 0xE3: { uint32_t t = pop(); push(hl); hl = t; break; } // ex (sp),hl
+            case 0xE5: push(hl); break;                             // push hl
+            case 0xE6: a &= fetch(); z = a == 0; c = false; break;  // and n
+            case 0xF1: { uint32_t t = pop(); a = t >> 8; z = t & 0x40; c = t & 1;
+                         break; }                                   // pop af
+            case 0xF5: push((a << 8) | (z ? 0x40 : 0) | c); break;  // push af
+            case 0xFE: { uint8_t n = fetch(); z = a == n; c = a < n; break; } // cp n
+            case 0xDD: case 0xFD: {                                 // ix/iy
+                uint32_t& xy = op == 0xDD ? ix : iy;
+                switch (fetch()) {
+                    case 0x23: xy = (xy + 1) & 0xFFFFFF; break;     // inc xy
+                    case 0x70: sim.at(xy + (int8_t) fetch()) = bc >> 8; break;
+                    case 0x71: sim.at(xy + (int8_t) fetch()) = bc; break;
+                    case 0x72: sim.at(xy + (int8_t) fetch()) = de >> 8; break;
+                    case 0x73: sim.at(xy + (int8_t) fetch()) = de; break;
+                    case 0x77: sim.at(xy + (int8_t) fetch()) = a; break;
+                    case 0x7C: a = xy >> 8; break;                  // ld a,xyh
+                    case 0x7D: a = xy; break;                       // ld a,xyl
+                    case 0x7E: a = sim.at(xy + (int8_t) fetch()); break;
+                    case 0xBE: {                                    // cp (xy+d)
+                        uint8_t n = sim.at(xy + (int8_t) fetch());
+                        z = a == n; c = a < n;
+                        break;
+                    }
+                    case 0xE5: push(xy); break;                     // push xy
+                    default: running = false;
+                }
+                break;
+            }
+            case 0xED:
+                switch (fetch()) {
+                    case 0x42: {                                    // sbc hl,bc
+                        uint32_t r = hl - bc - c;
+                        c = r >> 24; hl = r & 0xFFFFFF; z = hl == 0;
+                        break;
+                    }
+                    case 0x4C: bc = (bc & 0xFF0000) | ((bc >> 8) & 0xFF) * (bc & 0xFF);
+                        break;                                      // mlt bc
+                    case 0x52: {                                    // sbc hl,de
+                        uint32_t r = hl - de - c;
+                        c = r >> 24; hl = r & 0xFFFFFF; z = hl == 0;
+                        break;
+                    }
+                    case 0x6C: hl = (hl & 0xFF0000) | ((hl >> 8) & 0xFF) * (hl & 0xFF);
+                        break;                                      // mlt hl
+                    case 0xB0:                                      // ldir
+                        do {
+                            sim.at(de) = sim.at(hl);
+                            de = (de + 1) & 0xFFFFFF;
+                            hl = (hl + 1) & 0xFFFFFF;
+                            bc = (bc - 1) & 0xFFFFFF;
+                        } while (bc != 0);
+                        break;
+                    default:
+                        running = false;
+                }
+                break;
+            default:
+                running = false;
+        }
+        if (!running && op != 0x18 && op != 0x76) {
+            ++sim.unknown;
+            pc = at;
+        }
+    }
+
+    sim.regs[0] = (sim.regs[0] & 0xFF0000) | (a << 8) | (z ? 0x40 : 0) | c;
+    sim.regs[1] = bc; sim.regs[2] = de; sim.regs[3] = hl;
+    sim.regs[4] = ix; sim.regs[5] = iy; sim.regs[6] = sp;
+    sim.pc = pc;
+}
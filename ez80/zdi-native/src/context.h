@@ -0,0 +1,23 @@
+#include "z80emu.h"
+#include <stdint.h>
+
+// z80emu state for instructions injected into the simulated eZ80, these are
+// fetched from the instruction store, all other accesses go to its memory
+
+typedef struct {
+    Z80_STATE state;
+    uint8_t   done;
+    uint32_t  base;     // MBASE, i.e. the upper 8 bits of each address
+    uint16_t  insAt;    // address of the injected instruction
+    uint8_t*  ins;      // its bytes, IS0..IS4
+} Context;
+
+extern uint8_t* ezMap (uint32_t addr);
+
+static inline uint8_t* mapMem (void* cp, uint16_t addr) {
+    Context* ctx = (Context*) cp;
+    uint16_t off = addr - ctx->insAt;
+    return off < 5 ? ctx->ins + off : ezMap(ctx->base | addr);
+}
+
+extern void systemCall (Context *ctx, int request, uint16_t pc);
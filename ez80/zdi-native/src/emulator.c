@@ -0,0 +1 @@
+#include "z80emu.c"
@@ -0,0 +1,586 @@
+// Host-side test of the ZDI code in ../common, against a model of the eZ80.
+//
+// This runs the same zdi-util.h code as the Wide Pill builds, but with the ZCL
+// and ZDA pin objects bound to a simulated chip, see zdi-sim.h. In the "dma"
+// build, the encoded BSRR words of the DMA transport are replayed into these
+// same pins, instead of being sent out by TIM2 and DMA1. Injected instructions
+// which the model does not decode itself are executed by the z80emu core.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+extern "C" {
+#include "context.h"
+#include "z80emu.h"
+}
+
+#include "zdi-sim.h"
+
+ZdiSim ez;
+
+uint8_t* ezMap (uint32_t addr) {
+    return &ez.at(addr);
+}
+
+void systemCall (Context*, int, uint16_t) {} // no traps, "in a,(n)" is a nop
+
+// run one instruction from the instruction store, with Z80 semantics, i.e.
+// 16-bit registers and addresses, in the 64 KB bank selected by MBASE
+static void z80Inject (ZdiSim& sim, uint8_t* ins) {
+    static Context ctx;
+    Z80Reset(&ctx.state); // also sets up its register decoding tables
+    auto& regs = ctx.state.registers;
+    regs.word[Z80_AF] = sim.regs[0];
+    regs.word[Z80_BC] = sim.regs[1];
+    regs.word[Z80_DE] = sim.regs[2];
+    regs.word[Z80_HL] = sim.regs[3];
+    regs.word[Z80_IX] = sim.regs[4];
+    regs.word[Z80_IY] = sim.regs[5];
+    regs.word[Z80_SP] = sim.regs[6];
+    ctx.state.pc = (uint16_t) sim.pc;
+    ctx.state.status = 0;
+    ctx.base = sim.mbase() << 16;
+    ctx.insAt = sim.pc;
+    ctx.ins = ins;
+
+    Z80Emulate(&ctx.state, 1, &ctx); // at least one, i.e. exactly one
+
+    static const int order [] = { Z80_AF, Z80_BC, Z80_DE, Z80_HL,
+                                  Z80_IX, Z80_IY, Z80_SP };
+    for (int i = 0; i < 7; ++i)
+        sim.regs[i] = (sim.regs[i] & 0xFF0000) | regs.word[order[i]];
+    sim.pc = (sim.pc & 0xFF0000) | (uint16_t) ctx.state.pc;
+}
+
+namespace Pinmode {
+    constexpr int in_pullup = 0;
+    constexpr int out = 1;
+}
+
+// stand-ins for the JeeH pin objects, bound to the simulated eZ80, the pin
+// numbers are those of the ESP32 board
+struct ZclPin {
+    static constexpr int pin = 25;
+    static void mode (int) {}
+    void operator= (int v) const { ez.clock(v); }
+};
+
+struct ZdaPin {
+    static constexpr int pin = 26;
+    static void mode (int m) { ez.drive(m == Pinmode::out); }
+    void operator= (int v) const { ez.data(v); }
+    operator int () const { return ez.read(); }
+};
+
+struct RstPin {
+    static void mode (int) {}
+    void operator= (int) const {}
+};
+
+ZclPin ZCL;
+ZdaPin ZDA;
+RstPin RST;
+
+void wait_ms (uint32_t) {}
+
+#if ESP32
+// the ESP32's GPIO set, clear, and input registers, as used by zdi-dma.h
+struct EspReg {
+    uint32_t addr;
+
+    void operator= (uint32_t v) const {
+        if (addr == 0x3FF4400C) { // GPIO_OUT_W1TC_REG
+            if (v & (1 << ZclPin::pin))
+                ez.clock(0);
+            if (v & (1 << ZdaPin::pin))
+                ez.data(0);
+        }
+        if (addr == 0x3FF44008) { // GPIO_OUT_W1TS_REG
+            if (v & (1 << ZdaPin::pin))
+                ez.data(1);
+            if (v & (1 << ZclPin::pin))
+                ez.clock(1);
+        }
+    }
+    operator uint32_t () const { // GPIO_IN_REG
+        return ez.read() << ZdaPin::pin;
+    }
+};
+
+#define MMIO32(a) EspReg {a}
+
+// a cycle counter which advances a little on each call
+struct { uint32_t getCycleCount () { return cycles += 5; } uint32_t cycles; } ESP;
+#endif
+
+#include <zdi-util.h>
+#include <zdi-lz.h>
+#include <zdi-crc.h>
+#include <zdi-mtest.h>
+#include <zdi-disk.h>
+#include <zdi-script.h>
+#include "adl-run.h"
+
+// the FUZIX kernel, raw and packed by lzpack.py, to check the unpacker with
+const uint8_t fuzix [] = {
+#include "../../fuzix-arm/src/fuzix.h"
+};
+const uint8_t fuzixLz [] = {
+#include "../../fuzix-arm/src/fuzix-lz.h"
+};
+
+#if ESP32
+constexpr uint32_t zclKhz = 240000 / (2*ZDI_HALF); // ZCL rate of the bursts
+#elif ZDI_DMA
+constexpr uint32_t zclKhz = 72000 / (2*ZDI_HALF);
+#endif
+
+#if ZDI_DMA && !ESP32
+// replay the encoded words into the pins, a falling ZCL goes first, so that a
+// data change in the same word can't be mistaken for a START condition
+void zdiStream (uint32_t const* words, int count, uint8_t* samples) {
+    for (int i = 0; i < count; ++i) {
+        uint32_t w = words[i];
+        if (w & ZCL_LO)
+            ez.clock(0);
+        if (w & (ZDA_LO | ZDA_HI))
+            ez.data((w & ZDA_HI) != 0);
+        if (w & ZCL_HI)
+            ez.clock(1);
+        if (samples)
+            samples[i] = ez.read() << ZDA_BIT;
+    }
+}
+
+void zdiStreamWait () {}
+#endif
+
+static int failures;
+
+// a disk image in memory, with the same ioSect() call as JeeH's FileMap
+struct ImageFile {
+    uint8_t* data;
+    int len;
+    uint32_t reads, writes;     // number of sectors, i.e. SD card accesses
+
+    bool ioSect (bool wr, int sect, uint8_t* buf) {
+        int n = len - 512*sect < 512 ? len - 512*sect : 512;
+        if (wr) {
+            memcpy(data + 512*sect, buf, n);
+            ++writes;
+        } else {
+            memcpy(buf, data + 512*sect, n);
+            ++reads;
+        }
+        return true;
+    }
+};
+
+static void check (bool ok, char const* what, unsigned len =0) {
+    if (!ok) {
+        printf("  %s failed, length %u\n", what, len);
+        ++failures;
+    }
+}
+
+// the start of fuzix-arm's bring-up, i.e. zdiConfig and controlCheck
+static void bootConfig () {
+    zIns(0x3E,0x08);        // ld a,08h
+    zIns(0xED, 0x39, 0xAA); // out0 (0AAh),a
+    zdiOut(0x10, 0x80); // break
+    zCmd(0x08); // set ADL
+    zdiIn(3);
+}
+
+// the rest of it, in romBoot, done with separate calls as it used to be
+static void bootCalls () {
+    zCmd(0x08); // set ADL
+    setMbase(0x00);
+    zIns(0x3E, 0x80);       // ld a,80h
+    zIns(0xED, 0x39, 0xB4); // out0 (RAM_CTL),a ; disable ERAM
+    zIns(0x3E, 0x00);       // ld a,00h
+    zIns(0xED, 0x39, 0xB5); // out0 (RAM_BANK),a ; SRAM to 0x00E000
+    zIns(0x3E, 0xF0);       // ld a,0F0h
+    zIns(0xED, 0x39, 0xF7); // out0 (FLASH_BANK),a ; FLASH to 0xF00000
+}
+
+static void bootStartCalls () {
+    setPC(0x000100);
+    zCmd(0x09); // reset ADL
+    zdiOut(0x10, 0x00); // continue
+}
+
+// the same, as the scripts in fuzix-arm
+static const uint8_t bootSetup [] = {
+    ZS_CMD, 0x08,                   // set ADL
+    ZS_INS+2, 0x3E, 0x00,           // ld a,00h
+    ZS_INS+2, 0xED, 0x6D,           // ld mb,a
+    ZS_INS+2, 0x3E, 0x80,           // ld a,80h
+    ZS_INS+3, 0xED, 0x39, 0xB4,     // out0 (RAM_CTL),a ; disable ERAM
+    ZS_INS+2, 0x3E, 0x00,           // ld a,00h
+    ZS_INS+3, 0xED, 0x39, 0xB5,     // out0 (RAM_BANK),a ; SRAM to 0x00E000
+    ZS_INS+2, 0x3E, 0xF0,           // ld a,0F0h
+    ZS_INS+3, 0xED, 0x39, 0xF7,     // out0 (FLASH_BANK),a ; FLASH to 0xF00000
+    ZS_END
+};
+static const uint8_t bootStart [] = {
+    ZS_SET, 0x87, ZS_24(0x000100),  // PC = 000100h
+    ZS_CMD, 0x09,                   // reset ADL
+    ZS_OUT+1, 0x10, 0x00,           // continue
+    ZS_END
+};
+
+// bring-up from reset to a running kernel, returns the number of ZCL clocks,
+// with the clocks of the kernel upload and the number of transfers without it
+static uint32_t bringUp (bool script, uint32_t& upload, uint32_t& starts) {
+    ez.run = 0; // the kernel can't run here
+    ez.reset();
+    memset(ez.io, 0, sizeof ez.io);
+    uint32_t t = ez.clocks;
+    starts = ez.starts;
+    bootConfig();
+    if (script)
+        check(zdiScript(bootSetup) == 0, "bootSetup");
+    else
+        bootCalls();
+    ez.run = adlRun;
+    upload = ez.clocks;
+    uint32_t s = ez.starts;
+    check(lzUpload(0x000100, fuzixLz, sizeof fuzixLz, 0x010000), "boot upload");
+    upload = ez.clocks - upload;
+    starts += ez.starts - s;
+    ez.run = 0;
+    if (script)
+        check(zdiScript(bootStart) == 0, "bootStart");
+    else
+        bootStartCalls();
+    starts = ez.starts - starts;
+    check(ez.io[0xAA] == 0x08 && ez.io[0xB4] == 0x80 && ez.io[0xB5] == 0x00 &&
+            ez.io[0xF7] == 0xF0 && ez.mbase() == 0x00 && !ez.adl && !ez.brk &&
+            ez.pc == 0x000100, "bring-up state", script);
+    check(memcmp(ez.mem + 0x100, fuzix, sizeof fuzix) == 0, "booted kernel");
+    return ez.clocks - t;
+}
+
+// ZDI clocks per byte, times 10, for a write and a read burst of len bytes
+static void benchmark (unsigned len) {
+    static uint8_t buf [4096];
+    uint32_t t = ez.clocks;
+    writeMem(0x080000, buf, len);
+    zdiIdle();
+    uint32_t wr = ez.clocks - t;
+    t = ez.clocks;
+    readMem(0x080000, buf, len);
+    uint32_t rd = ez.clocks - t;
+    printf("%6u b: write %5u.%u, read %5u.%u clocks/byte",
+            len, wr / len, wr * 10 / len % 10, rd / len, rd * 10 / len % 10);
+#if ZDI_DMA
+    printf(", i.e. %4u and %4u KB/s", zclKhz * len / wr, zclKhz * len / rd);
+#endif
+    printf("\n");
+}
+
+int main () {
+#if ESP32
+    printf("ZDI transport: ESP32 GPIO registers, ZCL at %u kHz\n", zclKhz);
+#elif ZDI_DMA
+    printf("ZDI transport: DMA, ZCL at %u kHz\n", zclKhz);
+#else
+    printf("ZDI transport: bit-banged\n");
+#endif
+    ez.fallback = z80Inject;
+
+    // the same start-up checks as in cpm2-arm and fuzix-arm
+    uint32_t version = (zdiIn(1) << 16) | (zdiIn(0) << 8) | zdiIn(2);
+    check(version == 0x000802, "version");
+    zdiOut(0x10, 0x80); // break
+    zCmd(0x08); // set ADL
+    check(zdiIn(3) == 0x90, "break + ADL status");
+
+    // bursts of all sorts of sizes and alignments, including chunk edges
+    static uint8_t wrBuf [4096], rdBuf [4096];
+    seedBuf(12345, 0xFF, wrBuf, sizeof wrBuf);
+    static const unsigned sizes [] = { 1, 2, 15, 16, 17, 31, 32, 33, 512, 4096 };
+    uint32_t addr = 0x080000;
+    for (unsigned len : sizes) {
+        writeMem(addr, wrBuf, len);
+        zdiIdle();
+        check(memcmp(ez.mem + addr, wrBuf, len) == 0, "writeMem", len);
+        memset(rdBuf, 0, len);
+        readMem(addr, rdBuf, len);
+        check(memcmp(rdBuf, wrBuf, len) == 0, "readMem", len);
+        addr += len + 3; // keep changing the alignment
+    }
+
+    // registers
+    setPC(0x123456);
+    check(getPC() == 0x123456, "setPC + getPC");
+
+    // register writes and reads, as used by dumpReg
+    for (int i = 1; i < 7; ++i) {
+        zdiOut(0x13, i);
+        zdiOut(0x14, 0x10 + i);
+        zdiOut(0x15, 0x20 + i);
+        zCmd(0x80 + i);
+    }
+    for (unsigned i = 1; i < 7; ++i) {
+        zCmd(i);
+        uint32_t v = zdiIn(0x10) | (zdiIn(0x11) << 8) | (zdiIn(0x12) << 16);
+        check(v == ((0x20 + i) << 16 | (0x10 + i) << 8 | i), "register", i);
+    }
+
+    // instruction injection, as in the 'N' command and setMbase
+    zIns(0x3E,0x08);        // ld a,08h
+    zIns(0xED, 0x39, 0xAA); // out0 (0AAh),a
+    check(ez.io[0xAA] == 0x08, "out0");
+    setMbase(0x20);
+    check(getMbase() == 0x20, "setMbase in ADL mode");
+    zCmd(0x09); // reset ADL
+    setMbase(0x40);
+    check(getMbase() == 0x20, "setMbase in Z80 mode");
+
+    // in Z80 mode, the PC is 16 bits and memory access stays in MBASE's bank
+    setPC(0x12FFFF);
+    check(getPC() == 0x20FFFF, "setPC in Z80 mode");
+    static const uint8_t two [] = { 0x11, 0x22 };
+    writeMem(0x12FFFF, two, sizeof two); // U is replaced by MBASE
+    zdiIdle();
+    check(ez.mem[0x20FFFF] == 0x11 && ez.mem[0x200000] == 0x22, "Z80 wrap");
+
+    // instructions not decoded by the model go to z80emu, still in Z80 mode
+    setPC(0x001000);
+    zIns(0x21, 0x34, 0x12); // ld hl,1234h
+    zIns(0x3E, 0x5A);       // ld a,5Ah
+    zIns(0x77);             // ld (hl),a
+    check(ez.mem[0x201234] == 0x5A, "ld (hl),a via z80emu");
+    check(getPC() == 0x201006, "PC after injected instructions");
+    check(ez.unknown == 0, "all injected instructions executed");
+
+    // memory size detection and address lines, with mirrored external ram
+    zCmd(0x08); // set ADL
+    for (uint32_t kb = 512; kb <= 2048; kb *= 2) {
+        ez.extSize = kb << 10;
+        check(memSizer() == (int) kb, "memSizer", kb);
+        uint32_t bad = memAddrTest(0x800000, 0x200000);
+        check(bad == (0x1FFC00 & ~((kb << 10) - 1)), "memAddrTest", kb);
+    }
+    ez.extSize = 0;
+    check(memAddrTest(0x800000, 0x200000) == 0, "memAddrTest");
+
+    // halt, continue, break, and reset
+    zIns(0x76); // halt
+    check(zdiIn(3) == 0xB0, "halt status");
+    zdiOut(0x10, 0x00); // continue
+    check(zdiIn(3) == 0x30, "continue status");
+    setPC(0xFFE000); // ignored, not in break mode
+    zdiOut(0x10, 0x80); // break
+    check(getPC() != 0xFFE000, "setPC while running");
+    zdiOut(0x11, 0x80); // reset
+    check(zdiIn(3) == 0x80 && getPC() == 0, "reset");
+    zCmd(0x08); // set ADL
+
+    // upload the packed kernel as in fuzix-arm's romBoot, and unpack it there
+    ez.run = adlRun;
+    uint32_t t = ez.clocks;
+    writeMem(0x000100, fuzix, sizeof fuzix);
+    zdiIdle();
+    uint32_t raw = ez.clocks - t;
+    memset(ez.mem, 0, 0x10000);
+    t = ez.clocks;
+    bool ok = lzUpload(0x000100, fuzixLz, sizeof fuzixLz, 0x010000);
+    uint32_t packed = ez.clocks - t;
+    check(ok && ez.unknown == 0, "lzUpload");
+    check(memcmp(ez.mem + 0x100, fuzix, sizeof fuzix) == 0, "unpacked kernel");
+    printf("kernel: %u bytes in %u clocks, packed %u bytes in %u clocks, "
+           "%u instructions\n", (unsigned) sizeof fuzix, raw,
+           (unsigned) sizeof fuzixLz, packed, adlSteps);
+
+    // block CRCs computed by the eZ80, including a short odd-sized block
+    crcLoad(0x1000000);
+    uint32_t crcs [10];
+    ok = crcRun(0x000100, 4096, 10, crcs, 0x1000000);
+    for (int i = 0; i < 10; ++i)
+        ok = ok && crcs[i] == crc32(0, fuzix + 4096*i, 4096);
+    check(ok && crcRun(0x000100, 75, 1, crcs, 0x1000000) &&
+            crcs[0] == crc32(0, fuzix, 75), "crcRun");
+
+    // the same ram disk sync as in cpm2-arm and fuzix-arm, a 300 KB image
+    static uint8_t disk [300*1024 + 100];
+    seedBuf(54321, 0xFF, disk, sizeof disk);
+    ImageFile image { disk, sizeof disk };
+    uint8_t* past = ez.mem + 0x080000 + sizeof disk; // must be left alone
+    memset(past, 0xA5, 4096);
+    const char* what [] = { "cold", "warm", "1 byte changed" };
+    for (int i = 0; i < 3; ++i) {
+        if (i == 2)
+            ++ez.mem[0x080000 + 123456];
+        t = ez.clocks;
+        uint32_t s = adlSteps;
+        int n = crcSync(image, image.len, 0x080000, 0x1000000);
+        printf("ram disk sync, %s: %d blocks written, %u clocks, "
+               "%u instructions\n", what[i], n, ez.clocks - t, adlSteps - s);
+        check(n == (i == 0 ? 76 : i == 1 ? 0 : 1), "crcSync", i);
+        check(memcmp(ez.mem + 0x080000, disk, sizeof disk) == 0, "ram disk", i);
+        check(past[0] == 0xA5 && memcmp(past, past + 1, 4095) == 0,
+                "past ram disk", i);
+    }
+
+    // the same memory test as the 'T' command, on 128 KB, run by the eZ80
+    t = ez.clocks;
+    uint32_t s = adlSteps;
+    check(memoryTest(0x200000, 0x20000), "memoryTest", 0x20000);
+    printf("memory test, 128 KB: %u clocks, %u instructions\n",
+            ez.clocks - t, adlSteps - s);
+    seedBuf(2*0xFF, 0xFF, disk, 0x10000); // the last bank, as made by seedBuf
+    check(memcmp(ez.mem + 0x210000, disk, 0x10000) == 0, "memoryTest data");
+    uint32_t bad;
+    t = ez.clocks;
+    check(memPassZdi(0x200000, 0x20000, 1, 0xFF, true, bad) &&
+            memPassZdi(0x200000, 0x20000, 1, 0xFF, false, bad), "memPassZdi");
+    printf("memory test over ZDI, 128 KB: %u clocks\n", ez.clocks - t);
+
+    // a bad bit must be found, at the same place as over ZDI, as in 'B'
+    check(memPassRun(0x200000, 0x1000, 0x10, 0x10, true, bad), "fill", 0x1000);
+    ez.mem[0x200ABC] ^= 0x10;
+    check(!memPassRun(0x200000, 0x1000, 0x10, 0x10, false, bad) &&
+            bad == 0x200ABC, "memPassRun fault");
+    check(!memPassZdi(0x200000, 0x1000, 0x10, 0x10, false, bad) &&
+            bad == 0x200ABC, "memPassZdi fault");
+    printf("injected fault, shown as in the 'B' command:\n");
+    memShowFail(0x200000, bad, 0x10, 0x10);
+    check(memoryTest(0xFFF000, 0x1000, 0x10), "memoryTest on-chip", 0x1000);
+
+    // a stalled eZ80 is a timeout, not a mismatch at whatever IX points to
+    ez.run = 0;
+    check(!memPassRun(0x200000, 0x1000, 0x10, 0x10, false, bad) &&
+            bad == MT_TIMEOUT, "memPassRun timeout");
+    check(!memoryTest(0x200000, 0x1000), "memoryTest timeout");
+    ez.run = adlRun;
+    check(ez.unknown == 0, "all code executed");
+
+    // the block server, with a minimal ADL-mode driver which calls the bell
+    constexpr uint32_t MBOX = 0x00FFE0, BELL = 0x00FFF0, CODE = 0x00F000;
+    static const uint8_t driver [] = {
+        0xCD, BELL & 0xFF, (BELL >> 8) & 0xFF, BELL >> 16, // call bell
+        0x18, 0xFE,                                         // jr $
+    };
+    seedBuf(777, 0xFF, disk, sizeof disk);
+    image = { disk, 256*1024 };
+    DiskServer< ImageFile > server (image);
+    writeMem(CODE, driver, sizeof driver);
+    setPC(CODE + 4); // the driver's "jr $", i.e. idle
+    server.init(image.len, MBOX, BELL);
+
+    // send one request, serve it, and check that the driver continued after
+    // its call, returns the status, and the ZDI clocks taken by poll() in t
+    auto request = [&](uint8_t cmd, int count, uint32_t block, uint32_t addr,
+                        uint32_t crc) -> int {
+        uint8_t req [DISK_REQ] = { cmd, (uint8_t) count };
+        for (int i = 0; i < 4; ++i) {
+            req[DISK_BLOCK+i] = block >> (8*i);
+            req[DISK_ADDR+i] = (addr >> (8*i)) & (i < 3 ? 0xFF : 0);
+            req[DISK_CRCS+i] = crc >> (8*i);
+        }
+        zdiOut(0x10, 0x80); // break
+        writeMem(MBOX, req, sizeof req);
+        setReg(0x86, CODE); // SP
+        setPC(CODE);
+        zdiOut(0x10, 0x08); // continue, runs up to the bell
+        check(ez.brk && ez.pc == BELL, "driver at bell");
+        t = ez.clocks;
+        check(server.poll(), "poll");
+        t = ez.clocks - t;
+        check(!ez.brk && ez.pc == CODE + 4 && ez.regs[6] == CODE &&
+                ez.mem[MBOX+DISK_CMD] == 0, "driver continued");
+        return ez.mem[MBOX+DISK_STATUS];
+    };
+
+    auto report = [&](char const* what, unsigned len) {
+        printf("disk %s: %6u clocks", what, t);
+#if ZDI_DMA
+        printf(", %5u us, %4u KB/s", t * 1000 / zclKhz, zclKhz * len / t);
+#endif
+        printf(", %u SD reads\n", image.reads);
+        image.reads = 0;
+    };
+
+    t = ez.clocks;
+    check(!server.poll(), "poll while idle");
+    printf("disk poll while idle: %u clocks\n", ez.clocks - t);
+
+    // reads, from the SD card and then from the cache
+    check(request('R', 1, 10, 0x090000, 0) == DISK_OK, "read 512");
+    check(memcmp(ez.mem + 0x090000, disk + 10*512, 512) == 0, "read data");
+    check(crc32(0, disk + 10*512, 512) == (ez.mem[MBOX+DISK_CRCS] |
+            ez.mem[MBOX+DISK_CRCS+1] << 8 | ez.mem[MBOX+DISK_CRCS+2] << 16 |
+            (uint32_t) ez.mem[MBOX+DISK_CRCS+3] << 24), "read CRC");
+    report("read  512 b, miss", 512);
+    check(request('R', 1, 10, 0x090200, 0) == DISK_OK, "read 512 cached");
+    check(memcmp(ez.mem + 0x090200, disk + 10*512, 512) == 0, "cached data");
+    report("read  512 b, hit ", 512);
+    check(request('R', 8, 100, 0x091000, 0) == DISK_OK, "read 4K");
+    check(memcmp(ez.mem + 0x091000, disk + 100*512, 4096) == 0, "4K data");
+    report("read   4 KB, miss", 4096);
+    check(request('R', 8, 100, 0x092000, 0) == DISK_OK, "read 4K cached");
+    check(memcmp(ez.mem + 0x092000, disk + 100*512, 4096) == 0, "4K cached");
+    report("read   4 KB, hit ", 4096);
+    check(request('R', 64, 300, 0x0A0000, 0) == DISK_OK, "read 32K");
+    check(memcmp(ez.mem + 0x0A0000, disk + 300*512, 32768) == 0, "32K data");
+    report("read  32 KB, miss", 32768);
+
+    // writes go through to the image, and are then read back from the cache
+    seedBuf(4321, 0xFF, ez.mem + 0x0B0000, 4096);
+    uint32_t crc = crc32(0, ez.mem + 0x0B0000, 4096);
+    check(request('W', 1, 200, 0x0B0000, crc32(0, ez.mem + 0x0B0000, 512))
+            == DISK_OK, "write 512");
+    report("write 512 b      ", 512);
+    check(request('W', 8, 200, 0x0B0000, crc) == DISK_OK, "write 4K");
+    report("write  4 KB      ", 4096);
+    check(memcmp(disk + 200*512, ez.mem + 0x0B0000, 4096) == 0, "write data");
+    check(image.writes == 9, "write-through", image.writes);
+    check(request('R', 8, 200, 0x0C0000, 0) == DISK_OK &&
+            memcmp(ez.mem + 0x0C0000, disk + 200*512, 4096) == 0 &&
+            image.reads == 0, "read back");
+    image.reads = 0;
+
+    // bad requests
+    check(request('W', 1, 200, 0x0B0000, crc) == DISK_CRC, "bad CRC");
+    check(request('R', 2, 511, 0x0C0000, 0) == DISK_BAD, "past the end");
+    check(request('R', 0, 0, 0x0C0000, 0) == DISK_BAD, "no blocks");
+    check(request('X', 1, 0, 0x0C0000, 0) == DISK_BAD, "bad command");
+    check(server.reqs == 12 && server.errors == 4 && server.hits == 17,
+            "server totals", server.hits);
+    check(ez.unknown == 0, "all driver code executed");
+
+    // bring-up of fuzix-arm, from reset to running the kernel
+    static const uint8_t regScript [] = {
+        ZS_SET, 0x84, ZS_24(0x123456),  // IX = 123456h
+        ZS_INS+2, 0xDD, 0x23,           // inc ix, via z80emu in Z80 mode
+        ZS_GET, 0x04,                   // IX
+        ZS_GET, 0x07,                   // PC
+        ZS_END
+    };
+    uint32_t regs [2];
+    zdiOut(0x10, 0x80); // break
+    zCmd(0x09); // reset ADL
+    setPC(0x001000);
+    check(zdiScript(regScript, regs) == 2 && regs[0] == 0x123457 &&
+            (regs[1] & 0xFFFF) == 0x1002, "zdiScript registers");
+    static const uint8_t badScript [] = { ZS_INS+6, ZS_END };
+    check(zdiScript(badScript) == -1, "bad script");
+    for (int i = 0; i < 2; ++i) {
+        uint32_t upload, starts, clocks = bringUp(i, upload, starts);
+        printf("bring-up, %s: %u clocks, %u for the upload, "
+                "%u clocks in %u transfers for the rest\n",
+                i ? "script" : "calls ", clocks, upload, clocks - upload, starts);
+    }
+
+    // ZDI clocks per byte, including setPC and framing
+    static const unsigned lengths [] = { 1, 16, 256, 4096 };
+    for (unsigned len : lengths)
+        benchmark(len);
+
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures != 0;
+}
@@ -0,0 +1,309 @@
+// Pin-level model of the eZ80's ZDI interface, for testing ZDI code on a host
+//
+// The ZCL and ZDA pin objects of a native build call clock(), data(), and
+// drive() on each change, and read() to sample ZDA. Transfers are decoded the
+// same way as on the chip: a START is ZDA going low while ZCL is high, then 7
+// address bits plus a read/write bit, and then any number of data bytes, each
+// followed by a separator bit. Bits are sampled on the rising edge of ZCL, and
+// read data is driven after the falling edge. The register address advances
+// after each data byte, except for memory access through 0x20 and 0x30.
+//
+// Memory reads pre-increment the PC, and the first byte of each 0x20 burst is
+// the stale contents of the data latch, which is why readMem starts one byte
+// early and discards the first byte it reads (see p.255 of the eZ80 manual).
+//
+// Register commands, instruction injection, and memory access only work while
+// the CPU is in break mode, as on the chip. In Z80 mode, memory addresses are
+// {MBASE,PC[15:0]} and the PC wraps around within that 64 KB bank. Injected
+// instructions are executed when IS0 (0x25) is written. Only the few which the
+// ZDI code in ../common uses are decoded here, anything else is passed to the
+// fallback hook, if set, and counted as unknown otherwise. Code only runs when
+// break mode is left and a run hook has been set, the CPU stays stopped if not.
+// The run hook has to check breakAt() before each instruction, and go back into
+// break mode on a match, for the address breakpoints in ZDI_ADDR0..3.
+
+struct ZdiSim {
+    uint8_t mem [1<<24];    // 24-bit address space
+    uint8_t io [256];       // on-chip peripheral registers, for in0 and out0
+    uint32_t regs [7];      // {MBASE,A,F}, BC, DE, HL, IX, IY, SP, see zCmd
+    uint32_t pc;            // also used as address for memory access
+    bool brk;               // in break mode, i.e. stopped and under ZDI control
+    bool adl;               // in ADL mode, i.e. using 24-bit addresses
+    bool halted;            // a halt instruction has been executed
+    uint32_t extSize;       // external ram is mirrored at this size, if set
+    uint8_t wrData [3];     // ZDI_WR_L/H/U, data for the next write command
+    uint8_t rdData [3];     // ZDI_RD_L/H/U, result of the last read command
+    uint8_t latch;          // memory data latch, see the note above
+    uint8_t brkCtl;         // ZDI_BRK_CTL, as last written
+    uint32_t brkAddr [4];   // ZDI_ADDR0..3, the address breakpoints
+    uint32_t clocks;        // number of ZCL rising edges so far
+    uint32_t starts;        // number of START conditions so far
+    uint32_t unknown;       // number of injected instructions not executed
+
+    // called for injected instructions which are not decoded here
+    void (*fallback) (ZdiSim& sim, uint8_t* ins);
+    // called when leaving break mode, to run code up to where it loops or halts
+    void (*run) (ZdiSim& sim);
+
+    ZdiSim () : zcl (true), zda (true), driven (true), phase (Idle), out (-1) {
+        reset();
+    }
+
+    // the state after a reset, with ZDA low so that the CPU starts in break
+    void reset () {
+        memset(io, 0, sizeof io);
+        memset(regs, 0, sizeof regs);
+        memset(brkAddr, 0, sizeof brkAddr);
+        pc = 0;
+        brkCtl = 0x80;
+        brk = true;
+        adl = halted = false;
+    }
+
+    uint8_t mbase () const { return regs[0] >> 16; }
+    uint8_t a () const { return regs[0] >> 8; }
+
+    // the ZDI_STAT register
+    uint8_t stat () const {
+        return (brk ? 0x80 : 0) | (halted ? 0x20 : 0) | (adl ? 0x10 : 0);
+    }
+
+    // external ram from 0x800000 up repeats every extSize bytes, as with only
+    // the low address lines wired up, this is what memSizer looks for
+    uint8_t& at (uint32_t addr) {
+        addr &= 0xFFFFFF;
+        if (extSize > 0 && 0x800000 <= addr && addr < 0xFFC000)
+            addr = 0x800000 + ((addr - 0x800000) & (extSize - 1));
+        return mem[addr];
+    }
+
+    // true if an enabled address breakpoint matches, see BRK_ADDR0..3
+    bool breakAt (uint32_t addr) const {
+        for (int i = 0; i < 4; ++i)
+            if ((brkCtl & (0x08 << i)) && brkAddr[i] == (addr & 0xFFFFFF))
+                return true;
+        return false;
+    }
+
+    // the master changes ZCL
+    void clock (bool level) {
+        if (level == zcl)
+            return;
+        zcl = level;
+        if (zcl)
+            rising();
+        else
+            falling();
+    }
+
+    // the master changes ZDA (when it's an input, this only selects the pull)
+    void data (bool level) {
+        bool was = line();
+        zda = level;
+        checkStart(was);
+    }
+
+    // the master switches ZDA between output and input
+    void drive (bool output) {
+        bool was = line();
+        driven = output;
+        checkStart(was);
+    }
+
+    // the master samples ZDA, the board has a pull-up which wins if undriven
+    bool read () const {
+        return line();
+    }
+
+private:
+    bool zcl, zda, driven;  // pin states as set by the master
+    enum { Idle, Addr, Data } phase;
+    int bits;               // bits done in the current byte, incl separator
+    uint8_t shift;          // byte being shifted in or out
+    uint8_t reg;            // current register address
+    bool rd;                // this is a read transfer
+    int out;                // bit driven by the eZ80, or -1 if none
+    uint32_t memStart;      // START count of the current memory read burst
+    uint8_t is [5];         // instruction store, IS0..IS4
+
+    bool line () const {
+        return driven ? zda : out >= 0 ? out : 1;
+    }
+
+    void checkStart (bool was) {
+        if (driven && zcl && was && !line()) {
+            ++starts;
+            phase = Addr;
+            bits = 0;
+            out = -1;
+        }
+    }
+
+    void rising () {
+        ++clocks;
+        switch (phase) {
+            case Idle:
+                break;
+            case Addr:
+                if (bits < 8)
+                    shift = (shift << 1) | zda;
+                if (++bits == 9) { // after the separator
+                    reg = shift >> 1;
+                    rd = shift & 1;
+                    phase = Data;
+                    bits = 0;
+                }
+                break;
+            case Data:
+                if (!rd && bits < 8) {
+                    shift = (shift << 1) | zda;
+                    if (bits == 7)
+                        writeReg(shift);
+                }
+                if (++bits == 9)
+                    bits = 0; // separators are not used to end a transfer
+                break;
+        }
+    }
+
+    void falling () {
+        if (phase == Data && rd) {
+            if (bits == 0)
+                shift = readReg();
+            out = bits < 8 ? (shift >> (7 - bits)) & 1 : -1;
+        }
+    }
+
+    // advance the PC by one, within the current 64 KB bank in Z80 mode
+    void nextPC () {
+        pc = adl ? (pc + 1) & 0xFFFFFF : (pc & 0xFF0000) | ((pc + 1) & 0xFFFF);
+    }
+
+    void writeReg (uint8_t val) {
+        switch (reg) {
+            case 0x00: case 0x01: case 0x02: // ZDI_ADDR0_L/H/U
+            case 0x04: case 0x05: case 0x06: // ZDI_ADDR1_L/H/U
+            case 0x08: case 0x09: case 0x0A: // ZDI_ADDR2_L/H/U
+            case 0x0C: case 0x0D: case 0x0E: { // ZDI_ADDR3_L/H/U
+                int shift = 8 * (reg & 3);
+                uint32_t& a = brkAddr[reg >> 2];
+                a = (a & ~(0xFF << shift)) | (val << shift);
+                break;
+            }
+            case 0x10: // ZDI_BRK_CTL
+                brkCtl = val;
+                if (val & 0x80)
+                    brk = true;
+                else if (brk) {
+                    brk = false;
+                    if (run)
+                        run(*this); // may end in break, at a breakpoint
+                }
+                break;
+            case 0x11: // ZDI_MASTER_CTL
+                if (val & 0x80)
+                    reset();
+                break;
+            case 0x13: case 0x14: case 0x15: // ZDI_WR_L/H/U
+                wrData[reg-0x13] = val;
+                break;
+            case 0x16: // ZDI_RW_CTL
+                command(val);
+                break;
+            case 0x21: case 0x22: case 0x23: case 0x24: case 0x25: // ZDI_ISn
+                is[0x25-reg] = val;
+                if (reg == 0x25)
+                    inject();
+                break;
+            case 0x30: // ZDI_WR_MEM
+                if (brk) {
+                    at(pc) = latch = val;
+                    nextPC();
+                }
+                return; // no auto-increment
+        }
+        ++reg;
+    }
+
+    uint8_t readReg () {
+        uint8_t val = 0;
+        switch (reg) {
+            case 0x00: val = 0x08; break; // ZDI_ID_L
+            case 0x01: val = 0x00; break; // ZDI_ID_H
+            case 0x02: val = 0x02; break; // ZDI_ID_REV
+            case 0x03: val = stat(); break; // ZDI_STAT
+            case 0x10: case 0x11: case 0x12: // ZDI_RD_L/H/U
+                val = rdData[reg-0x10];
+                break;
+            case 0x20: // ZDI_RD_MEM
+                if (starts != memStart) // a new burst, return stale data
+                    memStart = starts;
+                else if (brk) {
+                    nextPC();
+                    latch = at(pc);
+                }
+                return latch; // no auto-increment
+        }
+        ++reg;
+        return val;
+    }
+
+    void command (uint8_t cmd) {
+        if (!brk)
+            return;
+        uint32_t w = wrData[0] | (wrData[1] << 8) | (wrData[2] << 16);
+        if (cmd <= 0x07) { // read {MBASE,A,F}, BC, DE, HL, IX, IY, SP, PC
+            uint32_t v = cmd == 0x07 ? pc : regs[cmd];
+            rdData[0] = v;
+            rdData[1] = v >> 8;
+            rdData[2] = v >> 16;
+        } else if (0x80 <= cmd && cmd <= 0x86) { // write the same registers
+            regs[cmd-0x80] = w;
+            if (cmd == 0x80 && !adl) // MBASE can only be changed in ADL mode
+                regs[0] = (mbase() << 16) | (w & 0xFFFF);
+        } else
+            switch (cmd) {
+                case 0x87: // write PC, only the low 16 bits in Z80 mode
+                    pc = adl ? w : (mbase() << 16) | (w & 0xFFFF);
+                    break;
+                case 0x08: adl = true; break;
+                case 0x09: adl = false; break;
+            }
+    }
+
+    // execute the instruction in IS0..IS4, the PC moves past it as if it had
+    // been fetched from memory (see "PC was messed up by zIns" in run-arm)
+    void inject () {
+        if (!brk)
+            return;
+        uint8_t acc = a();
+        int len = 0;
+        switch (is[0]) {
+            case 0x00: len = 1; break;                          // nop
+            case 0x76: halted = true; len = 1; break;           // halt
+            case 0x3E: acc = is[1]; len = 2; break;             // ld a,n
+            case 0xED:
+                switch (is[1]) {
+                    case 0x38: acc = io[is[2]]; len = 3; break; // in0 a,(n)
+                    case 0x39: io[is[2]] = acc; len = 3; break; // out0 (n),a
+                    case 0x6D: // ld mb,a, only valid in ADL mode
+                        if (adl)
+                            regs[0] = (acc << 16) | (regs[0] & 0xFFFF);
+                        len = 2;
+                        break;
+                    case 0x6E: acc = mbase(); len = 2; break;   // ld a,mb
+                }
+                break;
+        }
+        if (len == 0) {
+            if (fallback)
+                fallback(*this, is);
+            else
+                ++unknown;
+            return;
+        }
+        regs[0] = (regs[0] & 0xFF00FF) | (acc << 8);
+        while (--len >= 0)
+            nextPC();
+    }
+};
@@ -0,0 +1,401 @@
+// High-level emulation of the CP/M 2.2 BDOS file and console calls.
+//
+// The jump at the BDOS entry (i.e. where 0005h leads to) gets replaced by an
+// "in a,(TRAP)" + "ret", so that each BDOS call ends up in call() on the host.
+// Console output, DMA and file calls on drives mapped to a host directory are
+// handled right there, without running the real BDOS and BIOS code at all.
+// Everything else is passed on to the real BDOS, by pushing its original
+// entry address on the Z80 stack: the "ret" after the trap then jumps to it.
+//
+// Drive X: is mapped to directory "<root>/x/" if it exists. Files in there
+// must have a valid 8.3 name, which is shown in upper case inside CP/M. Every
+// host file is presented as a single directory entry, user areas are ignored.
+// Without any such directory, the trap is never installed, and all calls go
+// to the real BDOS as before, including console output with its ^S and ^P.
+//
+// Needs <ctype.h>, <dirent.h>, <sys/stat.h>, and the macros from "macros.h".
+
+class BdosHle {
+public:
+    static constexpr uint8_t TRAP = 0xBD; // port number used for the trap
+
+    uint32_t handled = 0, passed = 0; // statistics
+
+    // look for directories to use as drives, and set up console output,
+    // returns the number of drives mapped, HLE is only used if there are any
+    int init (const char* root, int (*out)(int) =putchar) {
+        conout = out;
+        drives = 0;
+        for (int i = 0; i < 16; ++i) {
+            snprintf(dirs[i], sizeof dirs[i], "%s/%c/", root, 'a' + i);
+            struct stat st;
+            if (stat(dirs[i], &st) != 0 || !S_ISDIR(st.st_mode))
+                dirs[i][0] = 0; // not mapped, use the drive in the disk image
+            else
+                ++drives;
+        }
+        return drives;
+    }
+
+    // (re-)install the trap, this needs to be done after each BDOS reload
+    void arm (Context* z) {
+        if (drives == 0)
+            return; // nothing mapped, leave the real BDOS alone
+        uint8_t* p = mapMem(z, 0x0005);
+        if (p[0] != 0xC3) // not a jump yet, i.e. BIOS hasn't been started
+            return;
+        uint8_t* e = mapMem(z, p[1] | (p[2] << 8));
+        if (e[0] != 0xC3)
+            return; // no jump at the BDOS entry, it's probably already armed
+        uint16_t target = e[1] | (e[2] << 8);
+        uint8_t* t = mapMem(z, target);
+        if (t[0] == 0xDB && t[1] == TRAP)
+            return; // a jump to the trap itself, e.g. from a debugger
+        bdose = target;
+        e[0] = 0xDB; // in a,(TRAP)
+        e[1] = TRAP;
+        e[2] = 0xC9; // ret
+    }
+
+    // called from the trap, either handle this request or pass it on
+    void call (Context* z) {
+        Z80_STATE* state = &(z->state);
+        int r = request(z, C, DE);
+        if (r >= 0) {
+            ++handled;
+            HL = r;
+            A = r;
+            B = r >> 8;
+        } else {
+            ++passed;
+            SP -= 2; // push the real entry point, the ret will then go there
+            *mapMem(z, SP) = bdose;
+            *mapMem(z, SP+1) = bdose >> 8;
+        }
+    }
+
+private:
+    char dirs [16][200];    // host directories, or empty if not mapped
+    int drives = 0;         // number of mapped drives
+    int (*conout)(int);
+    uint16_t bdose = 0;     // original BDOS entry, for all other requests
+    uint16_t dma = 0x0080;
+    uint8_t curDrive = 0, column = 0;
+
+    bool searching = false; // true if search next needs to be handled here
+    DIR* search = 0;        // directory iteration state for search next
+    uint8_t pattern [12];   // drive plus name to look for during search
+
+    FILE* fp = 0;           // the last file used is kept open
+    char fpName [220];
+
+    // return the result in HL, or -1 to let the real BDOS deal with it
+    int request (Context* z, uint8_t fn, uint16_t de) {
+        uint8_t* fcb = mapMem(z, de);
+        switch (fn) {
+            case 2:  // console output
+                putch(de & 0xFF);
+                return 0;
+            case 6:  // direct console I/O, only output is handled here
+                if ((de & 0xFF) >= 0xFE)
+                    return -1;
+                conout(de & 0xFF);
+                return 0;
+            case 9:  // print string
+                for (uint16_t i = de; *mapMem(z, i) != '$'; ++i)
+                    putch(*mapMem(z, i));
+                return 0;
+            case 13: // reset disk system, but also let the real BDOS do it
+                closeFile();
+                curDrive = 0;
+                dma = 0x0080;
+                return -1;
+            case 14: // select disk, the real BDOS also needs to know this
+                curDrive = de & 0x0F;
+                return -1;
+            case 26: // set DMA address, for the real BDOS as well
+                dma = de;
+                return -1;
+        }
+
+        if (fn == 17) // search for first, remember where search next goes
+            searching = mapped(fcb);
+        if (fn == 18) // search for next, no FCB in this case
+            return !searching ? -1 : nextEntry(z) ? 0 : 0xFF;
+
+        if (fn < 15 || fn > 40 || !mapped(fcb))
+            return -1; // not a file request or not a host drive
+
+        switch (fn) {
+            case 15: // open file
+                fcb[14] = 0; // the module number is cleared, as in the BDOS
+                if (!lookup(fcb, fcb))
+                    return 0xFF;
+                fcb[13] = 0;
+                return setCount(fcb) ? 0 : 0xFF;
+            case 16: // close file
+                closeFile();
+                return exists(fcb) ? 0 : 0xFF;
+            case 17: // search for first
+                memcpy(pattern, fcb, sizeof pattern);
+                if (search)
+                    closedir(search);
+                search = opendir(dirs[drive(fcb)]);
+                return nextEntry(z) ? 0 : 0xFF;
+            case 19: { // delete file
+                int n = 0;
+                closeFile();
+                DIR* dp = opendir(dirs[drive(fcb)]);
+                while (dp != 0 && matchNext(dp, fcb, 0))
+                    n += remove(path(fcb, matched)) == 0;
+                if (dp)
+                    closedir(dp);
+                return n > 0 ? 0 : 0xFF;
+            }
+            case 20: // read sequential
+            case 21: { // write sequential
+                int rec = extent(fcb) * 128 + fcb[32];
+                int e = transfer(z, fcb, rec, fn == 21);
+                if (e == 0)
+                    setPosition(fcb, rec + 1);
+                return e;
+            }
+            case 22: { // make file
+                closeFile();
+                if (extent(fcb) == 0) { // don't truncate for later extents
+                    FILE* f = fopen(path(fcb, fcb), "wb");
+                    if (f == 0)
+                        return 0xFF;
+                    fclose(f);
+                }
+                fcb[13] = fcb[15] = 0;
+                return 0;
+            }
+            case 23: { // rename file
+                closeFile();
+                char from [sizeof fpName];
+                strcpy(from, path(fcb, fcb));
+                return rename(from, path(fcb, fcb + 16)) == 0 ? 0 : 0xFF;
+            }
+            case 33: // read random
+            case 34: // write random
+            case 40: { // write random with zero fill
+                if (fcb[35] != 0)
+                    return 6; // seek past physical end of disk
+                int rec = fcb[33] | (fcb[34] << 8);
+                setPosition(fcb, rec);
+                return transfer(z, fcb, rec, fn != 33);
+            }
+            case 35: { // compute file size
+                int n = records(fcb);
+                if (n < 0)
+                    return 0xFF;
+                fcb[33] = n;
+                fcb[34] = n >> 8;
+                fcb[35] = n >> 16;
+                return 0;
+            }
+            case 36: { // set random record
+                int rec = extent(fcb) * 128 + fcb[32];
+                fcb[33] = rec;
+                fcb[34] = rec >> 8;
+                fcb[35] = 0;
+                return 0;
+            }
+        }
+        return -1;
+    }
+
+    // console output with tab expansion, as done by the real BDOS
+    void putch (uint8_t c) {
+        if (c == '\t') {
+            do
+                putch(' ');
+            while (column % 8 != 0);
+            return;
+        }
+        conout(c);
+        if (c == '\r')
+            column = 0;
+        else if (c == '\b')
+            column -= column > 0;
+        else if (c >= ' ')
+            ++column;
+    }
+
+    int drive (uint8_t const* fcb) const {
+        int dr = fcb[0] & 0x1F;
+        return dr > 0 && dr <= 16 ? dr - 1 : curDrive;
+    }
+
+    bool mapped (uint8_t const* fcb) const {
+        return dirs[drive(fcb)][0] != 0;
+    }
+
+    static int extent (uint8_t const* fcb) {
+        return (fcb[14] & 0x3F) * 32 + (fcb[12] & 0x1F);
+    }
+
+    // convert an 11-char name from an FCB to a full host path
+    char const* path (uint8_t const* fcb, uint8_t const* name) {
+        static char buf [sizeof fpName];
+        char* p = buf + snprintf(buf, sizeof buf, "%s", dirs[drive(fcb)]);
+        for (int i = 0; i < 11; ++i) {
+            char c = name[i+1] & 0x7F;
+            if (i == 8)
+                *p++ = '.';
+            if (c != ' ')
+                *p++ = tolower(c);
+        }
+        if (p[-1] == '.')
+            --p; // no extension
+        *p = 0;
+        return buf;
+    }
+
+    // convert a host file name to FCB format, fails if it's not a valid 8.3
+    static bool toFcb (char const* s, uint8_t* name) {
+        memset(name + 1, ' ', 11);
+        for (int i = 0; *s != 0; ++s, ++i) {
+            if (*s == '.' && i > 0 && i <= 8) {
+                i = 7; // continue with the extension
+                continue;
+            }
+            if (i >= 11 || (i == 8 && s[-1] != '.'))
+                return false; // too long, or no dot after an 8-char name
+            if (*s <= ' ' || strchr(".<>,;:=?*[]", *s))
+                return false;
+            name[i+1] = toupper(*s);
+        }
+        return name[1] != ' ';
+    }
+
+    uint8_t matched [12]; // the name found by the last call to matchNext()
+
+    // find the next regular file in the host directory matching the pattern
+    bool matchNext (DIR* dp, uint8_t const* pat, struct stat* stp) {
+        struct dirent* de;
+        while ((de = readdir(dp)) != 0) {
+            matched[0] = pat[0];
+            if (!toFcb(de->d_name, matched))
+                continue;
+            bool ok = true;
+            for (int i = 1; i < 12 && ok; ++i)
+                ok = (pat[i] & 0x7F) == '?' || (pat[i] & 0x7F) == matched[i];
+            struct stat st;
+            if (ok && stat(path(pat, matched), &st) == 0 && S_ISREG(st.st_mode)) {
+                if (stp)
+                    *stp = st;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // find the first matching file, and copy its actual name into the FCB
+    bool lookup (uint8_t const* pat, uint8_t* fcb) {
+        DIR* dp = opendir(dirs[drive(pat)]);
+        bool ok = dp != 0 && matchNext(dp, pat, 0);
+        if (dp)
+            closedir(dp);
+        if (ok)
+            memcpy(fcb + 1, matched + 1, 11);
+        return ok;
+    }
+
+    bool exists (uint8_t const* fcb) {
+        struct stat st;
+        return stat(path(fcb, fcb), &st) == 0;
+    }
+
+    // file size in 128-byte records, rounded up, or -1 if it doesn't exist
+    int records (uint8_t const* fcb) {
+        if (fp != 0 && strcmp(fpName, path(fcb, fcb)) == 0)
+            fflush(fp);
+        struct stat st;
+        if (stat(path(fcb, fcb), &st) != 0)
+            return -1;
+        return (st.st_size + 127) / 128;
+    }
+
+    // set the record count of the current extent, fails if it doesn't exist
+    bool setCount (uint8_t* fcb) {
+        int n = records(fcb) - 128 * extent(fcb);
+        if (n <= 0 && extent(fcb) > 0)
+            return false;
+        fcb[15] = n < 0 ? 0 : n > 128 ? 128 : n;
+        return true;
+    }
+
+    // update extent and current record to point to the given record
+    void setPosition (uint8_t* fcb, int rec) {
+        fcb[12] = (rec >> 7) & 0x1F;
+        fcb[14] = (rec >> 12) & 0x3F;
+        fcb[32] = rec & 0x7F;
+        int n = records(fcb) - 128 * extent(fcb);
+        fcb[15] = n < 0 ? 0 : n > 128 ? 128 : n;
+    }
+
+    void closeFile () {
+        if (fp != 0)
+            fclose(fp);
+        fp = 0;
+    }
+
+    // read or write one record at the DMA address, returns a BDOS result
+    int transfer (Context* z, uint8_t const* fcb, int rec, bool out) {
+        char const* name = path(fcb, fcb);
+        if (fp == 0 || strcmp(fpName, name) != 0) {
+            closeFile();
+            fp = fopen(name, "r+b");
+            if (fp == 0)
+                fp = fopen(name, "rb");
+            if (fp == 0)
+                return out ? 2 : 1;
+            strcpy(fpName, name);
+        }
+
+        uint8_t buf [128];
+        fseek(fp, 128L * rec, SEEK_SET);
+        if (out) {
+            for (int i = 0; i < 128; ++i)
+                buf[i] = *mapMem(z, dma + i);
+            return fwrite(buf, sizeof buf, 1, fp) == 1 ? 0 : 2;
+        }
+
+        int n = fread(buf, 1, sizeof buf, fp);
+        if (n <= 0)
+            return 1; // end of file
+        memset(buf + n, 0x1A, sizeof buf - n); // pad with ^Z's
+        for (int i = 0; i < 128; ++i)
+            *mapMem(z, dma + i) = buf[i];
+        return 0;
+    }
+
+    // store the next search match as directory entry #0 in the DMA buffer
+    bool nextEntry (Context* z) {
+        struct stat st;
+        if (search == 0 || !matchNext(search, pattern, &st)) {
+            if (search)
+                closedir(search);
+            search = 0;
+            return false;
+        }
+
+        int n = (st.st_size + 127) / 128;
+        int last = n > 0 ? (n - 1) / 128 : 0;
+        uint8_t entry [32];
+        memset(entry, 0, sizeof entry);
+        memcpy(entry + 1, matched + 1, 11);
+        entry[12] = last & 0x1F;
+        entry[14] = last >> 5;
+        entry[15] = n - 128 * last;
+        for (int i = 0; i < 16 && i < (entry[15] + 7) / 8; ++i)
+            entry[16+i] = 0xFF; // pretend blocks are in use, never looked at
+        for (int i = 0; i < 32; ++i)
+            *mapMem(z, dma + i) = entry[i];
+        for (int i = 32; i < 128; ++i)
+            *mapMem(z, dma + i) = 0xE5; // the rest of the sector is unused
+        return true;
+    }
+};
@@ -6,6 +6,8 @@
 #include <string.h>
 #include <termios.h>
 #include <sys/ioctl.h>
+#include <sys/time.h>
+#include <pthread.h>
 #include <unistd.h>
 #ifdef macosx
 #include <sys/filio.h>
@@ -62,6 +64,79 @@ int consoleIn (void) {
     return consoleHit() ? consoleWait() : 0;
 }
 
+// Optional background reader, which moves all console input into a FIFO as
+// soon as it arrives. The reader blocks when the FIFO is full, so nothing is
+// lost when pasting lots of text, even if the emulated system is slow.
+
+static uint8_t rxBuf [4096];
+static unsigned rxIn, rxOut;    // free-running, only masked to index rxBuf
+static int rxEof;               // set once there is no more input
+static pthread_mutex_t rxLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t rxCond = PTHREAD_COND_INITIALIZER;
+
+static void* rxReader (void*) {
+    while (true) {
+        int c = consoleWait();
+        pthread_mutex_lock(&rxLock);
+        if (done)
+            rxEof = 1;
+        else {
+            while (rxIn - rxOut >= sizeof rxBuf) // full, wait for room
+                pthread_cond_wait(&rxCond, &rxLock);
+            rxBuf[rxIn++ % sizeof rxBuf] = c;
+        }
+        pthread_cond_broadcast(&rxCond);
+        pthread_mutex_unlock(&rxLock);
+        if (rxEof)
+            return 0;
+    }
+}
+
+void consoleStartReader (void) {
+    pthread_t tid;
+    pthread_create(&tid, 0, rxReader, 0);
+    pthread_detach(tid);
+}
+
+// number of characters waiting in the FIFO
+int consoleRxCount (void) {
+    pthread_mutex_lock(&rxLock);
+    int n = rxIn - rxOut;
+    pthread_mutex_unlock(&rxLock);
+    return n;
+}
+
+// next character from the FIFO, or -1 if there is none
+int consoleRxGet (void) {
+    int c = -1;
+    pthread_mutex_lock(&rxLock);
+    if (rxIn != rxOut) {
+        c = rxBuf[rxOut++ % sizeof rxBuf];
+        pthread_cond_broadcast(&rxCond); // there's room again for the reader
+    }
+    pthread_mutex_unlock(&rxLock);
+    return c;
+}
+
+// block until there is input in the FIFO, at end of input, or when the
+// timeout expires (forever if usecs < 0), returns true if there is input
+int consoleRxWait (int usecs) {
+    struct timeval now;
+    gettimeofday(&now, 0);
+    long long ns = (now.tv_usec + (long long) usecs) * 1000;
+    struct timespec limit = { now.tv_sec + ns / 1000000000, ns % 1000000000 };
+
+    pthread_mutex_lock(&rxLock);
+    while (rxIn == rxOut && !rxEof)
+        if (usecs < 0)
+            pthread_cond_wait(&rxCond, &rxLock);
+        else if (pthread_cond_timedwait(&rxCond, &rxLock, &limit) != 0)
+            break; // timed out
+    int n = rxIn - rxOut;
+    pthread_mutex_unlock(&rxLock);
+    return n > 0;
+}
+
 static int argCnt;
 static const char* const* argVec;
 
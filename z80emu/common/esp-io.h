@@ -0,0 +1,155 @@
+// Console and disk I/O for the ESP32 builds, done by a task on the other core.
+//
+// The emulator runs in the Arduino loop task, which is pinned to core 1. All
+// the I/O which can block for a while - Serial, the SD card, SPIFFS, and the raw
+// flash with its wear-levelling flushes - is done by an I/O task on core 0. Both
+// sides only share the SpscRing's below: console input, console output, and
+// disk requests. Each side wakes up the other one with a task notification, and
+// the I/O task also polls the serial port once per tick.
+//
+// Disk writes are posted: the block is copied into the request ring, and the
+// emulator carries on right away, so that the SD card and flash only stall it
+// when the ring is full. Reads wait until their request has been served, which
+// also means that all writes posted before it are done. The guest still sees
+// the same synchronous port interface as before, and gets no write errors: the
+// I/O task reports those on the console and counts them.
+//
+// Diagnostics still go through printf, i.e. straight to Serial, which has its
+// own lock, so they can come from either core.
+
+#include "spsc-ring.h"
+
+constexpr int IO_BLKSZ = 512;
+
+struct BlockReq {
+    bool out;                   // true for a write
+    uint8_t dev;                // device, as passed in by the guest
+    uint32_t blk;               // block number on that device
+    int result;                 // bytes transferred, set by the I/O task
+    uint8_t data [IO_BLKSZ];
+};
+
+// provided by the application, called from the I/O task to do one request
+extern int blockIo (BlockReq& req);
+
+struct EspIo {
+    uint32_t reads, writes;     // disk requests, for statistics
+    uint32_t stalls;            // waits for a free request slot, for statistics
+    uint32_t errors;            // failed disk requests, counted by the I/O task
+
+    // start the I/O task, must be called from the emulator's task
+    void start () {
+        emuTask = xTaskGetCurrentTaskHandle();
+        xTaskCreatePinnedToCore(ioTask, "io", 4096, this, 2, &ioHandle, 0);
+        printf("- emulator on core %d, I/O on core 0\n", xPortGetCoreID());
+    }
+
+    // block the emulator until the I/O task signals, or the ticks run out
+    void wait (uint32_t ticks =1) {
+        ulTaskNotifyTake(pdTRUE, ticks);
+    }
+
+    int rxCount () {
+        return rx.count();
+    }
+
+    int rxGet () {
+        uint8_t c;
+        while (!rx.get(c))
+            wait(portMAX_DELAY);
+        return c;
+    }
+
+    void txPut (uint8_t c) {
+        while (!tx.put(c)) {
+            xTaskNotifyGive(ioHandle);
+            wait();
+        }
+        if (tx.count() == 1) // wasn't busy, make sure it gets sent soon
+            xTaskNotifyGive(ioHandle);
+    }
+
+    // a free request slot, waits while the ring is full
+    BlockReq* request () {
+        BlockReq* r;
+        while ((r = disk.slot()) == 0) {
+            ++stalls;
+            wait();
+        }
+        return r;
+    }
+
+    // hand a filled-in request to the I/O task, reads wait until they are done
+    int submit (BlockReq* r) {
+        bool out = r->out;
+        uint32_t seq = disk.push();
+        xTaskNotifyGive(ioHandle);
+        if (out) {
+            ++writes;
+            return IO_BLKSZ;
+        }
+        ++reads;
+        while (!disk.done(seq))
+            wait();
+        return r->result; // still intact, only the emulator re-uses the slot
+    }
+
+private:
+    SpscRing<uint8_t,1024> rx, tx;
+    SpscRing<BlockReq,8> disk;
+    TaskHandle_t emuTask, ioHandle;
+
+    static void ioTask (void* arg) {
+        ((EspIo*) arg)->service();
+    }
+
+    // the I/O task, moves console data and serves disk requests, forever
+    void service () {
+        TickType_t rested = xTaskGetTickCount();
+        while (true) {
+            ulTaskNotifyTake(pdTRUE, 1);
+            bool wake = false;
+
+            while (Serial.available() > 0) {
+                uint8_t* p = rx.slot();
+                if (p == 0)
+                    break; // full, leave the rest in the serial driver
+                *p = Serial.read();
+                rx.push();
+                wake = true;
+            }
+
+            uint8_t buf [64];
+            int n = 0;
+            while (n < (int) sizeof buf && tx.get(buf[n]))
+                ++n;
+            if (n > 0)
+                Serial.write(buf, n);
+            if (tx.count() > 0)
+                xTaskNotifyGive(ioHandle); // more to send, don't sleep
+
+            if (BlockReq* r = disk.front()) { // one per pass, to keep Serial going
+                r->result = blockIo(*r);
+                if (r->result != IO_BLKSZ) {
+                    ++errors;
+                    printf("disk %s failed: dev %d blk %u -> %d\n",
+                            r->out ? "write" : "read", r->dev, r->blk, r->result);
+                }
+                disk.pop();
+                wake = true;
+                if (disk.count() > 0)
+                    xTaskNotifyGive(ioHandle);
+            }
+
+            if (wake)
+                xTaskNotifyGive(emuTask);
+
+            // a steady stream of writes could keep this task from ever blocking,
+            // so let the idle task on this core run now and then, for its watchdog
+            if (xTaskGetTickCount() - rested > 100) {
+                vTaskDelay(1);
+                rested = xTaskGetTickCount();
+            }
+        }
+    }
+};
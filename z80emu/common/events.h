@@ -0,0 +1,107 @@
+// Cycle-scheduled device events, to replace fixed-size emulation slices.
+//
+// Events are kept in a small binary min-heap, ordered by their deadline in
+// emulated cycles. The run loop only emulates up to the next deadline, then
+// fires everything which is due, so that device models (timers, serial input,
+// etc) can raise interrupts at the right moment in emulated time. Handlers can
+// re-schedule themselves, which is how periodic events are implemented.
+
+template< int N >
+class EventQueue {
+public:
+    typedef void (*Handler) (void* arg);
+
+    uint64_t now = 0;       // total number of cycles emulated so far
+    uint32_t slices = 0;    // number of emulation slices, for statistics
+    uint32_t fired = 0;     // number of events fired, for statistics
+    uint64_t skipped = 0;   // cycles skipped while idle, for statistics
+
+    // schedule an event at an absolute cycle count, fails if queue is full
+    bool at (uint64_t when, Handler fun, void* arg =0) {
+        if (fill >= N)
+            return false;
+        int i = fill++;
+        heap[i] = { when, fun, arg };
+        siftUp(i);
+        return true;
+    }
+
+    // schedule an event a given number of cycles from now
+    bool after (uint32_t delay, Handler fun, void* arg =0) {
+        return at(now + delay, fun, arg);
+    }
+
+    // remove all pending events for this handler and argument
+    void cancel (Handler fun, void* arg =0) {
+        int n = 0;
+        for (int i = 0; i < fill; ++i)
+            if (heap[i].fun != fun || heap[i].arg != arg)
+                heap[n++] = heap[i];
+        fill = n;
+        for (int i = fill/2 - 1; i >= 0; --i) // restore the heap property
+            siftDown(i);
+    }
+
+    bool pending () const { return fill > 0; }
+
+    // number of cycles until the next event is due, capped to a given limit
+    int slice (int limit) const {
+        if (fill > 0 && heap[0].when < now + limit)
+            return heap[0].when > now ? heap[0].when - now : 1;
+        return limit;
+    }
+
+    // account for emulated cycles and fire all the events which are now due
+    void advance (int cycles) {
+        now += cycles;
+        ++slices;
+        while (fill > 0 && heap[0].when <= now) {
+            Event e = heap[0];
+            heap[0] = heap[--fill];
+            siftDown(0);
+            ++fired;
+            e.fun(e.arg); // this may schedule new events
+        }
+    }
+
+    // jump straight to the next deadline and fire it, e.g. while in HALT
+    void skip () {
+        uint32_t n = fill > 0 && heap[0].when > now ? heap[0].when - now : 0;
+        skipped += n;
+        advance(n);
+    }
+
+private:
+    struct Event {
+        uint64_t when;
+        Handler fun;
+        void* arg;
+    };
+
+    Event heap [N];
+    int fill = 0;
+
+    void siftUp (int i) {
+        while (i > 0) {
+            int up = (i - 1) / 2;
+            if (heap[up].when <= heap[i].when)
+                break;
+            Event t = heap[up]; heap[up] = heap[i]; heap[i] = t;
+            i = up;
+        }
+    }
+
+    void siftDown (int i) {
+        while (true) {
+            int least = i, l = 2*i + 1, r = l + 1;
+            if (l < fill && heap[l].when < heap[least].when)
+                least = l;
+            if (r < fill && heap[r].when < heap[least].when)
+                least = r;
+            if (least == i)
+                break;
+            Event t = heap[least]; heap[least] = heap[i]; heap[i] = t;
+            i = least;
+        }
+    }
+};
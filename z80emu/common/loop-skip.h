@@ -0,0 +1,238 @@
+// Detection of tight idle and delay loops, so that they can be skipped.
+//
+// After an emulation slice, the code at the current PC is single-stepped for
+// a few instructions. If the PC comes back to where it started, and nothing
+// along the way writes to memory, or does I/O other than polling the console
+// status on port 0, then this loop can be fast-forwarded:
+//
+//  - if no register changed, the loop can only be ended by an interrupt or
+//    by console input: it's an idle loop, which the caller treats as a HALT
+//  - if the only change is a count-down of one register (pair), and the loop
+//    uses one of the usual "dec / jr nz" idioms, then it's a delay loop: all
+//    but the last iteration are done in one go, up to the next event
+//
+// A delay loop must leave A and F alone, since skipped iterations would lose
+// any work done in them, e.g. "add a,c / djnz". The exceptions are flags
+// set by a "dec r / jr nz" which ends the loop (all but carry), and A and F
+// after a "ld a,hi / or lo / jr nz" at the end: the final iteration, which
+// is still emulated, sets them again, from the counter alone.
+//
+// Skipped iterations still add their cycles and advance the R register.
+//
+// Needs "context.h" and "z80emu.h", and must be included after "events.h".
+
+class LoopSkip {
+public:
+    enum { NONE, IDLE, DELAY };
+
+    uint32_t idles = 0, delays = 0;         // statistics
+    uint64_t idleCycles = 0, delayCycles = 0;
+
+    // probe the code at the current PC, returns NONE, IDLE, or DELAY
+    template< typename Q >
+    int check (Context* z, Q& events) {
+        Z80_STATE* state = &z->state;
+        Z80_STATE start = *state;
+        int cycles = 0, steps = 0;
+        polls = false;
+
+        do {
+            if (steps >= MAXSTEPS || !safe(z, state->pc)) {
+                events.now += cycles;
+                return NONE;
+            }
+            trail[steps++] = state->pc;
+            cycles += Z80Emulate(state, 1, z);
+        } while (state->pc != start.pc);
+        events.now += cycles;
+
+        cpi = cycles;
+        dR = (state->r - start.r) & 0x7F;
+        int changed = compare(start, *state);
+        uint8_t dA = start.registers.byte[Z80_A] ^ state->registers.byte[Z80_A];
+        uint8_t dF = start.registers.byte[Z80_F] ^ state->registers.byte[Z80_F];
+
+        if (changed == 0) {
+            if (polls || (state->iff1 && events.pending())) {
+                ++idles;
+                return IDLE;
+            }
+            return NONE; // would spin forever, let it
+        }
+
+        if (changed < 0)
+            return NONE;
+        int pair = changed - 1;
+        uint16_t before = start.registers.word[pair];
+        if (!countsDown(z, before, state->registers.word[pair], pair, steps))
+            return NONE;
+        if ((dA & ~redoA) != 0 || (dF & ~redoF) != 0)
+            return NONE; // A or F is used for more than the count-down
+
+        // leave the counter at 1, so the final iteration is emulated as usual
+        int count = counter(state, pair);
+        int limit = events.slice(1<<30) / cpi;
+        int n = count - 1 < limit ? count - 1 : limit;
+        if (n <= 0)
+            return NONE;
+        setCounter(state, pair, count - n);
+        advanceR(state, n);
+        events.now += (uint64_t) n * cpi;
+        delayCycles += (uint64_t) n * cpi;
+        ++delays;
+        return DELAY;
+    }
+
+    // account for the cycles skipped by the caller after an IDLE result
+    void idled (Context* z, uint64_t cycles) {
+        advanceR(&z->state, cycles / cpi);
+        idleCycles += cycles;
+    }
+
+private:
+    static constexpr int MAXSTEPS = 16; // longest loop body, in instructions
+
+    uint16_t trail [MAXSTEPS];  // PC of each instruction in the last probe
+    int cpi = 1, dR = 0;        // cycles and R increments per iteration
+    bool polls;                 // true if the loop reads the console status
+    int width;                  // byte index of an 8-bit counter, or -1
+    uint8_t redoA, redoF;       // bits set again by the last iteration
+
+    static uint8_t at (Context* z, uint16_t addr) {
+        return *mapMem(z, addr);
+    }
+
+    // true if the instruction at this address has no effect outside the CPU
+    bool safe (Context* z, uint16_t pc) {
+        uint8_t op = at(z, pc);
+        switch (op) {
+            case 0xCB: // bit ops, only BIT n,(hl) leaves memory alone
+                op = at(z, pc+1);
+                return (op & 0x07) != 6 || (op & 0xC0) == 0x40;
+            case 0xDD: case 0xFD: // index ops, same as for HL
+                op = at(z, pc+1);
+                if (op == 0xCB)
+                    return (at(z, pc+3) & 0xC0) == 0x40;
+                if (op == 0xDD || op == 0xED || op == 0xFD)
+                    return false;
+                break;
+            case 0xED: // only some 16-bit arithmetic and loads
+                switch (at(z, pc+1)) {
+                    case 0x42: case 0x4A: case 0x52: case 0x5A:
+                    case 0x62: case 0x6A: case 0x72: case 0x7A:
+                    case 0x4B: case 0x5B: case 0x6B: case 0x7B:
+                    case 0x44:
+                        return true;
+                }
+                return false;
+            case 0xDB: // in a,(n), only allowed to poll the console status
+                if (at(z, pc+1) != 0)
+                    return false;
+                polls = true;
+                return true;
+        }
+        switch (op) {
+            case 0x02: case 0x12: case 0x22: case 0x32: // stores
+            case 0x34: case 0x35: case 0x36:            // (hl) updates
+            case 0x70: case 0x71: case 0x72: case 0x73:
+            case 0x74: case 0x75: case 0x76: case 0x77: // ld (hl),r and halt
+            case 0xC4: case 0xCC: case 0xCD: case 0xD4: // calls
+            case 0xDC: case 0xE4: case 0xEC: case 0xF4: case 0xFC:
+            case 0xC5: case 0xD5: case 0xE5: case 0xF5: // pushes
+            case 0xC7: case 0xCF: case 0xD7: case 0xDF: // restarts
+            case 0xE7: case 0xEF: case 0xF7: case 0xFF:
+            case 0xD3: case 0xE3:                       // out and ex (sp),hl
+                return false;
+        }
+        return true;
+    }
+
+    // returns 0 if the same, the index plus one of the only register pair which
+    // got decremented, either as a whole or just its high byte (ignoring A and
+    // F, which are checked by the caller), or -1 if anything else changed
+    static int compare (Z80_STATE const& a, Z80_STATE const& b) {
+        if (memcmp(a.registers.word + Z80_IX, b.registers.word + Z80_IX, 6) ||
+                memcmp(a.alternates, b.alternates, sizeof a.alternates) ||
+                a.i != b.i || a.iff1 != b.iff1 || a.im != b.im)
+            return -1;
+        int result = 0;
+        for (int i = Z80_BC; i <= Z80_HL; ++i) {
+            uint16_t x = a.registers.word[i], y = b.registers.word[i];
+            if (x == y)
+                continue;
+            bool down = (uint16_t) (x - 1) == y || (uint16_t) (x - 0x100) == y;
+            if (result != 0 || !down)
+                return -1; // more than one pair changed, or not a count-down
+            result = i + 1;
+        }
+        if (result == 0 && a.registers.word[Z80_AF] != b.registers.word[Z80_AF])
+            return -1; // only A or F changed, can't be a counter loop
+        return result;
+    }
+
+    // register number, as used in the opcodes, of each byte in a pair
+    static int regNum (int pair, bool high) {
+        return 2*pair + !high;
+    }
+
+    // check that the loop body contains a count-down idiom for this counter,
+    // and figure out whether it's the low byte, the high byte, or the pair,
+    // also sets which bits of A and F the final iteration will set again
+    bool countsDown (Context* z, uint16_t before, uint16_t after,
+                        int pair, int steps) {
+        bool hiOnly = (uint16_t) (before - 0x100) == after;
+        bool loOnly = !hiOnly && (before >> 8) == (after >> 8);
+        int hi = regNum(pair, true), lo = regNum(pair, false);
+        bool decPair = false, testPair = false;
+        redoA = redoF = 0;
+        for (int i = 0; i < steps; ++i) { // the trail is circular, it's a loop
+            uint8_t op = at(z, trail[i]);
+            uint8_t next = at(z, trail[(i+1) % steps]);
+            uint8_t third = at(z, trail[(i+2) % steps]);
+            bool jrnz = next == 0x20 || next == 0xC2;
+            bool last = i + 2 == steps; // followed by the jump back to the start
+            if (hiOnly && op == 0x10 && pair == Z80_BC) { // djnz
+                width = Z80_B;
+                return true;
+            }
+            if ((hiOnly && op == 0x05 + 8*hi && jrnz) || // dec r, jr/jp nz
+                    (loOnly && op == 0x05 + 8*lo && jrnz)) {
+                width = hiOnly ? (pair == Z80_BC ? Z80_B :
+                                  pair == Z80_DE ? Z80_D : Z80_H)
+                               : (pair == Z80_BC ? Z80_C :
+                                  pair == Z80_DE ? Z80_E : Z80_L);
+                if (last)
+                    redoF = (uint8_t) ~Z80_C_FLAG; // dec r leaves carry alone
+                return true;
+            }
+            if (op == 0x0B + 16*pair) // dec rr
+                decPair = true;
+            if (((op == 0x78 + hi && next == 0xB0 + lo) ||
+                    (op == 0x78 + lo && next == 0xB0 + hi)) &&
+                    (third == 0x20 || third == 0xC2)) {
+                testPair = true; // ld a,hi / or lo / jr nz, or vice versa
+                if (i + 3 == steps)
+                    redoA = redoF = 0xFF; // both come from the counter alone
+            }
+        }
+        width = -1;
+        return decPair && testPair;
+    }
+
+    int counter (Z80_STATE const* s, int pair) const {
+        if (width >= 0)
+            return s->registers.byte[width];
+        return s->registers.word[pair];
+    }
+
+    void setCounter (Z80_STATE* s, int pair, int value) const {
+        if (width >= 0)
+            s->registers.byte[width] = value;
+        else
+            s->registers.word[pair] = value;
+    }
+
+    void advanceR (Z80_STATE* s, uint64_t iterations) const {
+        s->r = (s->r & 0x80) | ((s->r + iterations * dR) & 0x7F);
+    }
+};
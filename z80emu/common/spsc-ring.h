@@ -0,0 +1,82 @@
+// Lock-free ring buffer between one producer and one consumer, e.g. two cores.
+//
+// The indices are free-running and only masked to index the slots, so N must be
+// a power of two. Each index is only written by its own side, with release
+// ordering, and read by the other side with acquire ordering, so that the data
+// in a slot is always complete before the other side can see it.
+//
+// Slots can be filled and emptied in place, which avoids copying large items:
+// the producer fills slot() and then calls push(), the consumer works on front()
+// and then calls pop(). A popped slot is left alone until the producer re-uses
+// it, so the producer can still pick up results left there by the consumer, once
+// done() says that its request has been popped.
+
+#include <atomic>
+
+template< typename T, int N >
+class SpscRing {
+    static_assert((N & (N-1)) == 0, "ring size must be a power of two");
+public:
+    // producer side: the next free slot, or 0 if the ring is full
+    T* slot () {
+        uint32_t i = in.load(std::memory_order_relaxed);
+        if (i - out.load(std::memory_order_acquire) >= N)
+            return 0;
+        return items + i % N;
+    }
+
+    // producer side: hand the filled slot to the consumer, returns its sequence
+    uint32_t push () {
+        uint32_t i = in.load(std::memory_order_relaxed);
+        in.store(i + 1, std::memory_order_release);
+        return i;
+    }
+
+    // producer side: true once the consumer has popped the given item
+    bool done (uint32_t seq) const {
+        return (int32_t) (out.load(std::memory_order_acquire) - seq) > 0;
+    }
+
+    // consumer side: the oldest item, or 0 if the ring is empty
+    T* front () {
+        uint32_t o = out.load(std::memory_order_relaxed);
+        if (in.load(std::memory_order_acquire) == o)
+            return 0;
+        return items + o % N;
+    }
+
+    // consumer side: release the front slot
+    void pop () {
+        uint32_t o = out.load(std::memory_order_relaxed);
+        out.store(o + 1, std::memory_order_release);
+    }
+
+    // copying versions, for small items
+    bool put (T const& v) {
+        T* p = slot();
+        if (p == 0)
+            return false;
+        *p = v;
+        push();
+        return true;
+    }
+
+    bool get (T& v) {
+        T* p = front();
+        if (p == 0)
+            return false;
+        v = *p;
+        pop();
+        return true;
+    }
+
+    // number of items waiting, can be called from either side
+    int count () const {
+        uint32_t o = out.load(std::memory_order_acquire); // first, as in >= out
+        return in.load(std::memory_order_acquire) - o;
+    }
+
+private:
+    T items [N];
+    std::atomic<uint32_t> in {0}, out {0};
+};
@@ -26,8 +26,9 @@
  * accepted at the instruction right after a DI or EI on an actual processor. 
  */
 
+#define Z80_CATCH_HALT  /* lets the run loop skip ahead while halted */
+
 /*      
-#define Z80_CATCH_HALT
 #define Z80_CATCH_DI
 #define Z80_CATCH_EI
 #define Z80_CATCH_RETI
@@ -892,7 +892,7 @@ emulate_next_instruction:
 
 	    case HALT: {
 #ifdef Z80_CATCH_HALT
-		state->status = Z80_STATUS_FLAG_HALT;
+		state->status = Z80_STATUS_HALT;
 #else
 		/* If an HALT instruction is executed, the Z80
 		 * keeps executing NOPs until an interrupt is
@@ -908,7 +908,7 @@ emulate_next_instruction:
 	    case DI: {
 		state->iff1 = state->iff2 = 0;
 #ifdef Z80_CATCH_DI
-		state->status = Z80_STATUS_FLAG_DI;
+		state->status = Z80_STATUS_DI;
 		goto stop_emulation;
 #else
 		/* No interrupt can be accepted right after
@@ -929,7 +929,7 @@ emulate_next_instruction:
 	    case EI: {
 		state->iff1 = state->iff2 = 1;
 #ifdef Z80_CATCH_EI
-		state->status = Z80_STATUS_FLAG_EI;
+		state->status = Z80_STATUS_EI;
 		goto stop_emulation;
 #else
 		/* See comment for DI. */
@@ -1532,14 +1532,14 @@ emulate_next_instruction:
 		POP(pc);
 #if defined(Z80_CATCH_RETI) && defined(Z80_CATCH_RETN)
 		state->status = opcode == OPCODE_RETI
-		    ? Z80_STATUS_FLAG_RETI
-		    : Z80_STATUS_FLAG_RETN;
+		    ? Z80_STATUS_RETI
+		    : Z80_STATUS_RETN;
 		goto stop_emulation;
 #elif defined(Z80_CATCH_RETI)
-		state->status = Z80_STATUS_FLAG_RETI;
+		state->status = Z80_STATUS_RETI;
 		goto stop_emulation;
 #elif defined(Z80_CATCH_RETN)
-		state->status = Z80_STATUS_FLAG_RETN;
+		state->status = Z80_STATUS_RETN;
 		goto stop_emulation;
 #else
 		break;
@@ -1818,7 +1818,7 @@ emulate_next_instruction:
 
 	    case ED_UNDEFINED: {
 #ifdef Z80_CATCH_ED_UNDEFINED
-		state->status = Z80_STATUS_FLAG_ED_UNDEFINED;
+		state->status = Z80_STATUS_ED_UNDEFINED;
 		pc -= 2;
 		goto stop_emulation;
 #else
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+# Compare emulated Z80 cycles with and without BDOS HLE, see ../common/bdos-hle.h
+#
+# usage: bench.py fd.img file...
+#
+# The files are placed once inside a copy of the disk image (made by mkfd.sh),
+# and once in a hle/a/ directory next to an empty copy of it. Then each command
+# below is run in both setups, with stdin closed after it, and the cycle counts
+# reported by the emulator are compared. Commands which need a file which isn't
+# given are skipped.
+
+import os, re, shutil, subprocess, sys, tempfile
+
+PROG = os.path.abspath('.pio/build/native/program')
+
+TESTS = [
+    ('DIR', []),
+    ('TYPE BIOS2.Z80', ['bios2.z80']),
+    ('TYPE BDOS22.Z80', ['bdos22.z80']),
+    ('PIP X.Z80=BDOS22.Z80', ['pip.com', 'bdos22.z80']),
+    ('Z80ASM BDOS22', ['z80asm.com', 'bdos22.z80']),
+]
+
+# store files in the directory of an 8" SSSD image: 2 system tracks, 1 KB
+# blocks, and a 64-entry directory in blocks 0 and 1
+def addFiles (img, files):
+    base, nextBlock, entry = 2*26*128, 2, 0
+    for fn in files:
+        data = open(fn, 'rb').read()
+        data += b'\x1A' * (-len(data) % 128)
+        name, _, ext = os.path.basename(fn).upper().partition('.')
+        fcbName = (name.ljust(8) + ext.ljust(3)).encode()
+        recs, extent = len(data) // 128, 0
+        while True:
+            rc = min(128, recs - 128*extent)
+            blocks = []
+            for i in range((rc + 7) // 8):
+                pos = base + nextBlock*1024
+                seg = data[(128*extent + 8*i)*128:(128*extent + 8*i + 8)*128]
+                img[pos:pos+len(seg)] = seg
+                blocks.append(nextBlock)
+                nextBlock += 1
+            d = bytes([0]) + fcbName + bytes([extent & 31, 0, extent >> 5, rc])
+            d += bytes(blocks + [0] * (16 - len(blocks)))
+            img[base+32*entry:base+32*entry+32] = d
+            entry += 1
+            if recs - 128*extent <= 128:
+                break
+            extent += 1
+
+def run (cwd, cmd):
+    out = subprocess.run([PROG], cwd=cwd, input=(cmd + '\r').encode(),
+                            stdout=subprocess.PIPE, timeout=300).stdout
+    m = re.search(rb'(\d+) cycles', out)
+    return int(m.group(1)) if m else 0
+
+def main ():
+    empty = open(sys.argv[1], 'rb').read()
+    files = sys.argv[2:]
+    names = [os.path.basename(f).lower() for f in files]
+    print('%-24s %12s %12s %6s' % ('command', 'image', 'hle', 'gain'))
+    for cmd, needs in TESTS:
+        if not all(n in names for n in needs):
+            continue
+        tmp = tempfile.mkdtemp()
+        try:
+            os.makedirs(tmp + '/img')
+            img = bytearray(empty)
+            addFiles(img, files)
+            open(tmp + '/img/fd.img', 'wb').write(img)
+            os.makedirs(tmp + '/hle/hle/a')
+            open(tmp + '/hle/fd.img', 'wb').write(empty)
+            for f in files:
+                shutil.copy(f, tmp + '/hle/hle/a/' + os.path.basename(f).lower())
+            a, b = run(tmp + '/img', cmd), run(tmp + '/hle', cmd)
+            print('%-24s %12d %12d %5.1fx' % (cmd, a, b, a / b if b else 0))
+        finally:
+            shutil.rmtree(tmp)
+
+main()
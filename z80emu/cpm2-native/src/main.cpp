@@ -1,6 +1,10 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <ctype.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <time.h>
 
 extern "C" {
 #include "context.h"
@@ -8,6 +12,8 @@ extern "C" {
 #include "macros.h"
 }
 
+#include "bdos-hle.h"
+
 uint8_t mem [1<<16];
 
 // xxd -i <hexsave.com >../common-z80/hexsave.h
@@ -16,6 +22,7 @@ const uint8_t ram [] = {
 };
 
 Context context;
+BdosHle hle;
 
 struct Disk {
     FILE* fp;
@@ -48,13 +55,18 @@ static bool readable () {
 void systemCall (Context* z, int req, uint16_t pc) {
     Z80_STATE* state = &(z->state);
     //printf("req %d A %d\n", req, A);
+    hle.arm(z); // the BDOS may have been reloaded, i.e. after a warm boot
     switch (req) {
         case 0: // coninst
             A = readable() ? 0xFF : 0x00;
             break;
-        case 1: // conin
-            A = getchar();
+        case 1: { // conin
+            int c = getchar();
+            if (c == EOF)
+                z->done = 1; // end of input, e.g. a scripted run
+            A = c;
             break;
+        }
         case 2: // conout
             putchar(C);
             break;
@@ -84,6 +96,9 @@ void systemCall (Context* z, int req, uint16_t pc) {
             }
             A = 0;
             break;
+        case BdosHle::TRAP: // BDOS call, see bdos-hle.h
+            hle.call(z);
+            break;
         default:
             printf("syscall %d @ %04x ?\n", req, pc);
             while (1) {}
@@ -92,6 +107,7 @@ void systemCall (Context* z, int req, uint16_t pc) {
 
 int main() {
     disk.init();
+    int drives = hle.init("hle"); // drives mapped to host dirs, if present
 
     // emulated rom bootstrap, loads first disk sector to 0x0000
     disk.readSector(0, mapMem(&context, 0x0000));
@@ -103,9 +119,15 @@ int main() {
     Z80Reset(&context.state);
     context.done = 0;
 
+    // short slices, so that the cycle count stops soon after the end of input
+    uint64_t cycles = 0;
     do {
-        Z80Emulate(&context.state, 2000000, &context);
+        cycles += Z80Emulate(&context.state, 10000, &context);
     } while (!context.done);
 
+    printf("\n%llu cycles, %.2fs host CPU time\n", (unsigned long long) cycles,
+            (double) clock() / CLOCKS_PER_SEC);
+    if (drives > 0)
+        printf("BDOS: %u calls handled, %u passed on\n", hle.handled, hle.passed);
     return 0;
 }
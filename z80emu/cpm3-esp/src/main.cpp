@@ -14,7 +14,9 @@ extern "C" {
 #include "macros.h"
 }
 
-constexpr int BLKSZ = 512;
+#include "esp-io.h"
+
+constexpr int BLKSZ = IO_BLKSZ;
 
 #ifndef LED
 #define LED LED_BUILTIN
@@ -72,6 +74,8 @@ struct MappedDisk {
     }
 } mappedDisk[9]; // fd0..fd3 => 0..3, hda..hdd => 4..7, rd0..rd1 => 8
 
+constexpr int FLASH_UNIT = 9; // rd0..rd1 on raw flash, instead of unit 8
+
 struct EspFlash {
     constexpr static uint32_t pageSize = 4096;
 
@@ -104,6 +108,8 @@ const esp_partition_t* EspFlash::base = 0;
 
 SpiFlashWear<EspFlash,BLKSZ> flashDisk;
 
+EspIo io; // console and disk I/O, done on the other core
+
 static void setBankSplit (Context* z, uint8_t page) {
     z->split = mainMem + (page << 8);
     memset(z->offset, 0, sizeof z->offset);
@@ -130,11 +136,33 @@ static void setBankSplit (Context* z, uint8_t page) {
     printf("- split 0x%02X => %d banks\n", page, z->nbanks);
 }
 
+// called from the I/O task on core 0, never from the emulator
+int blockIo (BlockReq& r) {
+    if (r.dev == FLASH_UNIT)
+        return r.out ? flashDisk.writeBlock(r.blk, r.data)
+                     : flashDisk.readBlock(r.blk, r.data);
+    return r.out ? mappedDisk[r.dev].writeBlock(r.blk, r.data)
+                 : mappedDisk[r.dev].readBlock(r.blk, r.data);
+}
+
 int diskReq (Context* z, bool out, uint8_t dev, uint16_t pos, uint16_t addr) {
-    // use intermediate buffer, but only when I/O spans different chunks
-    uint8_t buf [BLKSZ];
+    // copy the block in one go, but only when it doesn't span different chunks
     uint8_t *first = mapMem(z, addr), *last = mapMem(z, addr+BLKSZ-1);
-    uint8_t *ptr = first+BLKSZ-1 == last ? first : buf;
+    bool contig = first+BLKSZ-1 == last;
+    auto fromGuest = [&](uint8_t* dst) {
+        if (contig)
+            memcpy(dst, first, BLKSZ);
+        else
+            for (int i = 0; i < BLKSZ; ++i)
+                dst[i] = *mapMem(z, addr+i);
+    };
+    auto toGuest = [&](uint8_t const* src) {
+        if (contig)
+            memcpy(first, src, BLKSZ);
+        else
+            for (int i = 0; i < BLKSZ; ++i)
+                *mapMem(z, addr+i) = src[i];
+    };
 
     int type = dev >> 6;
     int unit = dev & 0x0F;
@@ -157,29 +185,28 @@ int diskReq (Context* z, bool out, uint8_t dev, uint16_t pos, uint16_t addr) {
             dev, type, unit, out, z->bank, addr, pos, blk);
 #endif
 
+    // the ram disk in PSRAM never blocks, so it's done right here
+    if (type == 2 && hasExtraRam) {
+        if (out)
+            fromGuest(ramDisk + blk*BLKSZ);
+        else
+            toGuest(ramDisk + blk*BLKSZ);
+        return 0;
+    }
+
+    // everything else is done by the I/O task, the data goes via its request
+    BlockReq* r = io.request();
+    r->out = out;
+    r->dev = type == 2 && hasRawFlash ? FLASH_UNIT : unit;
+    r->blk = blk;
+
     int n = 0;
     if (out) {
-        if (ptr == buf)
-            for (int i = 0; i < sizeof buf; ++i)
-                buf[i] = *mapMem(z, addr+i);
-
-        if (type == 2 && hasExtraRam)
-            memcpy(ramDisk + blk*BLKSZ, ptr, n = BLKSZ);
-        else if (type == 2 && hasRawFlash)
-            n = flashDisk.writeBlock(blk, ptr);
-        else
-            n = mappedDisk[unit].writeBlock(blk, ptr);
+        fromGuest(r->data);
+        n = io.submit(r); // posted, the write is done later on the other core
     } else {
-        if (type == 2 && hasExtraRam)
-            memcpy(ptr, ramDisk + blk*BLKSZ, n = BLKSZ);
-        else if (type == 2 && hasRawFlash)
-            n = flashDisk.readBlock(blk, ptr);
-        else
-            n = mappedDisk[unit].readBlock(blk, ptr);
-
-        if (ptr == buf)
-            for (int i = 0; i < sizeof buf; ++i)
-                *mapMem(z, addr+i) = buf[i];
+        n = io.submit(r); // waits for the read, and for all the writes before it
+        toGuest(r->data);
     }
     //return n == BLKSZ ? 0 : 1; // TODO different error returns
     return 0;
@@ -194,18 +221,17 @@ void systemCall (Context* z, int req, int pc) {
 #endif
     switch (req) {
         case 0: // coninst
-            A = Serial.available() ? 0xFF : 0x00;
+            A = io.rxCount() > 0 ? 0xFF : 0x00;
             break;
         case 1: // conin
-            while (!Serial.available()) {}
-            A = Serial.read();
+            A = io.rxGet();
             break;
         case 2: // conout
-            Serial.write(C);
+            io.txPut(C);
             break;
         case 3: // constr
             for (uint16_t i = DE; *mapMem(z, i) != 0; i++)
-                Serial.write(*mapMem(z, i));
+                io.txPut(*mapMem(z, i));
             break;
         case 4: { // read/write
             //  ld a,(sekdrv)
@@ -467,14 +493,20 @@ void setup () {
         memcpy(mainMem + 0x0100, ram, sizeof ram);
     }
 
+    io.start(); // from here on, the console and disks are run by the I/O task
     printf("- start z80emu\n");
 
+    uint64_t cycles = 0;
+    uint32_t started = millis();
     do {
-        Z80Emulate(&context.state, 5000000, &context);
+        cycles += Z80Emulate(&context.state, 5000000, &context);
         digitalWrite(LED, !digitalRead(LED));
     } while (!context.done);
 
     printf("\n- done @ %04x\n", context.state.pc);
+    printf("- %.2f MHz emulated, %u reads, %u writes, %u stalls, %u errors\n",
+            cycles / 1000.0 / (millis() - started),
+            io.reads, io.writes, io.stalls, io.errors);
 }
 
 void loop () {}
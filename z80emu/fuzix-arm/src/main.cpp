@@ -23,6 +23,7 @@ SpiGpio< PinD<2>, PinC<8>, PinC<12>, PinC<11> > spi;
 SdCard< decltype(spi) > sd;
 
 Context context;
+bool rxIrq; // true if serial input should raise an interrupt
 // max: 3x60K+4K, 3x48K+16K, 4x32K+32K, 8x16K+48K, 16x8K+56K
 static uint8_t bankMem [120*1024]; // additional memory banks on F407
 
@@ -150,6 +151,9 @@ void systemCall (Context* z, int req, int pc) {
             HL += BC;
             break;
         }
+        case 11: // enable (C != 0) or disable serial input interrupts
+            rxIrq = C != 0;
+            break;
         default:
             printf("syscall %d @ %04x ?\n", req, pc);
             while (1) {}
@@ -191,7 +195,12 @@ int main() {
     context.done = 0;
 
     do {
-        Z80Emulate(&context.state, 2000000, &context);
+        // the UART's receive buffer is filled by its ISR, so as long as there
+        // is data waiting, keep asserting the interrupt (ignored if disabled)
+        if (rxIrq && console.readable())
+            Z80Interrupt(&context.state, 0xFF, &context);
+        // use short slices when input raises interrupts, to keep latency low
+        Z80Emulate(&context.state, rxIrq ? 20000 : 2000000, &context);
         led.toggle();
     } while (!context.done);
 
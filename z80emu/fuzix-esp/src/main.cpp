@@ -14,6 +14,10 @@ extern "C" {
 #include "macros.h"
 }
 
+#include "events.h"
+#include "loop-skip.h"
+#include "esp-io.h"
+
 #if LOLIN32
 constexpr int LED = 22; // not 5!
 #elif WROVER
@@ -32,7 +36,7 @@ constexpr int LED = LED_BUILTIN;
 #define MYFS SPIFFS
 #endif
 
-#define BLKSZ 512
+#define BLKSZ IO_BLKSZ
 
 uint8_t mainMem [1<<16];
 
@@ -46,7 +50,7 @@ struct MappedDisk {
         fp = fptr;
     }
 
-    void readBlock (int pos, void* buf) {
+    int readBlock (int pos, void* buf) {
         fp->seek(pos * BLKSZ);
         int e = fp->read((uint8_t*) buf, BLKSZ);
         if (e != BLKSZ)
@@ -58,14 +62,16 @@ struct MappedDisk {
             printf(" %02x", ((uint8_t*) buf)[i]);
         printf("\n");
 #endif
+        return e;
     }
 
-    void writeBlock (int pos, void const* buf) {
+    int writeBlock (int pos, void const* buf) {
         fp->seek(pos * BLKSZ);
         int e = fp->write((const uint8_t*) buf, BLKSZ);
         if (e != BLKSZ)
             printf("W %d? fp %08x pos %d buf %08x\n",
                     e, (int32_t) fp, pos, (int32_t) buf);
+        return e;
     }
 } mappedRoot, mappedSwap;
 
@@ -101,6 +107,50 @@ const esp_partition_t* EspFlash::base = 0;
 
 SpiFlashWear<EspFlash,512> flassDisk;
 
+// nominal clock rate of the emulated Z80, used to convert times to cycles
+constexpr uint32_t CPU_HZ = 4000000;
+
+EspIo io;               // console and disk I/O, done on the other core
+EventQueue<8> events;
+bool irqLine;           // set by devices, cleared once the Z80 accepts it
+uint32_t timerPeriod;   // cycles between clock interrupts, or 0 when off
+LoopSkip loops;         // idle and delay loop detection
+bool rxIrq;             // true if serial input should raise an interrupt
+uint32_t statusPolls;   // console status requests, for statistics
+uint32_t rxIrqs;        // interrupts raised by serial input, for statistics
+
+// periodic clock tick, raises an interrupt and then re-schedules itself
+static void timerTick (void*) {
+    irqLine = true;
+    events.after(timerPeriod, timerTick);
+}
+
+// called when the Z80 is in HALT: skip ahead to the next event, but block
+// this task for the equivalent real time, so that the core can go idle
+// this is also used for idle loops, which can end early when polling input
+static void idle (Context* z, bool polling =false) {
+    if (!polling && !z->state.iff1) { // halted with ints disabled, the end
+        z->done = 1;
+        return;
+    }
+    while (!irqLine) {
+        if (!events.pending()) { // nothing scheduled, so wait for serial input
+            while (io.rxCount() == 0)
+                io.wait();
+            break; // resume after the HALT, the guest will have to poll
+        }
+        uint32_t ms = events.slice(1<<30) / (CPU_HZ/1000);
+        // the I/O task can wake this up early, so wait for the tick count
+        TickType_t until = xTaskGetTickCount() + ms / portTICK_PERIOD_MS;
+        while ((int32_t) (until - xTaskGetTickCount()) > 0 &&
+                !((polling || rxIrq) && io.rxCount() > 0))
+            io.wait();
+        if ((polling || rxIrq) && io.rxCount() > 0)
+            break; // serial input has arrived, which the guest is waiting for
+        events.skip();
+    }
+}
+
 static void setBankSplit (Context* z, uint8_t page) {
     z->split = mainMem + (page << 8);
     memset(z->offset, 0, sizeof z->offset);
@@ -143,37 +193,47 @@ static void setBankSplit (Context* z, uint8_t page) {
 #endif
 }
 
+// called from the I/O task on core 0, never from the emulator
+int blockIo (BlockReq& r) {
+    bool hasFlashDisk = EspFlash::base != 0;
+
+    if (r.out) {
+        if (r.dev == 0)
+            return mappedRoot.writeBlock(r.blk, r.data);
+        else if (hasFlashDisk)
+            return flassDisk.writeBlock(r.blk, r.data);
+        else
+            return mappedSwap.writeBlock(r.blk, r.data);
+    } else {
+        if (r.dev == 0)
+            return mappedRoot.readBlock(r.blk, r.data);
+        else if (hasFlashDisk)
+            return flassDisk.readBlock(r.blk, r.data);
+        else
+            return mappedSwap.readBlock(r.blk, r.data);
+    }
+}
+
 void diskReq (Context* z, bool out, uint8_t disk, uint16_t pos, uint16_t addr) {
 #if 0
     //void* mem = mapMem(z, addr);
     printf("HD%d wr %d mem %d:0x%x pos %d\n",
             disk, out, z->bank, addr, pos);
 #endif
-    bool hasFlashDisk = EspFlash::base != 0;
-
-    // use intermediate buffer in case I/O spans different chunks
-    uint8_t buf [BLKSZ];
+    // the request's buffer also takes care of I/O which spans different chunks
+    BlockReq* r = io.request();
+    r->out = out;
+    r->dev = disk;
+    r->blk = pos;
 
     if (out) {
-        for (int j = 0; j < sizeof buf; ++j)
-            buf[j] = *mapMem(z, addr + j);
-
-        if (disk == 0)
-            mappedRoot.writeBlock(pos, buf);
-        else if (hasFlashDisk)
-            flassDisk.writeBlock(pos, buf);
-        else
-            mappedSwap.writeBlock(pos, buf);
+        for (int j = 0; j < BLKSZ; ++j)
+            r->data[j] = *mapMem(z, addr + j);
+        io.submit(r); // posted, the write is done later on the other core
     } else {
-        if (disk == 0)
-            mappedRoot.readBlock(pos, buf);
-        else if (hasFlashDisk)
-            flassDisk.readBlock(pos, buf);
-        else
-            mappedSwap.readBlock(pos, buf);
-
-        for (int j = 0; j < sizeof buf; ++j)
-            *mapMem(z, addr + j) = buf[j];
+        io.submit(r); // waits for the read, and for all the writes before it
+        for (int j = 0; j < BLKSZ; ++j)
+            *mapMem(z, addr + j) = r->data[j];
     }
 }
 
@@ -186,18 +246,18 @@ void systemCall (Context* z, int req, int pc) {
 #endif
     switch (req) {
         case 0: // coninst
-            A = Serial.available() ? 0xFF : 0x00;
+            A = io.rxCount() > 0 ? 0xFF : 0x00;
+            ++statusPolls;
             break;
         case 1: // conin
-            while (!Serial.available()) {}
-            A = Serial.read();
+            A = io.rxGet();
             break;
         case 2: // conout
-            Serial.write(C);
+            io.txPut(C);
             break;
         case 3: // constr
             for (uint16_t i = DE; *mapMem(z, i) != 0; i++)
-                Serial.write(*mapMem(z, i));
+                io.txPut(*mapMem(z, i));
             break;
         case 4: { // read/write
             //  ld a,(sekdrv)
@@ -251,6 +311,15 @@ void systemCall (Context* z, int req, int pc) {
             HL += BC;
             break;
         }
+        case 10: // start periodic clock interrupts, HL = ticks/sec, 0 = off
+            events.cancel(timerTick);
+            timerPeriod = HL > 0 ? CPU_HZ / HL : 0;
+            if (timerPeriod > 0)
+                events.after(timerPeriod, timerTick);
+            break;
+        case 11: // enable (C != 0) or disable serial input interrupts
+            rxIrq = C != 0;
+            break;
         default:
             printf("syscall %d @ %04x ?\n", req, pc);
             while (1) {}
@@ -273,6 +342,7 @@ void listDir (fs::FS &fs, const char * dirname) {
 }
 
 void setup () {
+    Serial.setRxBufferSize(4096); // room for pasted text, filled by the ISR
     Serial.begin(115200);
     printf("\n");
     pinMode(LED, OUTPUT);
@@ -359,18 +429,60 @@ void setup () {
         EspFlash::init(ep);
     }
 
+    io.start(); // from here on, the console and disks are run by the I/O task
     printf("- start z80emu\n");
 
     static Context context; // just static so it starts out cleared
     Z80Reset(&context.state);
     context.state.pc = origin;
 
+    uint64_t blink = 0;
+    uint32_t started = millis();
     do {
-        Z80Emulate(&context.state, 5000000, &context);
-        digitalWrite(LED, !digitalRead(LED));
+        bool taken = false;
+        if (rxIrq && !irqLine && io.rxCount() > 0) {
+            irqLine = true; // stays pending until the guest empties the FIFO
+            ++rxIrqs;
+        }
+        if (irqLine) {
+            int n = Z80Interrupt(&context.state, 0xFF, &context);
+            if (n > 0) { // only cleared once accepted, i.e. level-triggered
+                irqLine = false;
+                taken = true;
+                events.now += n;
+            }
+        }
+        // run up to the next event, but poll often while an irq is pending,
+        // and stop shortly after an interrupt, to check for idle/delay loops
+        int n = events.slice(irqLine ? 1000 : taken ? 5000 : 5000000);
+        events.advance(Z80Emulate(&context.state, n, &context));
+        if (context.state.status == Z80_STATUS_HALT)
+            idle(&context);
+        else if (!irqLine && loops.check(&context, events) == LoopSkip::IDLE) {
+            uint64_t start = events.now;
+            idle(&context, true);
+            loops.idled(&context, events.now - start);
+        }
+        if (events.now >= blink) {
+            blink = events.now + 5000000;
+            digitalWrite(LED, !digitalRead(LED));
+        }
     } while (!context.done);
 
     printf("\n- done @ %04x\n", context.state.pc);
+
+    // estimate the time saved, based on the speed of actual emulation, but
+    // note that idle skipping saves power rather than time, as it blocks
+    uint64_t skipped = events.skipped + loops.delayCycles;
+    double busy = (millis() - started) / 1000.0 - (double) events.skipped / CPU_HZ;
+    double perCycle = busy / (events.now - skipped);
+    printf("- %u idle loops (%llu cycles), %u delay loops (%llu cycles)\n",
+            loops.idles, loops.idleCycles, loops.delays, loops.delayCycles);
+    printf("- %llu cycles, %llu skipped, %.2f s saved\n",
+            events.now, skipped, perCycle * loops.delayCycles);
+    printf("- %u status polls, %u input interrupts\n", statusPolls, rxIrqs);
+    printf("- %.2f MHz emulated, %u reads, %u writes, %u stalls, %u errors\n",
+            1e-6 / perCycle, io.reads, io.writes, io.stalls, io.errors);
 }
 
 void loop () {}
@@ -1,9 +1,11 @@
+#include <inttypes.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
 #include "cpmdate.h"
 #include "console-posix.h"
+#include "events.h"
 
 extern "C" {
 #include "context.h"
@@ -11,12 +13,52 @@ extern "C" {
 #include "macros.h"
 }
 
+#include "loop-skip.h"
+
 Context context;
 uint8_t mainMem [1<<16];
 uint8_t bankMem [480*1024]; // additional memory banks
 
 FILE* disk_fp;
 
+// nominal clock rate of the emulated Z80, used to convert times to cycles
+constexpr uint32_t CPU_HZ = 4000000;
+
+EventQueue<8> events;
+bool irqLine;           // set by devices, cleared once the Z80 accepts it
+uint32_t timerPeriod;   // cycles between clock interrupts, or 0 when off
+LoopSkip loops;         // idle and delay loop detection
+bool rxIrq;             // true if console input should raise an interrupt
+uint32_t statusPolls;   // console status requests, for statistics
+uint32_t rxIrqs;        // interrupts raised by console input, for statistics
+
+// periodic clock tick, raises an interrupt and then re-schedules itself
+static void timerTick (void*) {
+    irqLine = true;
+    events.after(timerPeriod, timerTick);
+}
+
+// called when the Z80 is in HALT: skip ahead to the next event, but sleep for
+// the equivalent amount of real time, so that an idle guest keeps host idle
+// this is also used for idle loops, which can end early when polling input
+static void idle (bool polling =false) {
+    if (!polling && !context.state.iff1) { // halted with ints disabled, the end
+        context.done = 1;
+        return;
+    }
+    while (!irqLine) {
+        if (!events.pending()) { // nothing scheduled, so wait for console input
+            if (!consoleRxWait(-1))
+                context.done = 1; // end of input, nothing else can happen
+            break; // resume after the HALT, the guest will have to poll
+        }
+        bool input = consoleRxWait(events.slice(1<<30) / (CPU_HZ/1000000));
+        if (input && (polling || rxIrq))
+            break; // console input has arrived, which the guest is waiting for
+        events.skip();
+    }
+}
+
 void disk_init () {
     const char* name = "hd.img";
     disk_fp = fopen(name, "r+");
@@ -61,10 +103,11 @@ void systemCall (Context* z, int req, int pc) {
 #endif
     switch (req) {
         case 0: // coninst
-            A = consoleHit() ? 0xFF : 0x00;
+            A = consoleRxCount() > 0 ? 0xFF : 0x00;
+            ++statusPolls;
             break;
         case 1: // conin
-            A = consoleWait();
+            A = consoleRxWait(-1) ? consoleRxGet() : 0;
             break;
         case 2: // conout
             consoleOut(C);
@@ -164,6 +207,15 @@ void systemCall (Context* z, int req, int pc) {
                 state->registers.word[Z80_IY],
                 SP, pc);
             break;
+        case 10: // start periodic clock interrupts, HL = ticks/sec, 0 = off
+            events.cancel(timerTick);
+            timerPeriod = HL > 0 ? CPU_HZ / HL : 0;
+            if (timerPeriod > 0)
+                events.after(timerPeriod, timerTick);
+            break;
+        case 11: // enable (C != 0) or disable console input interrupts
+            rxIrq = C != 0;
+            break;
         default:
             printf("syscall %d @ %04x ?\r\n", req, pc);
             exit(2);
@@ -192,6 +244,7 @@ int main() {
         tcsetattr(0, TCSANOW, &tios);
     } else
         batchMode = 1;
+    consoleStartReader();
 
     // start emulating
     Z80Reset(&context.state);
@@ -199,9 +252,44 @@ int main() {
     context.done = 0;
 
     do {
-        Z80Emulate(&context.state, 2000000, &context);
+        bool taken = false;
+        if (rxIrq && !irqLine && consoleRxCount() > 0) {
+            irqLine = true; // stays pending until the guest empties the FIFO
+            ++rxIrqs;
+        }
+        if (irqLine) {
+            int n = Z80Interrupt(&context.state, 0xFF, &context);
+            if (n > 0) { // only cleared once accepted, i.e. level-triggered
+                irqLine = false;
+                taken = true;
+                events.now += n;
+            }
+        }
+        // run up to the next event, but poll often while an irq is pending,
+        // and stop shortly after an interrupt, to check for idle/delay loops
+        int n = events.slice(irqLine ? 1000 : taken ? 5000 : 2000000);
+        events.advance(Z80Emulate(&context.state, n, &context));
+        if (context.state.status == Z80_STATUS_HALT)
+            idle();
+        else if (!irqLine && loops.check(&context, events) == LoopSkip::IDLE) {
+            uint64_t start = events.now;
+            idle(true);
+            loops.idled(&context, events.now - start);
+        }
     } while (!context.done);
 
     printf("\r\ndone @ %04x\r\n", context.state.pc);
+    printf("%" PRIu64 " cycles, %u slices, %u events, %" PRIu64
+            " cycles skipped\r\n",
+            events.now, events.slices, events.fired, events.skipped);
+
+    // estimate the host CPU time saved, based on the speed of actual emulation
+    uint64_t skipped = events.skipped + loops.delayCycles;
+    double perCycle = (double) clock() / CLOCKS_PER_SEC / (events.now - skipped);
+    printf("loops: %u idle (%" PRIu64 " cycles), %u delay (%" PRIu64
+            " cycles), %.2fs host CPU time saved\r\n", loops.idles,
+            loops.idleCycles, loops.delays, loops.delayCycles, perCycle * skipped);
+    printf("console: %u status polls, %u input interrupts\r\n",
+            statusPolls, rxIrqs);
     return 0;
 }
@@ -0,0 +1,106 @@
+// Host-side check of the loop fast-forwarding in ../common/loop-skip.h
+//
+// Each test is a small Z80 program with one tight loop, ending in "out (0),a".
+// It's run once as is, and once with LoopSkip probing after every slice, as in
+// fuzix-native. Both runs must end with the same registers, R, and cycle count.
+// Loops which only count down must also have been skipped, the others not.
+
+#include <string.h>
+#include <stdio.h>
+
+extern "C" {
+#include "context.h"
+#include "z80emu.h"
+#include "macros.h"
+}
+
+#include "events.h"
+#include "loop-skip.h"
+
+uint8_t mem [1<<16];
+
+void systemCall (Context*, int, uint16_t) {}
+
+struct Result {
+    Z80_STATE state;
+    uint64_t cycles;
+    uint32_t delays;
+};
+
+static Result run (uint8_t const* code, int len, bool skip) {
+    memset(mem, 0, sizeof mem);
+    memcpy(mem, code, len);
+    Context ctx;
+    memset(&ctx, 0, sizeof ctx);
+    Z80Reset(&ctx.state);
+
+    EventQueue<8> events;
+    LoopSkip loops;
+    do {
+        events.advance(Z80Emulate(&ctx.state, events.slice(1000), &ctx));
+        if (skip && !ctx.done)
+            loops.check(&ctx, events);
+    } while (!ctx.done);
+    return { ctx.state, events.now, loops.delays };
+}
+
+static bool test (char const* what, uint8_t const* code, int len, bool delay) {
+    Result a = run(code, len, false), b = run(code, len, true);
+    Z80_STATE const& x = a.state;
+    Z80_STATE const& y = b.state;
+    bool same = memcmp(x.registers.word, y.registers.word,
+                        sizeof x.registers.word) == 0 &&
+                x.r == y.r && x.pc == y.pc && a.cycles == b.cycles;
+    bool ok = same && (b.delays > 0) == delay;
+    printf("%-28s A %02X/%02X F %02X/%02X %7llu cycles, %u skips%s\n", what,
+            x.registers.byte[Z80_A], y.registers.byte[Z80_A],
+            x.registers.byte[Z80_F], y.registers.byte[Z80_F],
+            (unsigned long long) a.cycles, b.delays, ok ? "" : "  *FAILED*");
+    return ok;
+}
+
+#define TEST(what, delay, ...) { \
+    static const uint8_t code [] = { __VA_ARGS__, 0xD3, 0x00 }; \
+    failures += !test(what, code, sizeof code, delay); \
+}
+
+int main () {
+    int failures = 0;
+
+    // pure count-downs, these must be skipped
+    TEST("djnz", true,
+        0x06, 0xC8,                 // ld b,200
+        0x10, 0xFE)                 // djnz $
+    TEST("dec c / jr nz", true,
+        0x0E, 0xC8,                 // ld c,200
+        0x0D,                       // loop: dec c
+        0x20, 0xFD)                 // jr nz,loop
+    TEST("dec bc / ld a,b / or c", true,
+        0x01, 0x10, 0x27,           // ld bc,10000
+        0x0B,                       // loop: dec bc
+        0x78,                       // ld a,b
+        0xB1,                       // or c
+        0x20, 0xFB)                 // jr nz,loop
+
+    // the accumulator does real work next to the count-down, no skipping
+    TEST("add a,c / djnz", false,
+        0x3E, 0x00,                 // ld a,0
+        0x0E, 0x03,                 // ld c,3
+        0x06, 0xC8,                 // ld b,200
+        0x81,                       // loop: add a,c
+        0x10, 0xFD)                 // djnz loop, ends with A = 600 & 0FFh
+    TEST("rlca / djnz", false,
+        0x3E, 0x01,                 // ld a,1
+        0x06, 0xC9,                 // ld b,201
+        0x07,                       // loop: rlca
+        0x10, 0xFD)                 // djnz loop
+    TEST("ccf / dec b / jr nz", false,
+        0xB7,                       // or a, clears carry
+        0x06, 0xC9,                 // ld b,201
+        0x3F,                       // loop: ccf
+        0x05,                       // dec b
+        0x20, 0xFC)                 // jr nz,loop
+
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures != 0;
+}
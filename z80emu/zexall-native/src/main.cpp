@@ -7,6 +7,8 @@ extern "C" {
 #include "z80emu.h"
 }
 
+#include "events.h"
+
 const uint8_t rom [] = {
 #include "zexall.h"
 };
@@ -14,6 +16,15 @@ const uint8_t rom [] = {
 uint8_t mem [1<<16];
 Context context;
 
+// set to a non-zero cycle count to measure the event queue's overhead
+#define TICK_CYCLES 0
+
+EventQueue<8> events;
+
+static void tick (void*) {
+    events.after(TICK_CYCLES, tick);
+}
+
 void systemCall (Context *ctx, int, uint16_t) {
     auto& regs = ctx->state.registers;
 
@@ -57,16 +68,21 @@ int main() {
     context.state.pc = 0x100;
     context.done = 0;
 
-    uint64_t cycles = 0;
+    if (TICK_CYCLES)
+        events.after(TICK_CYCLES, tick);
+
     uint32_t start = millis();
 
     do
-        cycles += Z80Emulate(&context.state, 1000000000, &context);
+        events.advance(Z80Emulate(&context.state,
+                                    events.slice(1000000000), &context));
     while (!context.done);
 
     uint32_t t = millis() - start;
+    uint64_t cycles = events.now;
     printf("\nEmulating zexall took %.1f seconds: %llu cycles @ %.1f MHz\n",
             t/1000.0, cycles, cycles/(1000.0*t));
+    printf("%u slices, %u events\n", events.slices, events.fired);
 
     // Mac Mini 2018 i7 @ 3.2 GHz:
     //  Emulating zexall took 48.8 seconds: 46734978649 cycles @ 957.2 MHz